@@ -0,0 +1,143 @@
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Move constructor
+  template <typename Node>
+  PoolAllocator<Node>::PoolAllocator(PoolAllocator<Node> &&other) noexcept
+  {
+    std::swap(blocks, other.blocks);
+    std::swap(freeList, other.freeList);
+    std::swap(cursor, other.cursor);
+    std::swap(limit, other.limit);
+    std::swap(nextBlockNodes, other.nextBlockNodes);
+  }
+
+  // Destructor
+  template <typename Node>
+  PoolAllocator<Node>::~PoolAllocator()
+  {
+    Release();
+  }
+
+  // Move assignment
+  template <typename Node>
+  PoolAllocator<Node> &PoolAllocator<Node>::operator=(PoolAllocator<Node> &&other) noexcept
+  {
+    std::swap(blocks, other.blocks);
+    std::swap(freeList, other.freeList);
+    std::swap(cursor, other.cursor);
+    std::swap(limit, other.limit);
+    std::swap(nextBlockNodes, other.nextBlockNodes);
+    return *this;
+  }
+
+  // Specific member functions
+
+  template <typename Node>
+  template <typename... Args>
+  Node *PoolAllocator<Node>::New(Args &&...args)
+  {
+    Slot *slot = Grab();
+    try
+    {
+      return ::new (static_cast<void *>(slot->storage)) Node(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+      slot->nextFree = freeList; // Construction failed: the slot stays available
+      freeList = slot;
+      throw;
+    }
+  }
+
+  template <typename Node>
+  void PoolAllocator<Node>::Delete(Node *node) noexcept
+  {
+    node->~Node();
+    Slot *slot = reinterpret_cast<Slot *>(node);
+    slot->nextFree = freeList;
+    freeList = slot;
+  }
+
+  template <typename Node>
+  void PoolAllocator<Node>::Release() noexcept
+  {
+    while (blocks != nullptr)
+    {
+      Block *block = blocks;
+      blocks = blocks->next;
+      ::operator delete(static_cast<void *>(block), std::align_val_t(alignof(Slot)));
+    }
+
+    freeList = nullptr;
+    cursor = limit = nullptr;
+    nextBlockNodes = MinBlockNodes;
+  }
+
+  template <typename Node>
+  void PoolAllocator<Node>::Adopt(PoolAllocator<Node> &other) noexcept
+  {
+    if (this == &other || other.blocks == nullptr)
+    {
+      return;
+    }
+
+    // Chain the blocks of other after ours; its unused slots are dropped
+    // until the next Release
+    Block *last = other.blocks;
+    while (last->next != nullptr)
+    {
+      last = last->next;
+    }
+    last->next = blocks;
+    blocks = other.blocks;
+    if (cursor == limit)
+    {
+      cursor = other.cursor; // Our newest block is full: bump-allocate from the adopted one
+      limit = other.limit;
+    }
+
+    other.blocks = nullptr;
+    other.freeList = nullptr;
+    other.cursor = other.limit = nullptr;
+    other.nextBlockNodes = MinBlockNodes;
+  }
+
+  // Auxiliary functions
+
+  template <typename Node>
+  typename PoolAllocator<Node>::Slot *PoolAllocator<Node>::Grab()
+  {
+    if (freeList != nullptr)
+    {
+      Slot *slot = freeList; // Most recently released slot: likely still in cache
+      freeList = freeList->nextFree;
+      return slot;
+    }
+
+    if (cursor == limit)
+    {
+      // Header padded to the slot alignment so that slots follow it directly
+      constexpr ulong header = (sizeof(Block) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+      void *memory = ::operator new(header + nextBlockNodes * sizeof(Slot), std::align_val_t(alignof(Slot)));
+
+      Block *block = ::new (memory) Block();
+      block->next = blocks;
+      blocks = block;
+
+      cursor = reinterpret_cast<Slot *>(static_cast<unsigned char *>(memory) + header);
+      limit = cursor + nextBlockNodes;
+      if (nextBlockNodes < MaxBlockNodes)
+      {
+        nextBlockNodes *= 2; // Geometric growth keeps the number of blocks logarithmic
+      }
+    }
+
+    return cursor++;
+  }
+
+  /* ************************************************************************** */
+
+}
@@ -0,0 +1,152 @@
+#ifndef ALLOCATOR_HPP
+#define ALLOCATOR_HPP
+
+/* ************************************************************************** */
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "sys/types.h"
+
+/* ************************************************************************** */
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Node allocation policies for the linked containers (List, SetLst, SetAvl).
+  // A policy is instantiated on the node type and provides:
+  //   New(args...)  allocate and construct one node
+  //   Delete(node)  destroy and release one node
+  //   Release()     drop all storage at once (only when no node is alive)
+  //   Adopt(other)  take over the storage of other, whose nodes were moved here
+  //   BulkRelease   true when Release alone reclaims every node, so trivially
+  //                 destructible nodes need not be deleted one by one
+
+  /* ************************************************************************** */
+
+  template <typename Node>
+  class HeapAllocator
+  {
+    // Every node is a separate new/delete (the default policy)
+
+  public:
+    static constexpr bool BulkRelease = false;
+
+    // Default constructor
+    HeapAllocator() = default;
+
+    // Copy constructor
+    HeapAllocator(const HeapAllocator &) = delete;
+
+    // Move constructor
+    HeapAllocator(HeapAllocator &&) noexcept = default;
+
+    // Copy assignment
+    HeapAllocator &operator=(const HeapAllocator &) = delete;
+
+    // Move assignment
+    HeapAllocator &operator=(HeapAllocator &&) noexcept = default;
+
+    /* ************************************************************************ */
+
+    // Specific member functions
+
+    template <typename... Args>
+    Node *New(Args &&...args) { return new Node(std::forward<Args>(args)...); }
+
+    void Delete(Node *node) noexcept { delete node; }
+
+    void Release() noexcept {} // Nodes were already deleted one by one
+
+    void Adopt(HeapAllocator &) noexcept {} // Heap nodes belong to no allocator
+  };
+
+  /* ************************************************************************** */
+
+  template <typename Node>
+  class PoolAllocator
+  {
+    // Slab allocator: nodes are carved out of contiguous blocks (doubling in
+    // size up to MaxBlockNodes) and recycled through a free list. Storage goes
+    // back to the system only on Release or destruction, all blocks at once.
+
+  private:
+    // ...
+
+  protected:
+    union Slot
+    {
+      Slot *nextFree; // Link in the free list while the slot is unused
+      alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct Block
+    {
+      Block *next = nullptr; // Previously allocated block, the slots follow this header
+    };
+
+    static constexpr ulong MinBlockNodes = 16;
+    static constexpr ulong MaxBlockNodes = 4096;
+
+    Block *blocks = nullptr;              // Most recent block first
+    Slot *freeList = nullptr;             // Slots released by Delete
+    Slot *cursor = nullptr;               // Next never-used slot in the newest block
+    Slot *limit = nullptr;                // End of the newest block
+    ulong nextBlockNodes = MinBlockNodes; // Slots in the next block to allocate
+
+  public:
+    static constexpr bool BulkRelease = true;
+
+    // Default constructor
+    PoolAllocator() = default;
+
+    /* ************************************************************************ */
+
+    // Copy constructor
+    PoolAllocator(const PoolAllocator &) = delete;
+
+    // Move constructor
+    PoolAllocator(PoolAllocator &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Destructor
+    ~PoolAllocator();
+
+    /* ************************************************************************ */
+
+    // Copy assignment
+    PoolAllocator &operator=(const PoolAllocator &) = delete;
+
+    // Move assignment
+    PoolAllocator &operator=(PoolAllocator &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member functions
+
+    template <typename... Args>
+    Node *New(Args &&...); // Construct a node in a free slot (reuses released slots first)
+
+    void Delete(Node *) noexcept; // Destroy a node and put its slot on the free list
+
+    void Release() noexcept; // Free every block (all nodes must already be destroyed)
+
+    void Adopt(PoolAllocator &) noexcept; // Take over the blocks of other (its nodes now live here)
+
+  protected:
+    // Auxiliary functions
+
+    Slot *Grab(); // A free slot, allocating a new block when needed
+  };
+
+  /* ************************************************************************** */
+
+}
+
+#include "allocator.cpp" // Include implementation file
+
+#endif
@@ -0,0 +1,14 @@
+#include "zmybench/bench.hpp"
+
+/* ************************************************************************** */
+
+#include <iostream>
+
+/* ************************************************************************** */
+
+int main()
+{
+  std::cout << "LASD Libraries 2025 - Benchmarks" << std::endl;
+  mylasdbench();
+  return 0;
+}
@@ -11,6 +11,19 @@ namespace lasd
     PreOrderTraverse(fun); // Default traversal is equivalent to pre-order traversal
   }
 
+  template <typename Data>
+  bool LinearContainer<Data>::TraverseWhile(TraverseWhileFun fun) const
+  {
+    for (ulong i = 0; i < this->Size(); i++)
+    {
+      if (!fun(operator[](i)))
+      {
+        return false; // Stop at the first element the function rejects
+      }
+    }
+    return true;
+  }
+
   template <typename Data>
   void LinearContainer<Data>::PreOrderTraverse(TraverseFun fun) const
   {
@@ -70,6 +70,10 @@ namespace lasd
 
     void Traverse(TraverseFun) const override; // Generic traversal implementation
 
+    using typename TraversableContainer<Data>::TraverseWhileFun;
+
+    bool TraverseWhile(TraverseWhileFun) const override; // Generic early-exit traversal, front to back by index
+
     /* ************************************************************************ */
 
     // Specific member function (inherited from PreOrderTraversableContainer)
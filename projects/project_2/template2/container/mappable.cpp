@@ -3,6 +3,18 @@ namespace lasd
 
   /* ************************************************************************** */
 
+  // MappableContainer implementation
+
+  template <typename Data>
+  template <typename Fun>
+  void MappableContainer<Data>::MapInPlace(Fun &&fun)
+  {
+    Map([&fun](Data &data)
+        { fun(data); }); // Type-erased fallback: the callable itself is not copied
+  }
+
+  /* ************************************************************************** */
+
   // PreOrderMappableContainer implementation
 
   template <typename Data>
@@ -55,6 +55,11 @@ namespace lasd
     // Specific member function
     using MapFun = std::function<void(Data &)>;
     virtual void Map(MapFun) = 0;
+
+    // Template entry point taking any callable. Concrete containers hide it
+    // with an inlineable loop; through a base reference it falls back to Map.
+    template <typename Fun>
+    void MapInPlace(Fun &&); // Apply callable to each element (mutable)
   };
 
   /* ************************************************************************** */
@@ -8,16 +8,24 @@ namespace lasd
   template <typename Data>
   bool TraversableContainer<Data>::Exists(const Data &data) const noexcept
   {
+    return !TraverseWhile([&data](const Data &currentData)
+                          {
+                            return !(currentData == data); // Stop as soon as the element is found
+                          });
+  }
 
-    bool exists = false;
+  template <typename Data>
+  bool TraversableContainer<Data>::TraverseWhile(TraverseWhileFun fun) const
+  {
+    bool running = true;
 
-    Traverse([&exists, &data](const Data &currentData)
+    Traverse([&running, &fun](const Data &data)
              {
-      if (currentData == data) {
-        exists = true;  // Set flag to true if element is found
-      } }); // Traverse entire container looking for the element
+      if (running) {
+        running = fun(data);  // Once stopped, the remaining elements are walked but not visited
+      } });
 
-    return exists; // Return whether element was found
+    return running; // Return whether the traversal reached the end
   }
 
   /* ************************************************************************** */
@@ -48,7 +56,7 @@ namespace lasd
   template <typename Accumulator>
   Accumulator TraversableContainer<Data>::Fold(FoldFun<Accumulator> foldFun, Accumulator accumulator) const
   {
-    Traverse([&accumulator, foldFun](const Data &data)
+    Traverse([&accumulator, &foldFun](const Data &data)
              {
                accumulator = foldFun(data, accumulator); // Apply fold function to each element, updating accumulator
              });
@@ -56,11 +64,69 @@ namespace lasd
     return accumulator; // Return final accumulated value
   }
 
+  template <typename Data>
+  template <typename Fun>
+  void TraversableContainer<Data>::ForEach(Fun &&fun) const
+  {
+    Traverse([&fun](const Data &data)
+             { fun(data); }); // Type-erased fallback: the callable itself is not copied
+  }
+
+  template <typename Data>
+  template <typename Accumulator, typename Fun>
+  Accumulator TraversableContainer<Data>::Reduce(Fun &&fun, Accumulator accumulator) const
+  {
+    Traverse([&accumulator, &fun](const Data &data)
+             { accumulator = fun(data, accumulator); });
+
+    return accumulator; // Return final accumulated value
+  }
+
+  template <typename Data>
+  template <typename Predicate>
+  bool TraversableContainer<Data>::Any(Predicate &&predicate) const
+  {
+    return !TraverseWhile([&predicate](const Data &data)
+                          { return !predicate(data); }); // Stopped early means a match was found
+  }
+
+  template <typename Data>
+  template <typename Predicate>
+  bool TraversableContainer<Data>::All(Predicate &&predicate) const
+  {
+    return TraverseWhile([&predicate](const Data &data)
+                         { return static_cast<bool>(predicate(data)); }); // Stop at the first counterexample
+  }
+
+  template <typename Data>
+  template <typename Predicate>
+  bool TraversableContainer<Data>::None(Predicate &&predicate) const
+  {
+    return !Any(predicate);
+  }
+
+  template <typename Data>
+  template <typename Predicate>
+  ulong TraversableContainer<Data>::FindFirst(Predicate &&predicate) const
+  {
+    ulong position = 0;
+
+    TraverseWhile([&position, &predicate](const Data &data)
+                  {
+      if (predicate(data)) {
+        return false;  // Found: position stays on this element
+      }
+      position++;
+      return true; });
+
+    return position; // Equals the number of visited elements, i.e. Size(), when nothing matched
+  }
+
   template <typename Data>
   template <typename Accumulator>
   Accumulator PreOrderTraversableContainer<Data>::PreOrderFold(FoldFun<Accumulator> foldFun, Accumulator accumulator) const
   {
-    PreOrderTraverse([&accumulator, foldFun](const Data &data)
+    PreOrderTraverse([&accumulator, &foldFun](const Data &data)
                      {
                        accumulator = foldFun(data, accumulator); // Apply fold function in pre-order, updating accumulator
                      });
@@ -72,7 +138,7 @@ namespace lasd
   template <typename Accumulator>
   Accumulator PostOrderTraversableContainer<Data>::PostOrderFold(FoldFun<Accumulator> foldFun, Accumulator accumulator) const
   {
-    PostOrderTraverse([&accumulator, foldFun](const Data &data)
+    PostOrderTraverse([&accumulator, &foldFun](const Data &data)
                       {
                         accumulator = foldFun(data, accumulator); // Apply fold function in post-order, updating accumulator
                       });
@@ -47,8 +47,35 @@ namespace lasd
     template <typename Accumulator>
     Accumulator Fold(FoldFun<Accumulator>, Accumulator) const; // Apply fold operation across all elements
 
+    // Template entry points taking any callable. Concrete containers hide them
+    // with inlineable loops; through a base reference they fall back to Traverse.
+    template <typename Fun>
+    void ForEach(Fun &&) const; // Apply callable to each element (read-only)
+
+    template <typename Accumulator, typename Fun>
+    Accumulator Reduce(Fun &&, Accumulator) const; // Fold with any callable (same arguments as FoldFun)
+
+    // Short-circuiting traversal: the callback returns true to continue and
+    // false to stop. The default visits through Traverse and only skips the
+    // calls after a stop; concrete containers override it to leave the walk.
+    using TraverseWhileFun = std::function<bool(const Data &)>; // Function type for early-exit traversals
+    virtual bool TraverseWhile(TraverseWhileFun) const;         // Apply function in Traverse order until it returns false (returns false if stopped)
+
+    // Queries built on TraverseWhile: they stop at the first deciding element
+    template <typename Predicate>
+    bool Any(Predicate &&) const; // Whether some element satisfies the predicate
+
+    template <typename Predicate>
+    bool All(Predicate &&) const; // Whether every element satisfies the predicate (true when empty)
+
+    template <typename Predicate>
+    bool None(Predicate &&) const; // Whether no element satisfies the predicate (true when empty)
+
+    template <typename Predicate>
+    ulong FindFirst(Predicate &&) const; // Traverse position of the first element satisfying the predicate (Size() when none)
+
     // Specific member function (inherited from TestableContainer)
-    inline bool Exists(const Data &) const noexcept override; // Implementation of element existence check
+    inline bool Exists(const Data &) const noexcept override; // Implementation of element existence check (stops at the first match)
   };
 
   /* ************************************************************************** */
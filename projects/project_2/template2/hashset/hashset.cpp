@@ -0,0 +1,570 @@
+#include <memory>
+#include <stdexcept>
+
+namespace lasd
+{
+  /* ************************************************************************** */
+
+  // Specific constructors
+
+  template <typename Data, typename Hash>
+  HashSet<Data, Hash>::HashSet(const Hash &hash) : hasher(hash)
+  {
+  }
+
+  template <typename Data, typename Hash>
+  HashSet<Data, Hash>::HashSet(const TraversableContainer<Data> &container)
+  {
+    Reserve(container.Size()); // One allocation: no rehash while filling
+    container.Traverse([this](const Data &data)
+                       { InsertValue(data); });
+  }
+
+  template <typename Data, typename Hash>
+  HashSet<Data, Hash>::HashSet(MappableContainer<Data> &&container) noexcept
+  {
+    Reserve(container.Size());
+    container.Map([this](Data &data)
+                  { InsertValue(std::move(data)); });
+  }
+
+  // Copy constructor
+  template <typename Data, typename Hash>
+  HashSet<Data, Hash>::HashSet(const HashSet<Data, Hash> &other) : maxLoad(other.maxLoad), hasher(other.hasher)
+  {
+    if (other.capacity == 0)
+    {
+      return;
+    }
+
+    // Same capacity and hash: every element lands in the slot it has in other
+    Allocate(other.capacity);
+    try
+    {
+      for (ulong index = 0; index < capacity; index++)
+      {
+        if (other.distances[index] != 0)
+        {
+          new (slots + index) Data(other.slots[index]);
+          distances[index] = other.distances[index];
+        }
+      }
+    }
+    catch (...)
+    {
+      Release(); // Destroy the copies made so far
+      throw;
+    }
+    size = other.size;
+  }
+
+  // Move constructor
+  template <typename Data, typename Hash>
+  HashSet<Data, Hash>::HashSet(HashSet<Data, Hash> &&other) noexcept
+  {
+    std::swap(slots, other.slots);
+    std::swap(distances, other.distances);
+    std::swap(capacity, other.capacity);
+    std::swap(shift, other.shift);
+    std::swap(limit, other.limit);
+    std::swap(maxLoad, other.maxLoad);
+    std::swap(hasher, other.hasher);
+    std::swap(size, other.size);
+  }
+
+  // Destructor
+  template <typename Data, typename Hash>
+  HashSet<Data, Hash>::~HashSet()
+  {
+    Release();
+  }
+
+  // Copy assignment
+  template <typename Data, typename Hash>
+  HashSet<Data, Hash> &HashSet<Data, Hash>::operator=(const HashSet<Data, Hash> &other)
+  {
+    if (this != &other)
+    {
+      HashSet<Data, Hash> copy(other);
+      *this = std::move(copy); // The old slots leave with copy
+    }
+    return *this;
+  }
+
+  // Move assignment
+  template <typename Data, typename Hash>
+  HashSet<Data, Hash> &HashSet<Data, Hash>::operator=(HashSet<Data, Hash> &&other) noexcept
+  {
+    if (this != &other)
+    {
+      std::swap(slots, other.slots);
+      std::swap(distances, other.distances);
+      std::swap(capacity, other.capacity);
+      std::swap(shift, other.shift);
+      std::swap(limit, other.limit);
+      std::swap(maxLoad, other.maxLoad);
+      std::swap(hasher, other.hasher);
+      std::swap(size, other.size);
+    }
+    return *this;
+  }
+
+  // Comparison operators
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::operator==(const HashSet<Data, Hash> &other) const noexcept
+  {
+    if (size != other.size)
+    {
+      return false; // Sets of different sizes cannot be equal
+    }
+
+    // Same size: equal when every element of one is in the other
+    for (ulong index = 0; index < capacity; index++)
+    {
+      if (distances[index] != 0 && !other.Exists(slots[index]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::operator!=(const HashSet<Data, Hash> &other) const noexcept
+  {
+    return !(*this == other); // Use equality operator for inverse check
+  }
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::Insert(const Data &data)
+  {
+    return InsertValue(data);
+  }
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::Insert(Data &&data)
+  {
+    return InsertValue(std::move(data));
+  }
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::Remove(const Data &data)
+  {
+    ulong index = Find(data);
+    if (index == capacity)
+    {
+      return false; // Not in the set
+    }
+
+    // Backward shift: the run after the slot moves back one place, every
+    // element getting one step closer to home, until an empty slot or an
+    // element already at home
+    const ulong mask = capacity - 1;
+    ulong next = (index + 1) & mask;
+    while (distances[next] > 1)
+    {
+      slots[index] = std::move(slots[next]);
+      distances[index] = distances[next] - 1;
+      index = next;
+      next = (next + 1) & mask;
+    }
+    std::destroy_at(slots + index);
+    distances[index] = 0;
+    size--;
+    return true;
+  }
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::InsertAll(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    Reserve(size + batch.Size());
+    return InsertStaged(batch) == batch.Size();
+  }
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::InsertAll(MappableContainer<Data> &&container)
+  {
+    Vector<Data> batch(std::move(container));
+    Reserve(size + batch.Size());
+    return InsertStaged(batch) == batch.Size();
+  }
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::RemoveAll(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container); // Backward shifts would upset a walk over the set itself
+    return RemoveStaged(batch) == batch.Size();
+  }
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::InsertSome(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    Reserve(size + batch.Size());
+    return InsertStaged(batch) > 0;
+  }
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::InsertSome(MappableContainer<Data> &&container)
+  {
+    Vector<Data> batch(std::move(container));
+    Reserve(size + batch.Size());
+    return InsertStaged(batch) > 0;
+  }
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::RemoveSome(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return RemoveStaged(batch) > 0;
+  }
+
+  // Specific member functions (inherited from TestableContainer)
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::Exists(const Data &data) const noexcept
+  {
+    return Find(data) != capacity;
+  }
+
+  // Specific member function (inherited from TraversableContainer)
+
+  template <typename Data, typename Hash>
+  void HashSet<Data, Hash>::Traverse(TraverseFun fun) const
+  {
+    for (ulong index = 0; index < capacity; index++)
+    {
+      if (distances[index] != 0)
+      {
+        fun(slots[index]);
+      }
+    }
+  }
+
+  template <typename Data, typename Hash>
+  bool HashSet<Data, Hash>::TraverseWhile(TraverseWhileFun fun) const
+  {
+    for (ulong index = 0; index < capacity; index++)
+    {
+      if (distances[index] != 0 && !fun(slots[index]))
+      {
+        return false; // Stop at the first element the function rejects
+      }
+    }
+    return true;
+  }
+
+  // Template fast paths
+
+  template <typename Data, typename Hash>
+  template <typename Fun>
+  void HashSet<Data, Hash>::ForEach(Fun &&fun) const
+  {
+    for (ulong index = 0; index < capacity; index++)
+    {
+      if (distances[index] != 0)
+      {
+        fun(slots[index]);
+      }
+    }
+  }
+
+  template <typename Data, typename Hash>
+  template <typename Accumulator, typename Fun>
+  Accumulator HashSet<Data, Hash>::Reduce(Fun &&fun, Accumulator accumulator) const
+  {
+    for (ulong index = 0; index < capacity; index++)
+    {
+      if (distances[index] != 0)
+      {
+        accumulator = fun(slots[index], accumulator);
+      }
+    }
+    return accumulator;
+  }
+
+  // Specific member functions (capacity and load factor)
+
+  template <typename Data, typename Hash>
+  void HashSet<Data, Hash>::Reserve(const ulong count)
+  {
+    const ulong target = CapacityFor(count);
+    if (target > capacity)
+    {
+      Rehash(target);
+    }
+  }
+
+  template <typename Data, typename Hash>
+  ulong HashSet<Data, Hash>::Capacity() const noexcept
+  {
+    return capacity;
+  }
+
+  template <typename Data, typename Hash>
+  double HashSet<Data, Hash>::LoadFactor() const noexcept
+  {
+    return (capacity == 0) ? 0.0 : static_cast<double>(size) / capacity;
+  }
+
+  template <typename Data, typename Hash>
+  double HashSet<Data, Hash>::MaxLoadFactor() const noexcept
+  {
+    return maxLoad;
+  }
+
+  template <typename Data, typename Hash>
+  void HashSet<Data, Hash>::MaxLoadFactor(double load)
+  {
+    if (!(load >= 0.25 && load <= 0.95))
+    {
+      throw std::invalid_argument("HashSet: Load factor out of range");
+    }
+
+    maxLoad = load;
+    limit = static_cast<ulong>(maxLoad * capacity);
+    if (size > limit)
+    {
+      Rehash(CapacityFor(size)); // Lowered below the current load
+    }
+  }
+
+  // Specific member functions (read-only forward iterators)
+
+  template <typename Data, typename Hash>
+  typename HashSet<Data, Hash>::ConstIterator HashSet<Data, Hash>::begin() const noexcept
+  {
+    ulong index = 0;
+    while (index < capacity && distances[index] == 0)
+    {
+      index++;
+    }
+    return ConstIterator(index, this);
+  }
+
+  template <typename Data, typename Hash>
+  typename HashSet<Data, Hash>::ConstIterator HashSet<Data, Hash>::end() const noexcept
+  {
+    return ConstIterator(capacity, this);
+  }
+
+  template <typename Data, typename Hash>
+  typename HashSet<Data, Hash>::ConstIterator HashSet<Data, Hash>::cbegin() const noexcept
+  {
+    return begin();
+  }
+
+  template <typename Data, typename Hash>
+  typename HashSet<Data, Hash>::ConstIterator HashSet<Data, Hash>::cend() const noexcept
+  {
+    return end();
+  }
+
+  // Specific member function (inherited from ClearableContainer)
+
+  template <typename Data, typename Hash>
+  void HashSet<Data, Hash>::Clear()
+  {
+    Release();
+    size = 0;
+  }
+
+  /* ************************************************************************** */
+
+  // Auxiliary functions
+
+  template <typename Data, typename Hash>
+  ulong HashSet<Data, Hash>::Home(const Data &data) const noexcept
+  {
+    // Multiply by 2^64 / golden ratio and keep the top bits: every input bit
+    // reaches them, so weak hashes (identity, multiples of a power of two) spread
+    return (static_cast<ulong>(hasher(data)) * 0x9E3779B97F4A7C15UL) >> shift;
+  }
+
+  template <typename Data, typename Hash>
+  ulong HashSet<Data, Hash>::Find(const Data &data) const noexcept
+  {
+    if (size == 0)
+    {
+      return capacity;
+    }
+
+    // An element is never further from home than the richer ones around it:
+    // the probe stops at the first slot closer to its home than the probe is
+    const ulong mask = capacity - 1;
+    ulong index = Home(data);
+    unsigned char distance = 1;
+    while (distances[index] >= distance)
+    {
+      if (distances[index] == distance && slots[index] == data)
+      {
+        return index;
+      }
+      index = (index + 1) & mask;
+      distance++;
+    }
+    return capacity;
+  }
+
+  template <typename Data, typename Hash>
+  template <typename Value>
+  bool HashSet<Data, Hash>::InsertValue(Value &&value)
+  {
+    if (size >= limit)
+    {
+      Rehash(CapacityFor(size + 1));
+    }
+
+    const ulong mask = capacity - 1;
+    ulong index = Home(value);
+    unsigned char distance = 1;
+    while (distances[index] >= distance)
+    {
+      if (distances[index] == distance && slots[index] == value)
+      {
+        return false; // Element already exists
+      }
+      index = (index + 1) & mask;
+      if (++distance == MaxDistance)
+      {
+        // A run this long only comes from a hash that sends many values to
+        // the same slots: growing spreads them unless they share the hash
+        if (capacity >= 16 * CapacityFor(size + 1))
+        {
+          throw std::length_error("HashSet: Too many colliding hashes");
+        }
+        Rehash(2 * capacity);
+        return InsertValue(std::forward<Value>(value));
+      }
+    }
+
+    Place(index, distance, Data(std::forward<Value>(value)));
+    size++;
+    return true;
+  }
+
+  template <typename Data, typename Hash>
+  void HashSet<Data, Hash>::Place(ulong index, unsigned char distance, Data &&carry)
+  {
+    // Take the slot of the first element closer to its home than the carried
+    // one, carry that element on in its place, until an empty slot
+    const ulong mask = capacity - 1;
+    while (distances[index] != 0)
+    {
+      if (distances[index] < distance)
+      {
+        std::swap(carry, slots[index]);
+        std::swap(distance, distances[index]);
+      }
+      index = (index + 1) & mask;
+      if (++distance == MaxDistance)
+      {
+        Rehash(2 * capacity); // The carried element is outside the table: placed again in the larger one
+        Place(Home(carry), 1, std::move(carry));
+        return;
+      }
+    }
+
+    new (slots + index) Data(std::move(carry));
+    distances[index] = distance;
+  }
+
+  template <typename Data, typename Hash>
+  void HashSet<Data, Hash>::Rehash(ulong target)
+  {
+    Data *oldSlots = slots;
+    unsigned char *oldDistances = distances;
+    const ulong oldCapacity = capacity;
+
+    Allocate(target);
+    for (ulong index = 0; index < oldCapacity; index++)
+    {
+      if (oldDistances[index] != 0)
+      {
+        Place(Home(oldSlots[index]), 1, std::move(oldSlots[index])); // Elements are distinct: no equality test
+        std::destroy_at(oldSlots + index);
+      }
+    }
+
+    ::operator delete(oldSlots, std::align_val_t(alignof(Data)));
+    delete[] oldDistances;
+  }
+
+  template <typename Data, typename Hash>
+  ulong HashSet<Data, Hash>::CapacityFor(ulong count) const noexcept
+  {
+    ulong target = MinCapacity;
+    while (static_cast<ulong>(maxLoad * target) < count)
+    {
+      target *= 2;
+    }
+    return target;
+  }
+
+  template <typename Data, typename Hash>
+  void HashSet<Data, Hash>::Allocate(ulong target)
+  {
+    unsigned char *fresh = new unsigned char[target](); // All empty
+    try
+    {
+      slots = static_cast<Data *>(::operator new(target * sizeof(Data), std::align_val_t(alignof(Data))));
+    }
+    catch (...)
+    {
+      delete[] fresh; // The members still describe the previous slots
+      throw;
+    }
+    distances = fresh;
+    capacity = target;
+    shift = 64 - std::countr_zero(target);
+    limit = static_cast<ulong>(maxLoad * target);
+  }
+
+  template <typename Data, typename Hash>
+  void HashSet<Data, Hash>::Release() noexcept
+  {
+    for (ulong index = 0; index < capacity; index++)
+    {
+      if (distances[index] != 0)
+      {
+        std::destroy_at(slots + index);
+      }
+    }
+    ::operator delete(slots, std::align_val_t(alignof(Data)));
+    delete[] distances;
+
+    slots = nullptr;
+    distances = nullptr;
+    capacity = 0;
+    shift = 64;
+    limit = 0;
+  }
+
+  template <typename Data, typename Hash>
+  ulong HashSet<Data, Hash>::InsertStaged(Vector<Data> &batch)
+  {
+    ulong added = 0;
+    for (Data *current = batch.begin(); current != batch.end(); ++current)
+    {
+      added += InsertValue(std::move(*current)); // Moved only when stored
+    }
+    return added;
+  }
+
+  template <typename Data, typename Hash>
+  ulong HashSet<Data, Hash>::RemoveStaged(Vector<Data> &batch)
+  {
+    ulong removed = 0;
+    for (const Data *current = batch.begin(); current != batch.end(); ++current)
+    {
+      removed += Remove(*current);
+    }
+    return removed;
+  }
+
+  /* ************************************************************************** */
+
+}
@@ -0,0 +1,261 @@
+#ifndef HASHSET_HPP
+#define HASHSET_HPP
+
+/* ************************************************************************** */
+
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <new>
+
+#include "../container/dictionary.hpp"
+#include "../container/traversable.hpp"
+#include "../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Default hash: std::hash (the table scrambles the bits itself, so an
+  // identity hash on integers is fine)
+  template <typename Data>
+  struct Hashable
+  {
+    ulong operator()(const Data &data) const noexcept { return std::hash<Data>()(data); }
+  };
+
+  /* ************************************************************************** */
+
+  template <typename Data, typename Hash = Hashable<Data>>
+  class HashSet : virtual public DictionaryContainer<Data>,
+                  virtual public TraversableContainer<Data>,
+                  virtual public ClearableContainer
+  {
+    // Must extend DictionaryContainer<Data>, TraversableContainer<Data> and ClearableContainer
+
+    // Unordered set on open addressing with Robin Hood probing: one flat array
+    // of slots, a power of two long, and one byte per slot with the distance
+    // from the home slot (0 for empty). An insert takes the slot of any element
+    // closer to its home and carries that one on; a search stops as soon as it
+    // meets an element closer to home than the probe; a removal shifts the
+    // following run back one slot, so there are no tombstones.
+    // Expected O(1) per operation; traversal order is unspecified.
+
+  private:
+    // ...
+
+  protected:
+    using Container::size;
+
+    static constexpr unsigned char MaxDistance = 255; // Distances stop here: a longer probe grows the table
+    static constexpr ulong MinCapacity = 8;
+
+    Data *slots = nullptr;                // Raw storage, constructed where the distance is not 0
+    unsigned char *distances = nullptr;   // 1 + distance from the home slot, 0 for empty
+    ulong capacity = 0;                   // Number of slots: 0 or a power of two
+    ulong shift = 64;                     // 64 - log2(capacity): the home is the top bits of the scrambled hash
+    ulong limit = 0;                      // Largest size allowed by the load factor
+    double maxLoad = 0.8;                 // Maximum load factor
+    Hash hasher;
+
+    class SlotIterator;
+
+  public:
+    // Default constructor
+    HashSet() = default;
+
+    /* ************************************************************************ */
+
+    // Specific constructors
+    explicit HashSet(const Hash &);                // An empty set with a given hash function
+    HashSet(const TraversableContainer<Data> &);  // A set obtained from a TraversableContainer
+    HashSet(MappableContainer<Data> &&) noexcept; // A set obtained from a MappableContainer
+
+    /* ************************************************************************ */
+
+    // Copy constructor
+    HashSet(const HashSet &);
+
+    // Move constructor
+    HashSet(HashSet &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Destructor
+    virtual ~HashSet();
+
+    /* ************************************************************************ */
+
+    // Copy assignment
+    HashSet &operator=(const HashSet &);
+
+    // Move assignment
+    HashSet &operator=(HashSet &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Comparison operators (same elements, whatever the capacity or the order)
+    bool operator==(const HashSet &) const noexcept;
+    bool operator!=(const HashSet &) const noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from DictionaryContainer)
+
+    bool Insert(const Data &) override; // Add an element if not already present (copy)
+    bool Insert(Data &&) override;      // Add an element if not already present (move)
+    bool Remove(const Data &) override; // Remove an element if present
+
+    // Batched operations: the batch is staged first, so it may be the set itself;
+    // inserts reserve room for the whole batch before the first one
+
+    bool InsertAll(const TraversableContainer<Data> &) override; // True if every element was inserted (copy)
+    bool InsertAll(MappableContainer<Data> &&) override;         // True if every element was inserted (move)
+    bool RemoveAll(const TraversableContainer<Data> &) override; // True if every element was removed
+
+    bool InsertSome(const TraversableContainer<Data> &) override; // True if some element was inserted (copy)
+    bool InsertSome(MappableContainer<Data> &&) override;         // True if some element was inserted (move)
+    bool RemoveSome(const TraversableContainer<Data> &) override; // True if some element was removed
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from TestableContainer)
+
+    bool Exists(const Data &) const noexcept override; // Check if an element exists in the set
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from TraversableContainer)
+
+    using typename TraversableContainer<Data>::TraverseFun;
+
+    void Traverse(TraverseFun) const override; // Apply function to all elements, in slot order
+
+    using typename TraversableContainer<Data>::TraverseWhileFun;
+
+    bool TraverseWhile(TraverseWhileFun) const override; // Walk the slots until the function returns false
+
+    /* ************************************************************************ */
+
+    // Specific member functions (template fast paths, hiding the type-erased ones)
+
+    template <typename Fun>
+    void ForEach(Fun &&) const; // Apply callable to each element, slot order
+
+    template <typename Accumulator, typename Fun>
+    Accumulator Reduce(Fun &&, Accumulator) const; // Fold with any callable, slot order
+
+    /* ************************************************************************ */
+
+    // Specific member functions (capacity and load factor)
+
+    void Reserve(const ulong); // Room for at least the given number of elements without growing
+
+    ulong Capacity() const noexcept;    // Number of slots
+    double LoadFactor() const noexcept; // Size over capacity (0 when there are no slots)
+
+    double MaxLoadFactor() const noexcept; // Load factor above which the table grows
+    void MaxLoadFactor(double);            // Set it, growing if needed (must throw std::invalid_argument outside [0.25, 0.95])
+
+    /* ************************************************************************ */
+
+    // Specific member functions (read-only forward iterators, slot order)
+
+    using ConstIterator = SlotIterator;
+
+    ConstIterator begin() const noexcept; // First occupied slot
+    ConstIterator end() const noexcept;   // Past the last slot
+
+    ConstIterator cbegin() const noexcept;
+    ConstIterator cend() const noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from ClearableContainer)
+
+    void Clear() override; // Remove all elements and release the slots
+
+  protected:
+    // Auxiliary functions
+
+    ulong Home(const Data &) const noexcept; // Home slot: Fibonacci hashing of the hash
+    ulong Find(const Data &) const noexcept; // Slot holding the value (capacity when absent)
+
+    template <typename Value>
+    bool InsertValue(Value &&);
+
+    void Place(ulong, unsigned char, Data &&); // Store an absent value from a probe position, displacing richer elements
+    void Rehash(ulong);                        // Move every element into a table of the given capacity
+    ulong CapacityFor(ulong) const noexcept;   // Smallest capacity holding the given size under the load factor
+
+    void Allocate(ulong);    // Empty slots of the given capacity (the previous ones must be released or saved)
+    void Release() noexcept; // Destroy the elements and free the slots
+
+    // Batched operations on a staged copy of the batch
+    ulong InsertStaged(Vector<Data> &); // Returns how many were new
+    ulong RemoveStaged(Vector<Data> &); // Returns how many were present
+
+    /* ************************************************************************ */
+
+    class SlotIterator
+    {
+      // Forward iterator over the occupied slots; end() is the slot count
+
+      friend class HashSet;
+
+    public:
+      using iterator_concept = std::forward_iterator_tag;
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = Data;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const Data *;
+      using reference = const Data &;
+
+      /* ********************************************************************** */
+
+      // Default constructor
+      SlotIterator() = default;
+
+      /* ********************************************************************** */
+
+      // Specific member functions
+
+      reference operator*() const noexcept { return owner->slots[slot]; }
+      pointer operator->() const noexcept { return owner->slots + slot; }
+
+      SlotIterator &operator++() noexcept
+      {
+        do
+        {
+          slot++;
+        } while (slot < owner->capacity && owner->distances[slot] == 0);
+        return *this;
+      }
+
+      SlotIterator operator++(int) noexcept
+      {
+        SlotIterator previous = *this;
+        ++*this;
+        return previous;
+      }
+
+      bool operator==(const SlotIterator &other) const noexcept { return slot == other.slot; }
+
+    private:
+      SlotIterator(ulong position, const HashSet *set) noexcept : slot(position), owner(set) {}
+
+      ulong slot = 0;                 // Occupied slot under the iterator (capacity past the end)
+      const HashSet *owner = nullptr; // Set walked
+    };
+  };
+
+  /* ************************************************************************** */
+
+}
+
+#include "hashset.cpp" // Include implementation file
+
+#endif
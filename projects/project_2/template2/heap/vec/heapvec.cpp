@@ -3,20 +3,24 @@ namespace lasd
 
   /* ************************************************************************** */
 
+  // Specific constructor with a comparator
+  template <typename Data, ulong Arity, typename Compare>
+  HeapVec<Data, Arity, Compare>::HeapVec(const Compare &order) : compare(order) {}
+
   // Specific constructor with initial size
-  template <typename Data>
-  HeapVec<Data>::HeapVec(const ulong newsize) : Vector<Data>(newsize) {}
+  template <typename Data, ulong Arity, typename Compare>
+  HeapVec<Data, Arity, Compare>::HeapVec(const ulong newsize, const Compare &order) : Vector<Data>(newsize), compare(order) {}
 
   // Specific constructor from TraversableContainer
-  template <typename Data>
-  HeapVec<Data>::HeapVec(const TraversableContainer<Data> &con) : Vector<Data>(con)
+  template <typename Data, ulong Arity, typename Compare>
+  HeapVec<Data, Arity, Compare>::HeapVec(const TraversableContainer<Data> &con, const Compare &order) : Vector<Data>(con), compare(order)
   {
     Heapify();
   }
 
   // Specific constructor from MappableContainer (move)
-  template <typename Data>
-  HeapVec<Data>::HeapVec(MappableContainer<Data> &&con) noexcept : Vector<Data>(std::move(con))
+  template <typename Data, ulong Arity, typename Compare>
+  HeapVec<Data, Arity, Compare>::HeapVec(MappableContainer<Data> &&con, const Compare &order) : Vector<Data>(std::move(con)), compare(order)
   {
     Heapify();
   }
@@ -24,42 +28,44 @@ namespace lasd
   /* ************************************************************************** */
 
   // Copy constructor
-  template <typename Data>
-  HeapVec<Data>::HeapVec(const HeapVec<Data> &heap) : Vector<Data>(heap) {}
+  template <typename Data, ulong Arity, typename Compare>
+  HeapVec<Data, Arity, Compare>::HeapVec(const HeapVec<Data, Arity, Compare> &heap) : Vector<Data>(heap), compare(heap.compare) {}
 
   // Move constructor
-  template <typename Data>
-  HeapVec<Data>::HeapVec(HeapVec<Data> &&heap) noexcept : Vector<Data>(std::move(heap)) {}
+  template <typename Data, ulong Arity, typename Compare>
+  HeapVec<Data, Arity, Compare>::HeapVec(HeapVec<Data, Arity, Compare> &&heap) noexcept : Vector<Data>(std::move(heap)), compare(heap.compare) {}
 
   /* ************************************************************************** */
 
   // Copy assignment
-  template <typename Data>
-  HeapVec<Data> &HeapVec<Data>::operator=(const HeapVec<Data> &heap)
+  template <typename Data, ulong Arity, typename Compare>
+  HeapVec<Data, Arity, Compare> &HeapVec<Data, Arity, Compare>::operator=(const HeapVec<Data, Arity, Compare> &heap)
   {
     Vector<Data>::operator=(heap);
+    compare = heap.compare;
     return *this;
   }
 
   // Move assignment
-  template <typename Data>
-  HeapVec<Data> &HeapVec<Data>::operator=(HeapVec<Data> &&heap) noexcept
+  template <typename Data, ulong Arity, typename Compare>
+  HeapVec<Data, Arity, Compare> &HeapVec<Data, Arity, Compare>::operator=(HeapVec<Data, Arity, Compare> &&heap) noexcept
   {
     Vector<Data>::operator=(std::move(heap));
+    compare = heap.compare; // Copied: the other heap stays usable
     return *this;
   }
 
   /* ************************************************************************** */
 
   // Comparison operators
-  template <typename Data>
-  bool HeapVec<Data>::operator==(const HeapVec<Data> &heap) const noexcept
+  template <typename Data, ulong Arity, typename Compare>
+  bool HeapVec<Data, Arity, Compare>::operator==(const HeapVec<Data, Arity, Compare> &heap) const noexcept
   {
     return Vector<Data>::operator==(heap);
   }
 
-  template <typename Data>
-  bool HeapVec<Data>::operator!=(const HeapVec<Data> &heap) const noexcept
+  template <typename Data, ulong Arity, typename Compare>
+  bool HeapVec<Data, Arity, Compare>::operator!=(const HeapVec<Data, Arity, Compare> &heap) const noexcept
   {
     return !(*this == heap);
   }
@@ -68,8 +74,8 @@ namespace lasd
 
   // Specific member function (inherited from ClearableContainer)
 
-  template <typename Data>
-  void HeapVec<Data>::Clear()
+  template <typename Data, ulong Arity, typename Compare>
+  void HeapVec<Data, Arity, Compare>::Clear()
   {
     Vector<Data>::Clear();
   }
@@ -79,22 +85,13 @@ namespace lasd
   // Specific member functions (inherited from Heap)
 
   // Check if the current structure maintains heap property
-  template <typename Data>
-  bool HeapVec<Data>::IsHeap() const noexcept
+  template <typename Data, ulong Arity, typename Compare>
+  bool HeapVec<Data, Arity, Compare>::IsHeap() const noexcept
   {
-    for (ulong i = 0; i < size; ++i)
+    // Every element but the root must not be greater than its parent
+    for (ulong i = 1; i < size; ++i)
     {
-      ulong left = LeftChild(i);
-      ulong right = RightChild(i);
-
-      // Check left child
-      if (left < size && elements[i] < elements[left])
-      {
-        return false;
-      }
-
-      // Check right child
-      if (right < size && elements[i] < elements[right])
+      if (compare(elements[Parent(i)], elements[i]))
       {
         return false;
       }
@@ -103,13 +100,13 @@ namespace lasd
   }
 
   // Transform the current structure into a valid heap
-  template <typename Data>
-  void HeapVec<Data>::Heapify()
+  template <typename Data, ulong Arity, typename Compare>
+  void HeapVec<Data, Arity, Compare>::Heapify()
   {
     // Start from the last non-leaf node and heapify down
     if (size > 1)
     {
-      for (ulong i = (size / 2); i > 0; --i)
+      for (ulong i = Parent(size - 1) + 1; i > 0; --i)
       {
         HeapifyDown(i - 1);
       }
@@ -120,9 +117,9 @@ namespace lasd
 
   // Specific member function (inherited from SortableLinearContainer)
 
-  // Sort using heap sort algorithm
-  template <typename Data>
-  void HeapVec<Data>::Sort()
+  // Sort using heap sort algorithm (ascending by Compare)
+  template <typename Data, ulong Arity, typename Compare>
+  void HeapVec<Data, Arity, Compare>::Sort()
   {
     // First ensure we have a valid heap
     Heapify();
@@ -130,89 +127,146 @@ namespace lasd
     // Extract elements one by one from heap
     for (ulong currentHeapSize = size; currentHeapSize > 1; --currentHeapSize)
     {
-      // Move current root to end
-      std::swap(elements[0], elements[currentHeapSize - 1]);
+      // Move current root to end, lifting the last element out of the way
+      Data last = std::move(elements[currentHeapSize - 1]);
+      elements[currentHeapSize - 1] = std::move(elements[0]);
 
-      // Restore heap property using existing HeapifyDown function
-      HeapifyDown(0, currentHeapSize - 1);
+      // The root is now a hole: refill it bottom-up
+      SiftRootBottomUp(std::move(last), currentHeapSize - 1);
     }
   }
 
+  // The ordering of the heap and of the sorts
+  template <typename Data, ulong Arity, typename Compare>
+  Compare HeapVec<Data, Arity, Compare>::Comparator() const
+  {
+    return compare;
+  }
+
+  // Sort using the parallel merge sort (same ascending result as Sort)
+  template <typename Data, ulong Arity, typename Compare>
+  void HeapVec<Data, Arity, Compare>::ParallelSort(const ulong threads, const ulong threshold)
+  {
+    lasd::ParallelSort(elements, elements + size, threads, compare, threshold);
+  }
+
   /* ************************************************************************** */
 
   // Auxiliary functions
 
   // Maintain heap property downward from given index
-  template <typename Data>
-  void HeapVec<Data>::HeapifyDown(ulong index)
+  template <typename Data, ulong Arity, typename Compare>
+  void HeapVec<Data, Arity, Compare>::HeapifyDown(ulong index)
   {
     // Delegate to the version with explicit size parameter
     HeapifyDown(index, size);
   }
 
   // Maintain heap property downward from given index with custom heap size
-  template <typename Data>
-  void HeapVec<Data>::HeapifyDown(ulong index, ulong heapSize)
+  template <typename Data, ulong Arity, typename Compare>
+  void HeapVec<Data, Arity, Compare>::HeapifyDown(ulong index, ulong heapSize)
   {
-    ulong largest = index;
-    ulong left = LeftChild(index);
-    ulong right = RightChild(index);
-
-    // Find largest among index, left child and right child
-    if (left < heapSize && elements[left] > elements[largest])
+    ulong first = FirstChild(index);
+    if (first >= heapSize)
     {
-      largest = left;
+      return;
     }
-
-    if (right < heapSize && elements[right] > elements[largest])
+    ulong largest = LargestChild(first, heapSize);
+    if (!compare(elements[index], elements[largest]))
     {
-      largest = right;
+      return; // Already in place: nothing moves
     }
 
-    // If largest is not the current index, swap and continue heapifying
-    if (largest != index)
+    // Lift the element out once and move larger children up into the hole
+    Data value = std::move(elements[index]);
+    do
     {
-      std::swap(elements[index], elements[largest]);
-      HeapifyDown(largest, heapSize);
-    }
+      elements[index] = std::move(elements[largest]);
+      index = largest;
+      first = FirstChild(index);
+      if (first >= heapSize)
+      {
+        break;
+      }
+      largest = LargestChild(first, heapSize);
+    } while (compare(value, elements[largest]));
+    elements[index] = std::move(value);
   }
 
   // Maintain heap property upward from given index
-  template <typename Data>
-  void HeapVec<Data>::HeapifyUp(ulong index)
+  template <typename Data, ulong Arity, typename Compare>
+  void HeapVec<Data, Arity, Compare>::HeapifyUp(ulong index)
   {
-    if (index > 0)
+    if (index == 0 || !compare(elements[Parent(index)], elements[index]))
     {
-      ulong parent = Parent(index);
+      return; // Already in place: nothing moves
+    }
 
-      // If current element is greater than parent, swap and continue
-      if (elements[index] > elements[parent])
+    // Lift the element out once and move smaller parents down into the hole
+    Data value = std::move(elements[index]);
+    do
+    {
+      elements[index] = std::move(elements[Parent(index)]);
+      index = Parent(index);
+    } while (index > 0 && compare(elements[Parent(index)], value));
+    elements[index] = std::move(value);
+  }
+
+  // Fill the hole at the root with the given value (Floyd): the hole first
+  // sinks along the largest children down to a leaf, comparing children only,
+  // then the value rises from there. The value usually belongs near the
+  // bottom, so this takes about half the comparisons of HeapifyDown.
+  template <typename Data, ulong Arity, typename Compare>
+  void HeapVec<Data, Arity, Compare>::SiftRootBottomUp(Data &&value, ulong heapSize)
+  {
+    ulong hole = 0;
+    for (ulong first = FirstChild(hole); first < heapSize; first = FirstChild(hole))
+    {
+      ulong largest = LargestChild(first, heapSize);
+      elements[hole] = std::move(elements[largest]);
+      hole = largest;
+    }
+    while (hole > 0)
+    {
+      ulong parent = Parent(hole);
+      if (!compare(elements[parent], value))
       {
-        std::swap(elements[index], elements[parent]);
-        HeapifyUp(parent);
+        break;
       }
+      elements[hole] = std::move(elements[parent]);
+      hole = parent;
     }
+    elements[hole] = std::move(value);
   }
 
-  // Get left child index
-  template <typename Data>
-  ulong HeapVec<Data>::LeftChild(ulong index) const noexcept
+  // Get the largest of the children starting at first (which must be inside the heap)
+  template <typename Data, ulong Arity, typename Compare>
+  ulong HeapVec<Data, Arity, Compare>::LargestChild(ulong first, ulong heapSize) const noexcept
   {
-    return (2 * index) + 1;
+    ulong last = (first + Arity < heapSize) ? first + Arity : heapSize; // Past the last child inside the heap
+    ulong largest = first;
+    for (ulong child = first + 1; child < last; ++child)
+    {
+      if (compare(elements[largest], elements[child]))
+      {
+        largest = child;
+      }
+    }
+    return largest;
   }
 
-  // Get right child index
-  template <typename Data>
-  ulong HeapVec<Data>::RightChild(ulong index) const noexcept
+  // Get the index of the first child
+  template <typename Data, ulong Arity, typename Compare>
+  ulong HeapVec<Data, Arity, Compare>::FirstChild(ulong index) const noexcept
   {
-    return (2 * index) + 2;
+    return (Arity * index) + 1;
   }
 
   // Get parent index
-  template <typename Data>
-  ulong HeapVec<Data>::Parent(ulong index) const noexcept
+  template <typename Data, ulong Arity, typename Compare>
+  ulong HeapVec<Data, Arity, Compare>::Parent(ulong index) const noexcept
   {
-    return (index - 1) / 2;
+    return (index - 1) / Arity;
   }
 
   /* ************************************************************************** */
@@ -13,13 +13,21 @@ namespace lasd
 
   /* ************************************************************************** */
 
-  template <typename Data>
+  template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
   class HeapVec : virtual public Heap<Data>,
                   virtual public Vector<Data>
   {
     // Must extend Heap<Data>,
     // Could extend Vector<Data>
 
+    // Max-heap by Compare (the tip comes last in Compare order: std::greater
+    // makes a min-heap) with Arity children per node, stored level by level: the
+    // children of i are Arity * i + 1, ..., Arity * i + Arity. A wider node
+    // makes the heap shallower (fewer levels for HeapifyUp) and keeps every
+    // child HeapifyDown compares side by side, one cache line for small Data.
+
+    static_assert(Arity >= 2, "HeapVec: Arity must be at least 2");
+
   private:
     // ...
 
@@ -27,7 +35,7 @@ namespace lasd
     using Container::size;
     using Vector<Data>::elements;
 
-    // ...
+    [[no_unique_address]] Compare compare = Compare(); // Takes no space when stateless
 
   public:
     // Default constructor
@@ -36,9 +44,10 @@ namespace lasd
     /* ************************************************************************ */
 
     // Specific constructors
-    HeapVec(const ulong);                         // A heap obtained from a TraversableContainer
-    HeapVec(const TraversableContainer<Data> &);  // A heap obtained from a TraversableContainer
-    HeapVec(MappableContainer<Data> &&) noexcept; // A heap obtained from a MappableContainer
+    explicit HeapVec(const Compare &);                                        // An empty heap ordered by the given comparator
+    HeapVec(const ulong, const Compare & = Compare());                        // A heap of default-constructed elements
+    HeapVec(const TraversableContainer<Data> &, const Compare & = Compare()); // A heap obtained from a TraversableContainer
+    HeapVec(MappableContainer<Data> &&, const Compare & = Compare());         // A heap obtained from a MappableContainer
 
     /* ************************************************************************ */
 
@@ -85,17 +94,31 @@ namespace lasd
 
     // Specific member function (inherited from SortableLinearContainer)
 
-    void Sort() override; // Override SortableLinearContainer member
+    void Sort() override; // Override SortableLinearContainer member (ascending by Compare)
+
+    /* ************************************************************************ */
+
+    // Specific member functions
+
+    Compare Comparator() const; // The ordering of the heap and of the sorts
+
+    void ParallelSort(const ulong, const ulong = ParallelSortThreshold); // Sort on the given number of threads (0 = all), sequential below the threshold
 
   protected:
     // Auxiliary functions, if necessary!
 
+    // Sifting moves the element out once and shifts the others through the
+    // hole, one move per level instead of the three of a swap
+
     void HeapifyDown(ulong);        // Helper function for maintaining heap property downward
     void HeapifyDown(ulong, ulong); // Helper function for maintaining heap property downward with custom size
     void HeapifyUp(ulong);          // Helper function for maintaining heap property upward
 
-    ulong LeftChild(ulong) const noexcept;  // Get left child index
-    ulong RightChild(ulong) const noexcept; // Get right child index
+    void SiftRootBottomUp(Data &&, ulong); // Fill the hole at the root with the value, for the given heap size (Floyd bottom-up)
+
+    ulong LargestChild(ulong, ulong) const noexcept; // Largest of the children from the given first one, for the given heap size
+
+    ulong FirstChild(ulong) const noexcept; // Get the index of the first of the Arity children
     ulong Parent(ulong) const noexcept;     // Get parent index
   };
 
@@ -1,4 +1,5 @@
 #include <stdexcept>
+#include <type_traits>
 
 namespace lasd
 {
@@ -7,8 +8,8 @@ namespace lasd
 
   // Specific constructors
 
-  template <typename Data>
-  List<Data>::List(const TraversableContainer<Data> &container)
+  template <typename Data, template <typename> class Allocator>
+  List<Data, Allocator>::List(const TraversableContainer<Data> &container)
   {
     container.Traverse([this](const Data &data)
                        {
@@ -16,8 +17,8 @@ namespace lasd
                        });
   }
 
-  template <typename Data>
-  List<Data>::List(MappableContainer<Data> &&container) noexcept
+  template <typename Data, template <typename> class Allocator>
+  List<Data, Allocator>::List(MappableContainer<Data> &&container) noexcept
   {
     container.Map([this](Data &data)
                   {
@@ -26,48 +27,36 @@ namespace lasd
   }
 
   // Copy constructor
-  template <typename Data>
-  List<Data>::List(const List<Data> &other)
+  template <typename Data, template <typename> class Allocator>
+  List<Data, Allocator>::List(const List<Data, Allocator> &other)
   {
     if (!other.Empty())
     {
-      Node *otherCurrent = other.head;
-
-      head = new Node(otherCurrent->element); // Create first node with copy of first element
-      Node *thisCurrent = head;
-      otherCurrent = otherCurrent->next;
-
-      while (otherCurrent != nullptr)
-      {
-        thisCurrent->next = new Node(otherCurrent->element); // Copy remaining nodes
-        thisCurrent = thisCurrent->next;
-        otherCurrent = otherCurrent->next;
-      }
-
-      tail = thisCurrent; // Set tail to last created node
+      head = CloneChain(other.head, tail); // Copy the whole chain, tail is set to its last node
       size = other.size;
     }
   }
 
   // Move constructor
-  template <typename Data>
-  List<Data>::List(List<Data> &&other) noexcept
+  template <typename Data, template <typename> class Allocator>
+  List<Data, Allocator>::List(List<Data, Allocator> &&other) noexcept
   {
-    std::swap(head, other.head); // Swap pointers and size with other list
+    std::swap(head, other.head); // Swap pointers, size and node storage with other list
     std::swap(tail, other.tail);
     std::swap(size, other.size);
+    std::swap(allocator, other.allocator);
   }
 
   // Destructor
-  template <typename Data>
-  List<Data>::~List()
+  template <typename Data, template <typename> class Allocator>
+  List<Data, Allocator>::~List()
   {
     Clear(); // Free all dynamically allocated nodes
   }
 
   // Copy assignment
-  template <typename Data>
-  List<Data> &List<Data>::operator=(const List<Data> &other)
+  template <typename Data, template <typename> class Allocator>
+  List<Data, Allocator> &List<Data, Allocator>::operator=(const List<Data, Allocator> &other)
   {
     if (this != &other)
     {
@@ -76,7 +65,7 @@ namespace lasd
         if (tail == nullptr)
         {
           // If this list is empty, create a new list and swap
-          List<Data> *tmpList = new List<Data>(other);
+          List<Data, Allocator> *tmpList = new List<Data, Allocator>(other);
           std::swap(*tmpList, *this);
           delete tmpList;
         }
@@ -92,15 +81,9 @@ namespace lasd
           if (ocur != nullptr)
           {
             // If other list has more elements, clone remaining nodes
-            tail->next = ocur->Clone();
-
-            // Find new tail after appending nodes
-            Node *newTail = tail->next;
-            while (newTail->next != nullptr)
-            {
-              newTail = newTail->next;
-            }
-
+            Node *newTail = nullptr;
+            tail->next = CloneChain(ocur, newTail);
+            tail->next->prev = tail;
             tail = newTail;
           }
         }
@@ -110,8 +93,7 @@ namespace lasd
         if (other.tail == nullptr)
         {
           // If other list is empty, clear this list
-          delete head;
-          head = tail = nullptr;
+          Clear();
         }
         else
         {
@@ -130,7 +112,7 @@ namespace lasd
           {
             Node *toDelete = temp;
             temp = temp->next;
-            delete toDelete;
+            allocator.Delete(toDelete);
           }
         }
       }
@@ -141,21 +123,22 @@ namespace lasd
   }
 
   // Move assignment
-  template <typename Data>
-  List<Data> &List<Data>::operator=(List<Data> &&other) noexcept
+  template <typename Data, template <typename> class Allocator>
+  List<Data, Allocator> &List<Data, Allocator>::operator=(List<Data, Allocator> &&other) noexcept
   {
     if (this != &other)
     {
       std::swap(head, other.head);
       std::swap(tail, other.tail);
       std::swap(size, other.size);
+      std::swap(allocator, other.allocator);
     }
     return *this;
   }
 
   // Comparison operators
-  template <typename Data>
-  bool List<Data>::operator==(const List<Data> &other) const noexcept
+  template <typename Data, template <typename> class Allocator>
+  bool List<Data, Allocator>::operator==(const List<Data, Allocator> &other) const noexcept
   {
     if (size != other.size)
     {
@@ -178,18 +161,18 @@ namespace lasd
     return true; // All elements match
   }
 
-  template <typename Data>
-  bool List<Data>::operator!=(const List<Data> &other) const noexcept
+  template <typename Data, template <typename> class Allocator>
+  bool List<Data, Allocator>::operator!=(const List<Data, Allocator> &other) const noexcept
   {
     return !(*this == other); // Use equality operator for inverse check
   }
 
   // Specific member functions
 
-  template <typename Data>
-  void List<Data>::InsertAtFront(const Data &data)
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::InsertAtFront(const Data &data)
   {
-    Node *newNode = new Node(data); // Create new node with copy of data
+    Node *newNode = allocator.New(data); // Create new node with copy of data
 
     if (head == nullptr)
     {
@@ -201,16 +184,17 @@ namespace lasd
     {
       // Connect new node to current head
       newNode->next = head;
+      head->prev = newNode;
       head = newNode;
     }
 
     size++;
   }
 
-  template <typename Data>
-  void List<Data>::InsertAtFront(Data &&data) noexcept
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::InsertAtFront(Data &&data) noexcept
   {
-    Node *newNode = new Node(std::move(data)); // Create new node with moved data
+    Node *newNode = allocator.New(std::move(data)); // Create new node with moved data
 
     if (head == nullptr)
     {
@@ -222,33 +206,26 @@ namespace lasd
     {
       // Connect new node to current head
       newNode->next = head;
+      head->prev = newNode;
       head = newNode;
     }
 
     size++;
   }
 
-  template <typename Data>
-  void List<Data>::RemoveFromFront()
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::RemoveFromFront()
   {
     if (Empty())
     {
       throw std::length_error("List: Empty container");
     }
 
-    Node *temp = head;
-    head = head->next; // Update head to point to second node
-    delete temp;       // Free memory of removed node
-
-    size--;
-    if (head == nullptr)
-    {
-      tail = nullptr; // If list becomes empty, also update tail
-    }
+    RemoveNode(head); // Unlink first node, head moves to the second one
   }
 
-  template <typename Data>
-  Data List<Data>::FrontNRemove()
+  template <typename Data, template <typename> class Allocator>
+  Data List<Data, Allocator>::FrontNRemove()
   {
     if (Empty())
     {
@@ -260,10 +237,10 @@ namespace lasd
     return value;
   }
 
-  template <typename Data>
-  void List<Data>::InsertAtBack(const Data &data)
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::InsertAtBack(const Data &data)
   {
-    Node *newNode = new Node(data); // Create new node with copy of data
+    Node *newNode = allocator.New(data); // Create new node with copy of data
 
     if (tail == nullptr)
     {
@@ -274,6 +251,7 @@ namespace lasd
     else
     {
       // Add to end and update tail
+      newNode->prev = tail;
       tail->next = newNode;
       tail = newNode;
     }
@@ -281,10 +259,10 @@ namespace lasd
     size++;
   }
 
-  template <typename Data>
-  void List<Data>::InsertAtBack(Data &&data) noexcept
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::InsertAtBack(Data &&data) noexcept
   {
-    Node *newNode = new Node(std::move(data)); // Create new node with moved data
+    Node *newNode = allocator.New(std::move(data)); // Create new node with moved data
 
     if (tail == nullptr)
     {
@@ -295,6 +273,7 @@ namespace lasd
     else
     {
       // Add to end and update tail
+      newNode->prev = tail;
       tail->next = newNode;
       tail = newNode;
     }
@@ -302,40 +281,19 @@ namespace lasd
     size++;
   }
 
-  template <typename Data>
-  void List<Data>::RemoveFromBack()
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::RemoveFromBack()
   {
     if (Empty())
     {
       throw std::length_error("List: Empty container");
     }
 
-    if (head == tail)
-    {
-      // If only one element, clear the list
-      delete head;
-      head = nullptr;
-      tail = nullptr;
-    }
-    else
-    {
-      // Find the node right before tail
-      Node *current = head;
-      while (current->next != tail)
-      {
-        current = current->next;
-      }
-
-      delete tail;
-      tail = current; // Update tail to the new last node
-      tail->next = nullptr;
-    }
-
-    size--;
+    RemoveNode(tail); // Unlink last node, tail moves back through its prev link
   }
 
-  template <typename Data>
-  Data List<Data>::BackNRemove()
+  template <typename Data, template <typename> class Allocator>
+  Data List<Data, Allocator>::BackNRemove()
   {
     if (Empty())
     {
@@ -347,10 +305,57 @@ namespace lasd
     return value;
   }
 
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::Splice(const ulong index, List<Data, Allocator> &&other)
+  {
+    if (index > size)
+    {
+      throw std::out_of_range("List: Index out of range");
+    }
+
+    if (this == &other || other.Empty())
+    {
+      return; // Nothing to move
+    }
+
+    Node *after = GetNodeAt(index);                         // First node that follows the spliced chain
+    Node *before = (after != nullptr) ? after->prev : tail; // Last node that precedes it
+
+    other.head->prev = before;
+    other.tail->next = after;
+    if (before != nullptr)
+    {
+      before->next = other.head;
+    }
+    else
+    {
+      head = other.head;
+    }
+    if (after != nullptr)
+    {
+      after->prev = other.tail;
+    }
+    else
+    {
+      tail = other.tail;
+    }
+
+    size += other.size;
+    other.head = other.tail = nullptr; // Other keeps no node
+    other.size = 0;
+    allocator.Adopt(other.allocator); // The moved nodes may live in storage owned by other
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::Append(List<Data, Allocator> &&other) noexcept
+  {
+    Splice(size, std::move(other)); // Splicing at the end only relinks tail: O(1)
+  }
+
   // Specific member functions (inherited from MutableLinearContainer)
 
-  template <typename Data>
-  Data &List<Data>::operator[](const ulong index)
+  template <typename Data, template <typename> class Allocator>
+  Data &List<Data, Allocator>::operator[](const ulong index)
   {
     if (index >= size)
     {
@@ -360,8 +365,8 @@ namespace lasd
     return GetNodeAt(index)->element; // Return mutable reference to element
   }
 
-  template <typename Data>
-  Data &List<Data>::Front()
+  template <typename Data, template <typename> class Allocator>
+  Data &List<Data, Allocator>::Front()
   {
     if (Empty())
     {
@@ -371,8 +376,8 @@ namespace lasd
     return head->element; // Return mutable reference to first element
   }
 
-  template <typename Data>
-  Data &List<Data>::Back()
+  template <typename Data, template <typename> class Allocator>
+  Data &List<Data, Allocator>::Back()
   {
     if (Empty())
     {
@@ -384,8 +389,8 @@ namespace lasd
 
   // Specific member functions (inherited from LinearContainer)
 
-  template <typename Data>
-  const Data &List<Data>::operator[](const ulong index) const
+  template <typename Data, template <typename> class Allocator>
+  const Data &List<Data, Allocator>::operator[](const ulong index) const
   {
     if (index >= size)
     {
@@ -395,8 +400,8 @@ namespace lasd
     return GetNodeAt(index)->element; // Return const reference to element
   }
 
-  template <typename Data>
-  const Data &List<Data>::Front() const
+  template <typename Data, template <typename> class Allocator>
+  const Data &List<Data, Allocator>::Front() const
   {
     if (Empty())
     {
@@ -406,8 +411,8 @@ namespace lasd
     return head->element; // Return const reference to first element
   }
 
-  template <typename Data>
-  const Data &List<Data>::Back() const
+  template <typename Data, template <typename> class Allocator>
+  const Data &List<Data, Allocator>::Back() const
   {
     if (Empty())
     {
@@ -419,14 +424,14 @@ namespace lasd
 
   // Specific member function (inherited from MappableContainer, PreOrderMappableContainer, PostOrderMappableContainer)
 
-  template <typename Data>
-  void List<Data>::Map(MapFun fun)
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::Map(MapFun fun)
   {
     PreOrderMap(fun); // Default Map implementation uses PreOrderMap
   }
 
-  template <typename Data>
-  void List<Data>::PreOrderMap(MapFun fun)
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::PreOrderMap(MapFun fun)
   {
     Node *current = head;
     while (current != nullptr)
@@ -436,30 +441,40 @@ namespace lasd
     }
   }
 
-  template <typename Data>
-  void List<Data>::PostOrderMap(MapFun fun)
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::PostOrderMap(MapFun fun)
   {
-    std::function<void(Node *)> recursiveMap = [&recursiveMap, &fun](Node *currentNode)
+    Node *current = tail;
+    while (current != nullptr)
     {
-      if (currentNode != nullptr)
-      {
-        recursiveMap(currentNode->next); // Process next nodes first (recursively)
-        fun(currentNode->element);       // Then process current node (back to front)
-      }
-    };
-    recursiveMap(head);
+      fun(current->element); // Apply function to each element from back to front
+      current = current->prev;
+    }
   }
 
   // Specific member function (inherited from TraversableContainer, PreOrderTraversableContainer, PostOrderTraversableContainer)
 
-  template <typename Data>
-  void List<Data>::Traverse(TraverseFun fun) const
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::Traverse(TraverseFun fun) const
   {
     PreOrderTraverse(fun); // Default Traverse implementation uses PreOrderTraverse
   }
 
-  template <typename Data>
-  void List<Data>::PreOrderTraverse(TraverseFun fun) const
+  template <typename Data, template <typename> class Allocator>
+  bool List<Data, Allocator>::TraverseWhile(TraverseWhileFun fun) const
+  {
+    for (const Node *current = head; current != nullptr; current = current->next)
+    {
+      if (!fun(current->element))
+      {
+        return false; // Stop at the first node the function rejects
+      }
+    }
+    return true;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::PreOrderTraverse(TraverseFun fun) const
   {
     Node *current = head;
     while (current != nullptr)
@@ -469,51 +484,193 @@ namespace lasd
     }
   }
 
-  template <typename Data>
-  void List<Data>::PostOrderTraverse(TraverseFun fun) const
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::PostOrderTraverse(TraverseFun fun) const
   {
-    std::function<void(Node *)> recursiveTraverse = [&recursiveTraverse, &fun](Node *currentNode)
+    Node *current = tail;
+    while (current != nullptr)
     {
-      if (currentNode != nullptr)
-      {
-        recursiveTraverse(currentNode->next); // Process next nodes first (recursively)
-        fun(currentNode->element);            // Then process current node (back to front)
-      }
-    };
-    recursiveTraverse(head);
+      fun(current->element); // Apply function to each element from back to front
+      current = current->prev;
+    }
+  }
+
+  // Template fast paths
+
+  template <typename Data, template <typename> class Allocator>
+  template <typename Fun>
+  void List<Data, Allocator>::ForEach(Fun &&fun) const
+  {
+    for (const Node *current = head; current != nullptr; current = current->next)
+    {
+      fun(current->element);
+    }
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  template <typename Accumulator, typename Fun>
+  Accumulator List<Data, Allocator>::Reduce(Fun &&fun, Accumulator accumulator) const
+  {
+    for (const Node *current = head; current != nullptr; current = current->next)
+    {
+      accumulator = fun(current->element, accumulator);
+    }
+    return accumulator;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  template <typename Fun>
+  void List<Data, Allocator>::MapInPlace(Fun &&fun)
+  {
+    for (Node *current = head; current != nullptr; current = current->next)
+    {
+      fun(current->element);
+    }
+  }
+
+  // Specific member functions (iterators)
+
+  template <typename Data, template <typename> class Allocator>
+  typename List<Data, Allocator>::Iterator List<Data, Allocator>::begin() noexcept
+  {
+    return Iterator(head, this);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename List<Data, Allocator>::Iterator List<Data, Allocator>::end() noexcept
+  {
+    return Iterator(nullptr, this);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename List<Data, Allocator>::ConstIterator List<Data, Allocator>::begin() const noexcept
+  {
+    return ConstIterator(head, this);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename List<Data, Allocator>::ConstIterator List<Data, Allocator>::end() const noexcept
+  {
+    return ConstIterator(nullptr, this);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename List<Data, Allocator>::ConstIterator List<Data, Allocator>::cbegin() const noexcept
+  {
+    return ConstIterator(head, this);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename List<Data, Allocator>::ConstIterator List<Data, Allocator>::cend() const noexcept
+  {
+    return ConstIterator(nullptr, this);
   }
 
   // Specific member function (inherited from ClearableContainer)
 
-  template <typename Data>
-  void List<Data>::Clear()
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::Clear()
   {
-    Node *current = head;
-    while (current != nullptr)
+    if constexpr (!(Allocator<Node>::BulkRelease && std::is_trivially_destructible_v<Node>))
     {
-      Node *temp = current;
-      current = current->next; // Move to next node before deleting current
-      delete temp;             // Free memory of current node
+      Node *current = head;
+      while (current != nullptr)
+      {
+        Node *temp = current;
+        current = current->next; // Move to next node before deleting current
+        allocator.Delete(temp);  // Free memory of current node
+      }
     }
+    allocator.Release(); // No node is left: pooled storage goes back at once
 
     head = nullptr;
     tail = nullptr;
     size = 0;
   }
 
-  // Protected auxiliary function
+  // Protected auxiliary functions
 
-  template <typename Data>
-  typename List<Data>::Node *List<Data>::GetNodeAt(ulong index) const
+  template <typename Data, template <typename> class Allocator>
+  typename List<Data, Allocator>::Node *List<Data, Allocator>::GetNodeAt(ulong index) const
   {
+    if (index >= size)
+    {
+      return nullptr; // No node at this position
+    }
+
+    if (index > size / 2)
+    {
+      // Closer to the back: walk backward from tail
+      Node *current = tail;
+      for (ulong i = size - 1; i > index; --i)
+      {
+        current = current->prev;
+      }
+      return current;
+    }
+
     Node *current = head;
-    for (ulong i = 0; i < index && current != nullptr; ++i)
+    for (ulong i = 0; i < index; ++i)
     {
       current = current->next; // Traverse the list to find node at given index
     }
     return current;
   }
 
+  template <typename Data, template <typename> class Allocator>
+  typename List<Data, Allocator>::Node *List<Data, Allocator>::CloneChain(const Node *first, Node *&last)
+  {
+    Node *copy = allocator.New(first->element); // Create new node with copied element
+    last = copy;
+    try
+    {
+      for (const Node *current = first->next; current != nullptr; current = current->next)
+      {
+        last->next = allocator.New(current->element); // Copy the following nodes one by one
+        last->next->prev = last;
+        last = last->next;
+      }
+    }
+    catch (...)
+    {
+      // Release the partial copy before propagating the failure
+      while (copy != nullptr)
+      {
+        Node *temp = copy;
+        copy = copy->next;
+        allocator.Delete(temp);
+      }
+      throw;
+    }
+    return copy;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void List<Data, Allocator>::RemoveNode(Node *node) noexcept
+  {
+    // Bridge the neighbours of node, moving head or tail when node is at an end
+    if (node->prev != nullptr)
+    {
+      node->prev->next = node->next;
+    }
+    else
+    {
+      head = node->next;
+    }
+
+    if (node->next != nullptr)
+    {
+      node->next->prev = node->prev;
+    }
+    else
+    {
+      tail = node->prev;
+    }
+
+    allocator.Delete(node); // Free memory of removed node
+    size--;
+  }
+
   /* ************************************************************************** */
 
 }
\ No newline at end of file
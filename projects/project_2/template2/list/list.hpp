@@ -3,7 +3,13 @@
 
 /* ************************************************************************** */
 
+#include <iterator>
+#include <type_traits>
+
+/* ************************************************************************** */
+
 #include "../container/linear.hpp"
+#include "../allocator/allocator.hpp"
 
 /* ************************************************************************** */
 
@@ -12,12 +18,13 @@ namespace lasd
 
   /* ************************************************************************** */
 
-  template <typename Data>
+  template <typename Data, template <typename> class Allocator = HeapAllocator>
   class List : virtual public MutableLinearContainer<Data>, virtual public ClearableContainer
   {
     // Must extend MutableLinearContainer<Data>,
     //             ClearableContainer
-    // Implementation of a singly linked list data structure
+    // Implementation of a doubly linked list data structure
+    // (nodes come from the Allocator policy: HeapAllocator or PoolAllocator)
 
   private:
     // ...
@@ -28,10 +35,12 @@ namespace lasd
     struct Node
     {
       // Node structure for the linked list implementation
+      // (no virtual members: a node is just its element and two links)
 
       // Data
       Data element;         // Value stored in the node
       Node *next = nullptr; // Pointer to the next node in the list
+      Node *prev = nullptr; // Pointer to the previous node in the list
 
       /* ********************************************************************** */
 
@@ -45,18 +54,19 @@ namespace lasd
       /* ********************************************************************** */
 
       // Copy constructor
-      Node(const Node &other) : element(other.element), next(nullptr) {} // Create copy with no link to next node
+      Node(const Node &other) : element(other.element), next(nullptr), prev(nullptr) {} // Create copy with no links
 
       // Move constructor
-      Node(Node &&other) noexcept : element(std::move(other.element)), next(other.next)
+      Node(Node &&other) noexcept : element(std::move(other.element)), next(other.next), prev(other.prev)
       {
-        other.next = nullptr; // Ensure other node no longer points to the moved next node
+        other.next = nullptr; // Ensure other node no longer points to the moved neighbours
+        other.prev = nullptr;
       }
 
       /* ********************************************************************** */
 
       // Destructor
-      virtual ~Node() = default;
+      ~Node() = default;
 
       /* ********************************************************************** */
 
@@ -70,25 +80,85 @@ namespace lasd
       {
         return !(*this == other); // Leverages equality operator for inequality check
       }
+    };
+
+    static_assert(!std::is_polymorphic_v<Node>, "List nodes must not carry a vptr");
+
+    Node *head = nullptr; // Pointer to first node in the list
+    Node *tail = nullptr; // Pointer to last node in the list, start of backward walks
+
+    Allocator<Node> allocator; // Source of every node of this list
+
+    template <bool Constant>
+    class NodeIterator
+    {
+      // Bidirectional iterator over the node chain: end() is the null node,
+      // from which a decrement steps back onto the tail of the owning list
+
+      friend class List;
+
+      template <bool>
+      friend class NodeIterator;
+
+    public:
+      using iterator_concept = std::bidirectional_iterator_tag;
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type = Data;
+      using difference_type = std::ptrdiff_t;
+      using pointer = std::conditional_t<Constant, const Data *, Data *>;
+      using reference = std::conditional_t<Constant, const Data &, Data &>;
+
+      /* ********************************************************************** */
+
+      // Default constructor
+      NodeIterator() = default;
+
+      // Specific constructor
+      template <bool OtherConstant>
+        requires(Constant && !OtherConstant)
+      NodeIterator(const NodeIterator<OtherConstant> &other) noexcept : current(other.current), owner(other.owner) {} // Mutable to read-only conversion
 
       /* ********************************************************************** */
 
       // Specific member functions
 
-      // Clone method - creates a deep copy of the current node and its chain
-      Node *Clone() const
+      reference operator*() const noexcept { return current->element; }
+      pointer operator->() const noexcept { return &current->element; }
+
+      NodeIterator &operator++() noexcept
       {
-        Node *temp = new Node(element); // Create new node with copied element
-        if (next != nullptr)
-        {
-          temp->next = next->Clone(); // Recursively clone all subsequent nodes
-        }
-        return temp;
+        current = current->next;
+        return *this;
       }
-    };
 
-    Node *head = nullptr; // Pointer to first node in the list
-    Node *tail = nullptr; // Pointer to last node in the list for efficient back operations
+      NodeIterator operator++(int) noexcept
+      {
+        NodeIterator previous = *this;
+        current = current->next;
+        return previous;
+      }
+
+      NodeIterator &operator--() noexcept
+      {
+        current = (current == nullptr) ? owner->tail : current->prev;
+        return *this;
+      }
+
+      NodeIterator operator--(int) noexcept
+      {
+        NodeIterator previous = *this;
+        --*this;
+        return previous;
+      }
+
+      bool operator==(const NodeIterator &other) const noexcept { return current == other.current; }
+
+    private:
+      NodeIterator(Node *node, const List *list) noexcept : current(node), owner(list) {}
+
+      Node *current = nullptr;     // Node under the iterator (nullptr past the end)
+      const List *owner = nullptr; // List walked, to step back from the end
+    };
 
   public:
     // Default constructor
@@ -138,8 +208,11 @@ namespace lasd
 
     void InsertAtBack(const Data &data);     // Insert copy of data at the end of the list
     void InsertAtBack(Data &&data) noexcept; // Insert moved data at the end of the list
-    void RemoveFromBack();                   // Remove last element (must throw std::length_error when empty)
-    Data BackNRemove();                      // Remove and return last element (must throw std::length_error when empty)
+    void RemoveFromBack();                   // Remove last element in O(1) (must throw std::length_error when empty)
+    Data BackNRemove();                      // Remove and return last element in O(1) (must throw std::length_error when empty)
+
+    void Splice(const ulong index, List &&other); // Move all nodes of other before position index, leaving other empty (must throw std::out_of_range when index > size)
+    void Append(List &&other) noexcept;           // Move all nodes of other to the end in O(1), leaving other empty
 
     /* ************************************************************************ */
 
@@ -189,6 +262,10 @@ namespace lasd
 
     void Traverse(TraverseFun) const override; // Apply function to all elements (non-modifying)
 
+    using typename TraversableContainer<Data>::TraverseWhileFun;
+
+    bool TraverseWhile(TraverseWhileFun) const override; // Walk front to back until the function returns false
+
     /* ************************************************************************ */
 
     // Specific member function (inherited from PreOrderTraversableContainer)
@@ -203,6 +280,35 @@ namespace lasd
 
     /* ************************************************************************ */
 
+    // Specific member functions (template fast paths, hiding the type-erased ones)
+
+    template <typename Fun>
+    void ForEach(Fun &&) const; // Apply callable to each element, front to back
+
+    template <typename Accumulator, typename Fun>
+    Accumulator Reduce(Fun &&, Accumulator) const; // Fold with any callable, front to back
+
+    template <typename Fun>
+    void MapInPlace(Fun &&); // Apply callable to each element (mutable), front to back
+
+    /* ************************************************************************ */
+
+    // Specific member functions (bidirectional iterators, invalidated only when their node is removed)
+
+    using Iterator = NodeIterator<false>;
+    using ConstIterator = NodeIterator<true>;
+
+    Iterator begin() noexcept; // First element
+    Iterator end() noexcept;   // Past the last element
+
+    ConstIterator begin() const noexcept; // First element (read-only)
+    ConstIterator end() const noexcept;   // Past the last element (read-only)
+
+    ConstIterator cbegin() const noexcept; // First element (read-only, also on a mutable list)
+    ConstIterator cend() const noexcept;   // Past the last element (read-only, also on a mutable list)
+
+    /* ************************************************************************ */
+
     // Specific member function (inherited from ClearableContainer)
 
     void Clear() override; // Remove all elements from the list
@@ -210,6 +316,13 @@ namespace lasd
   protected:
     // Auxiliary function to find node at a specific position
     Node *GetNodeAt(ulong index) const; // Helper to retrieve node at given position
+
+    // Auxiliary function to copy the chain starting at a node in one forward
+    // pass; last receives the final node of the copy
+    Node *CloneChain(const Node *first, Node *&last);
+
+    // Auxiliary function to unlink and delete a node of this list in O(1)
+    void RemoveNode(Node *node) noexcept;
   };
 
   /* ************************************************************************** */
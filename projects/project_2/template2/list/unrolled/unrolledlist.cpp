@@ -0,0 +1,714 @@
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Specific constructors
+
+  template <typename Data, ulong NodeCapacity>
+  UnrolledList<Data, NodeCapacity>::UnrolledList(const TraversableContainer<Data> &container)
+  {
+    container.Traverse([this](const Data &data)
+                       {
+                         InsertAtBack(data); // Copy each element from container to the end of this list
+                       });
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  UnrolledList<Data, NodeCapacity>::UnrolledList(MappableContainer<Data> &&container) noexcept
+  {
+    container.Map([this](Data &data)
+                  {
+                    InsertAtBack(std::move(data)); // Move each element from container to the end of this list
+                  });
+  }
+
+  // Copy constructor
+  template <typename Data, ulong NodeCapacity>
+  UnrolledList<Data, NodeCapacity>::UnrolledList(const UnrolledList<Data, NodeCapacity> &other)
+  {
+    try
+    {
+      for (const Node *source = other.head; source != nullptr; source = source->next)
+      {
+        Node *node = LinkNewNode(tail); // Same node layout as other, one node at a time
+        std::uninitialized_copy_n(source->Elements(), source->count, node->Elements());
+        node->count = source->count;
+        size += source->count;
+      }
+    }
+    catch (...)
+    {
+      Clear(); // The destructor does not run when a constructor throws
+      throw;
+    }
+  }
+
+  // Move constructor
+  template <typename Data, ulong NodeCapacity>
+  UnrolledList<Data, NodeCapacity>::UnrolledList(UnrolledList<Data, NodeCapacity> &&other) noexcept
+  {
+    std::swap(head, other.head); // Swap pointers and size with other list
+    std::swap(tail, other.tail);
+    std::swap(size, other.size);
+  }
+
+  // Destructor
+  template <typename Data, ulong NodeCapacity>
+  UnrolledList<Data, NodeCapacity>::~UnrolledList()
+  {
+    Clear(); // Destroy all elements and free all nodes
+  }
+
+  // Copy assignment
+  template <typename Data, ulong NodeCapacity>
+  UnrolledList<Data, NodeCapacity> &UnrolledList<Data, NodeCapacity>::operator=(const UnrolledList<Data, NodeCapacity> &other)
+  {
+    if (this != &other)
+    {
+      UnrolledList<Data, NodeCapacity> copy(other); // Copy first: this is untouched if copying throws
+      std::swap(head, copy.head);
+      std::swap(tail, copy.tail);
+      std::swap(size, copy.size);
+    }
+    return *this;
+  }
+
+  // Move assignment
+  template <typename Data, ulong NodeCapacity>
+  UnrolledList<Data, NodeCapacity> &UnrolledList<Data, NodeCapacity>::operator=(UnrolledList<Data, NodeCapacity> &&other) noexcept
+  {
+    if (this != &other)
+    {
+      std::swap(head, other.head);
+      std::swap(tail, other.tail);
+      std::swap(size, other.size);
+    }
+    return *this;
+  }
+
+  // Comparison operators
+  template <typename Data, ulong NodeCapacity>
+  bool UnrolledList<Data, NodeCapacity>::operator==(const UnrolledList<Data, NodeCapacity> &other) const noexcept
+  {
+    if (size != other.size)
+    {
+      return false; // Lists of different sizes cannot be equal
+    }
+
+    // Node boundaries may differ between equal lists: advance two cursors
+    const Node *otherNode = other.head;
+    ulong otherOffset = 0;
+    for (const Node *node = head; node != nullptr; node = node->next)
+    {
+      for (ulong offset = 0; offset < node->count; offset++)
+      {
+        if (otherOffset == otherNode->count)
+        {
+          otherNode = otherNode->next;
+          otherOffset = 0;
+        }
+        if (node->Elements()[offset] != otherNode->Elements()[otherOffset++])
+        {
+          return false; // Elements differ, lists are not equal
+        }
+      }
+    }
+
+    return true; // All elements match
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool UnrolledList<Data, NodeCapacity>::operator!=(const UnrolledList<Data, NodeCapacity> &other) const noexcept
+  {
+    return !(*this == other); // Use equality operator for inverse check
+  }
+
+  // Specific member functions
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::InsertAtFront(const Data &data)
+  {
+    InsertAtPosition(0, data);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::InsertAtFront(Data &&data)
+  {
+    InsertAtPosition(0, std::move(data));
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::RemoveFromFront()
+  {
+    if (Empty())
+    {
+      throw std::length_error("UnrolledList: Empty container");
+    }
+
+    RemoveFromNode(head, 0);
+    size--;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  Data UnrolledList<Data, NodeCapacity>::FrontNRemove()
+  {
+    if (Empty())
+    {
+      throw std::length_error("UnrolledList: Empty container");
+    }
+
+    Data value(std::move(head->Elements()[0])); // Take the value before removing its slot
+    RemoveFromFront();
+    return value;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::InsertAtBack(const Data &data)
+  {
+    InsertAtPosition(size, data);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::InsertAtBack(Data &&data)
+  {
+    InsertAtPosition(size, std::move(data));
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::RemoveFromBack()
+  {
+    if (Empty())
+    {
+      throw std::length_error("UnrolledList: Empty container");
+    }
+
+    RemoveFromNode(tail, tail->count - 1);
+    size--;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  Data UnrolledList<Data, NodeCapacity>::BackNRemove()
+  {
+    if (Empty())
+    {
+      throw std::length_error("UnrolledList: Empty container");
+    }
+
+    Data value(std::move(tail->Elements()[tail->count - 1])); // Take the value before removing its slot
+    RemoveFromBack();
+    return value;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::InsertAt(const ulong index, const Data &data)
+  {
+    if (index > size)
+    {
+      throw std::out_of_range("UnrolledList: Index out of range");
+    }
+
+    InsertAtPosition(index, data);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::InsertAt(const ulong index, Data &&data)
+  {
+    if (index > size)
+    {
+      throw std::out_of_range("UnrolledList: Index out of range");
+    }
+
+    InsertAtPosition(index, std::move(data));
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::RemoveAt(const ulong index)
+  {
+    if (index >= size)
+    {
+      throw std::out_of_range("UnrolledList: Index out of range");
+    }
+
+    ulong offset;
+    Node *node = Locate(index, offset);
+    Node *previous = node->prev;
+    RemoveFromNode(node, offset);
+    size--;
+
+    // Any two neighbouring nodes must hold more than NodeCapacity elements
+    // together, so the list stays at least half full on average
+    Node *current = (previous != nullptr) ? previous : head;
+    for (ulong checks = 0; checks < 2 && current != nullptr; checks++)
+    {
+      if (!MergeNext(current))
+      {
+        current = current->next;
+      }
+    }
+  }
+
+  // Specific member functions (inherited from MutableLinearContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  Data &UnrolledList<Data, NodeCapacity>::operator[](const ulong index)
+  {
+    if (index >= size)
+    {
+      throw std::out_of_range("UnrolledList: Index out of range");
+    }
+
+    ulong offset;
+    Node *node = Locate(index, offset);
+    return node->Elements()[offset]; // Return mutable reference to element
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  Data &UnrolledList<Data, NodeCapacity>::Front()
+  {
+    if (Empty())
+    {
+      throw std::length_error("UnrolledList: Empty container");
+    }
+
+    return head->Elements()[0]; // Return mutable reference to first element
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  Data &UnrolledList<Data, NodeCapacity>::Back()
+  {
+    if (Empty())
+    {
+      throw std::length_error("UnrolledList: Empty container");
+    }
+
+    return tail->Elements()[tail->count - 1]; // Return mutable reference to last element
+  }
+
+  // Specific member functions (inherited from LinearContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &UnrolledList<Data, NodeCapacity>::operator[](const ulong index) const
+  {
+    if (index >= size)
+    {
+      throw std::out_of_range("UnrolledList: Index out of range");
+    }
+
+    ulong offset;
+    const Node *node = Locate(index, offset);
+    return node->Elements()[offset]; // Return const reference to element
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &UnrolledList<Data, NodeCapacity>::Front() const
+  {
+    if (Empty())
+    {
+      throw std::length_error("UnrolledList: Empty container");
+    }
+
+    return head->Elements()[0]; // Return const reference to first element
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &UnrolledList<Data, NodeCapacity>::Back() const
+  {
+    if (Empty())
+    {
+      throw std::length_error("UnrolledList: Empty container");
+    }
+
+    return tail->Elements()[tail->count - 1]; // Return const reference to last element
+  }
+
+  // Specific member function (inherited from MappableContainer, PreOrderMappableContainer, PostOrderMappableContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::Map(MapFun fun)
+  {
+    PreOrderMap(fun); // Default Map implementation uses PreOrderMap
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::PreOrderMap(MapFun fun)
+  {
+    for (Node *node = head; node != nullptr; node = node->next)
+    {
+      Data *elements = node->Elements();
+      for (ulong offset = 0; offset < node->count; offset++)
+      {
+        fun(elements[offset]); // Apply function to each element from front to back
+      }
+    }
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::PostOrderMap(MapFun fun)
+  {
+    for (Node *node = tail; node != nullptr; node = node->prev)
+    {
+      Data *elements = node->Elements();
+      for (ulong offset = node->count; offset > 0; offset--)
+      {
+        fun(elements[offset - 1]); // Apply function to each element from back to front
+      }
+    }
+  }
+
+  // Specific member function (inherited from TraversableContainer, PreOrderTraversableContainer, PostOrderTraversableContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::Traverse(TraverseFun fun) const
+  {
+    PreOrderTraverse(fun); // Default Traverse implementation uses PreOrderTraverse
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool UnrolledList<Data, NodeCapacity>::TraverseWhile(TraverseWhileFun fun) const
+  {
+    for (const Node *node = head; node != nullptr; node = node->next)
+    {
+      const Data *elements = node->Elements();
+      for (ulong offset = 0; offset < node->count; offset++)
+      {
+        if (!fun(elements[offset]))
+        {
+          return false; // Stop at the first element the function rejects
+        }
+      }
+    }
+    return true;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::PreOrderTraverse(TraverseFun fun) const
+  {
+    for (const Node *node = head; node != nullptr; node = node->next)
+    {
+      const Data *elements = node->Elements();
+      for (ulong offset = 0; offset < node->count; offset++)
+      {
+        fun(elements[offset]); // Apply function to each element from front to back
+      }
+    }
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::PostOrderTraverse(TraverseFun fun) const
+  {
+    for (const Node *node = tail; node != nullptr; node = node->prev)
+    {
+      const Data *elements = node->Elements();
+      for (ulong offset = node->count; offset > 0; offset--)
+      {
+        fun(elements[offset - 1]); // Apply function to each element from back to front
+      }
+    }
+  }
+
+  // Template fast paths
+
+  template <typename Data, ulong NodeCapacity>
+  template <typename Fun>
+  void UnrolledList<Data, NodeCapacity>::ForEach(Fun &&fun) const
+  {
+    for (const Node *node = head; node != nullptr; node = node->next)
+    {
+      const Data *elements = node->Elements();
+      for (ulong offset = 0, count = node->count; offset < count; offset++)
+      {
+        fun(elements[offset]);
+      }
+    }
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  template <typename Accumulator, typename Fun>
+  Accumulator UnrolledList<Data, NodeCapacity>::Reduce(Fun &&fun, Accumulator accumulator) const
+  {
+    for (const Node *node = head; node != nullptr; node = node->next)
+    {
+      const Data *elements = node->Elements();
+      for (ulong offset = 0, count = node->count; offset < count; offset++)
+      {
+        accumulator = fun(elements[offset], accumulator);
+      }
+    }
+    return accumulator;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  template <typename Fun>
+  void UnrolledList<Data, NodeCapacity>::MapInPlace(Fun &&fun)
+  {
+    for (Node *node = head; node != nullptr; node = node->next)
+    {
+      Data *elements = node->Elements();
+      for (ulong offset = 0, count = node->count; offset < count; offset++)
+      {
+        fun(elements[offset]);
+      }
+    }
+  }
+
+  // Specific member functions (iterators: nodes are never empty, so begin() is slot 0 of the head)
+
+  template <typename Data, ulong NodeCapacity>
+  typename UnrolledList<Data, NodeCapacity>::Iterator UnrolledList<Data, NodeCapacity>::begin() noexcept
+  {
+    return Iterator(head, this);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  typename UnrolledList<Data, NodeCapacity>::Iterator UnrolledList<Data, NodeCapacity>::end() noexcept
+  {
+    return Iterator(nullptr, this);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  typename UnrolledList<Data, NodeCapacity>::ConstIterator UnrolledList<Data, NodeCapacity>::begin() const noexcept
+  {
+    return ConstIterator(head, this);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  typename UnrolledList<Data, NodeCapacity>::ConstIterator UnrolledList<Data, NodeCapacity>::end() const noexcept
+  {
+    return ConstIterator(nullptr, this);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  typename UnrolledList<Data, NodeCapacity>::ConstIterator UnrolledList<Data, NodeCapacity>::cbegin() const noexcept
+  {
+    return ConstIterator(head, this);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  typename UnrolledList<Data, NodeCapacity>::ConstIterator UnrolledList<Data, NodeCapacity>::cend() const noexcept
+  {
+    return ConstIterator(nullptr, this);
+  }
+
+  // Specific member function (inherited from ClearableContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::Clear()
+  {
+    Node *current = head;
+    while (current != nullptr)
+    {
+      Node *temp = current;
+      current = current->next;                       // Move to next node before deleting current
+      std::destroy_n(temp->Elements(), temp->count); // Destroy the elements of the node
+      delete temp;                                   // Free memory of current node
+    }
+
+    head = nullptr;
+    tail = nullptr;
+    size = 0;
+  }
+
+  // Protected auxiliary functions
+
+  template <typename Data, ulong NodeCapacity>
+  typename UnrolledList<Data, NodeCapacity>::Node *UnrolledList<Data, NodeCapacity>::Locate(ulong index, ulong &offset) const
+  {
+    if (index < size / 2)
+    {
+      // Closer to the front: skip whole nodes forward from head
+      Node *node = head;
+      while (index >= node->count)
+      {
+        index -= node->count;
+        node = node->next;
+      }
+      offset = index;
+      return node;
+    }
+
+    // Closer to the back: skip whole nodes backward from tail
+    ulong fromBack = size - 1 - index;
+    Node *node = tail;
+    while (fromBack >= node->count)
+    {
+      fromBack -= node->count;
+      node = node->prev;
+    }
+    offset = node->count - 1 - fromBack;
+    return node;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  typename UnrolledList<Data, NodeCapacity>::Node *UnrolledList<Data, NodeCapacity>::LinkNewNode(Node *after)
+  {
+    Node *node = new Node; // Default-initialized: the slots stay raw, not zero-filled
+    node->prev = after;
+    node->next = (after != nullptr) ? after->next : head;
+
+    if (node->prev != nullptr)
+    {
+      node->prev->next = node;
+    }
+    else
+    {
+      head = node;
+    }
+
+    if (node->next != nullptr)
+    {
+      node->next->prev = node;
+    }
+    else
+    {
+      tail = node;
+    }
+
+    return node;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::UnlinkNode(Node *node) noexcept
+  {
+    if (node->prev != nullptr)
+    {
+      node->prev->next = node->next;
+    }
+    else
+    {
+      head = node->next;
+    }
+
+    if (node->next != nullptr)
+    {
+      node->next->prev = node->prev;
+    }
+    else
+    {
+      tail = node->prev;
+    }
+
+    delete node;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::SplitNode(Node *node)
+  {
+    Node *upper = LinkNewNode(node);
+    ulong half = node->count / 2;
+    ulong moved = node->count - half;
+
+    std::uninitialized_move_n(node->Elements() + half, moved, upper->Elements());
+    upper->count = moved;
+    std::destroy_n(node->Elements() + half, moved);
+    node->count = half;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool UnrolledList<Data, NodeCapacity>::MergeNext(Node *node)
+  {
+    Node *next = node->next;
+    if (next == nullptr || node->count + next->count > NodeCapacity)
+    {
+      return false; // The two nodes do not fit into one
+    }
+
+    std::uninitialized_move_n(next->Elements(), next->count, node->Elements() + node->count);
+    std::destroy_n(next->Elements(), next->count);
+    node->count += next->count;
+    UnlinkNode(next);
+    return true;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  template <typename Value>
+  void UnrolledList<Data, NodeCapacity>::InsertInNode(Node *node, ulong offset, Value &&value)
+  {
+    Data *elements = node->Elements();
+    if (offset == node->count)
+    {
+      ::new (static_cast<void *>(elements + offset)) Data(std::forward<Value>(value));
+    }
+    else
+    {
+      Data temp(std::forward<Value>(value)); // value may live in this very node: take it before shifting
+      ::new (static_cast<void *>(elements + node->count)) Data(std::move(elements[node->count - 1]));
+      std::move_backward(elements + offset, elements + node->count - 1, elements + node->count);
+      elements[offset] = std::move(temp);
+    }
+    node->count++;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void UnrolledList<Data, NodeCapacity>::RemoveFromNode(Node *node, ulong offset)
+  {
+    Data *elements = node->Elements();
+    std::move(elements + offset + 1, elements + node->count, elements + offset);
+    std::destroy_at(elements + node->count - 1);
+    node->count--;
+
+    if (node->count == 0)
+    {
+      UnlinkNode(node);
+    }
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  template <typename Value>
+  void UnrolledList<Data, NodeCapacity>::InsertAtPosition(ulong index, Value &&value)
+  {
+    Node *node;
+    ulong offset;
+
+    if (index == size)
+    {
+      // Append: open a new tail node when the current one is full
+      node = (tail == nullptr || tail->count == NodeCapacity) ? LinkNewNode(tail) : tail;
+      offset = node->count;
+    }
+    else if (index == 0 && head->count == NodeCapacity)
+    {
+      // Prepend to a full head: open a new head node instead of splitting
+      node = LinkNewNode(nullptr);
+      offset = 0;
+    }
+    else
+    {
+      node = Locate(index, offset);
+      if (node->count == NodeCapacity)
+      {
+        Data temp(std::forward<Value>(value)); // value may live among the elements the split moves
+        SplitNode(node);
+        if (offset > node->count)
+        {
+          offset -= node->count; // Position fell into the upper half
+          node = node->next;
+        }
+        InsertInNode(node, offset, std::move(temp));
+        size++;
+        return;
+      }
+    }
+
+    try
+    {
+      InsertInNode(node, offset, std::forward<Value>(value));
+    }
+    catch (...)
+    {
+      if (node->count == 0)
+      {
+        UnlinkNode(node); // Do not leave an empty node behind
+      }
+      throw;
+    }
+    size++;
+  }
+
+  /* ************************************************************************** */
+
+}
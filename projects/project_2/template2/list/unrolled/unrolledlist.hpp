@@ -0,0 +1,329 @@
+#ifndef UNROLLEDLIST_HPP
+#define UNROLLEDLIST_HPP
+
+/* ************************************************************************** */
+
+#include <iterator>
+#include <new>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+#include "../../container/linear.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Default number of elements per node: about 256 bytes of elements, at least 4
+  template <typename Data>
+  constexpr ulong UnrolledNodeCapacity = (sizeof(Data) * 4 >= 256) ? 4 : 256 / sizeof(Data);
+
+  /* ************************************************************************** */
+
+  template <typename Data, ulong NodeCapacity = UnrolledNodeCapacity<Data>>
+  class UnrolledList : virtual public MutableLinearContainer<Data>, virtual public ClearableContainer
+  {
+    // Must extend MutableLinearContainer<Data>,
+    //             ClearableContainer
+    // Implementation of a doubly linked list whose nodes store up to
+    // NodeCapacity contiguous elements: indexing walks n/NodeCapacity nodes
+    // and traversals touch far fewer cache lines than List
+
+    static_assert(NodeCapacity >= 2, "UnrolledList nodes must hold at least two elements");
+
+  private:
+    // ...
+
+  protected:
+    using Container::size; // Inherit size member from Container base class
+
+    struct Node
+    {
+      // Node structure for the unrolled list implementation
+
+      // Data
+      Node *next = nullptr; // Pointer to the next node in the list
+      Node *prev = nullptr; // Pointer to the previous node in the list
+      ulong count = 0;      // Number of elements, constructed in slots [0, count)
+
+      alignas(Data) unsigned char storage[NodeCapacity * sizeof(Data)]; // Raw element slots
+
+      /* ********************************************************************** */
+
+      // Specific member functions
+
+      Data *Elements() noexcept { return std::launder(reinterpret_cast<Data *>(storage)); }
+
+      const Data *Elements() const noexcept { return std::launder(reinterpret_cast<const Data *>(storage)); }
+    };
+
+    Node *head = nullptr; // Pointer to first node in the list
+    Node *tail = nullptr; // Pointer to last node in the list
+
+    template <bool Constant>
+    class SlotIterator
+    {
+      // Bidirectional iterator over (node, slot) positions: slots advance
+      // inside a node and roll over to the next one; end() is the null node,
+      // from which a decrement steps back onto the last slot of the tail
+
+      friend class UnrolledList;
+
+      template <bool>
+      friend class SlotIterator;
+
+    public:
+      using iterator_concept = std::bidirectional_iterator_tag;
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type = Data;
+      using difference_type = std::ptrdiff_t;
+      using pointer = std::conditional_t<Constant, const Data *, Data *>;
+      using reference = std::conditional_t<Constant, const Data &, Data &>;
+
+      /* ********************************************************************** */
+
+      // Default constructor
+      SlotIterator() = default;
+
+      // Specific constructor
+      template <bool OtherConstant>
+        requires(Constant && !OtherConstant)
+      SlotIterator(const SlotIterator<OtherConstant> &other) noexcept : current(other.current), slot(other.slot), owner(other.owner) {} // Mutable to read-only conversion
+
+      /* ********************************************************************** */
+
+      // Specific member functions
+
+      reference operator*() const noexcept { return current->Elements()[slot]; }
+      pointer operator->() const noexcept { return current->Elements() + slot; }
+
+      SlotIterator &operator++() noexcept
+      {
+        if (++slot == current->count)
+        {
+          current = current->next;
+          slot = 0;
+        }
+        return *this;
+      }
+
+      SlotIterator operator++(int) noexcept
+      {
+        SlotIterator previous = *this;
+        ++*this;
+        return previous;
+      }
+
+      SlotIterator &operator--() noexcept
+      {
+        if (current == nullptr || slot == 0)
+        {
+          current = (current == nullptr) ? owner->tail : current->prev;
+          slot = current->count;
+        }
+        --slot;
+        return *this;
+      }
+
+      SlotIterator operator--(int) noexcept
+      {
+        SlotIterator previous = *this;
+        --*this;
+        return previous;
+      }
+
+      bool operator==(const SlotIterator &other) const noexcept { return current == other.current && slot == other.slot; }
+
+    private:
+      SlotIterator(Node *node, const UnrolledList *list) noexcept : current(node), owner(list) {}
+
+      Node *current = nullptr;             // Node under the iterator (nullptr past the end)
+      ulong slot = 0;                      // Slot of the element in current
+      const UnrolledList *owner = nullptr; // List walked, to step back from the end
+    };
+
+  public:
+    // Default constructor
+    UnrolledList() = default;
+
+    /* ************************************************************************ */
+
+    // Specific constructor
+    UnrolledList(const TraversableContainer<Data> &container);  // An unrolled list obtained from a TraversableContainer
+    UnrolledList(MappableContainer<Data> &&container) noexcept; // An unrolled list obtained from a MappableContainer
+
+    /* ************************************************************************ */
+
+    // Copy constructor
+    UnrolledList(const UnrolledList &other);
+
+    // Move constructor
+    UnrolledList(UnrolledList &&other) noexcept;
+
+    /* ************************************************************************ */
+
+    // Destructor
+    virtual ~UnrolledList();
+
+    /* ************************************************************************ */
+
+    // Copy assignment
+    UnrolledList &operator=(const UnrolledList &other);
+
+    // Move assignment
+    UnrolledList &operator=(UnrolledList &&other) noexcept;
+
+    /* ************************************************************************ */
+
+    // Comparison operators
+    bool operator==(const UnrolledList &other) const noexcept;
+    bool operator!=(const UnrolledList &other) const noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member functions
+
+    void InsertAtFront(const Data &data); // Insert copy of data at the beginning of the list
+    void InsertAtFront(Data &&data);      // Insert moved data at the beginning of the list
+    void RemoveFromFront();               // Remove first element (must throw std::length_error when empty)
+    Data FrontNRemove();                  // Remove and return first element (must throw std::length_error when empty)
+
+    void InsertAtBack(const Data &data); // Insert copy of data at the end of the list
+    void InsertAtBack(Data &&data);      // Insert moved data at the end of the list
+    void RemoveFromBack();               // Remove last element (must throw std::length_error when empty)
+    Data BackNRemove();                  // Remove and return last element (must throw std::length_error when empty)
+
+    void InsertAt(const ulong index, const Data &data); // Insert copy of data before position index (must throw std::out_of_range when index > size)
+    void InsertAt(const ulong index, Data &&data);      // Insert moved data before position index (must throw std::out_of_range when index > size)
+    void RemoveAt(const ulong index);                   // Remove element at position index (must throw std::out_of_range when index >= size)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from MutableLinearContainer)
+
+    Data &operator[](const ulong index) override; // Access element at index in O(n/NodeCapacity) (mutable version)
+
+    Data &Front() override; // Access first element (mutable version)
+
+    Data &Back() override; // Access last element (mutable version)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from LinearContainer)
+
+    const Data &operator[](const ulong index) const override; // Access element at index in O(n/NodeCapacity) (non-mutable version)
+
+    const Data &Front() const override; // Access first element (non-mutable version)
+
+    const Data &Back() const override; // Access last element (non-mutable version)
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from MappableContainer)
+
+    using typename MappableContainer<Data>::MapFun;
+
+    void Map(MapFun) override; // Apply function to all elements
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from PreOrderMappableContainer)
+
+    void PreOrderMap(MapFun) override; // Apply function to all elements in pre-order (front to back)
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from PostOrderMappableContainer)
+
+    void PostOrderMap(MapFun) override; // Apply function to all elements in post-order (back to front)
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from TraversableContainer)
+
+    using typename TraversableContainer<Data>::TraverseFun;
+
+    void Traverse(TraverseFun) const override; // Apply function to all elements (non-modifying)
+
+    using typename TraversableContainer<Data>::TraverseWhileFun;
+
+    bool TraverseWhile(TraverseWhileFun) const override; // Walk front to back until the function returns false
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from PreOrderTraversableContainer)
+
+    void PreOrderTraverse(TraverseFun) const override; // Apply function to all elements in pre-order (front to back)
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from PostOrderTraversableContainer)
+
+    void PostOrderTraverse(TraverseFun) const override; // Apply function to all elements in post-order (back to front)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (template fast paths, hiding the type-erased ones)
+
+    template <typename Fun>
+    void ForEach(Fun &&) const; // Apply callable to each element, front to back
+
+    template <typename Accumulator, typename Fun>
+    Accumulator Reduce(Fun &&, Accumulator) const; // Fold with any callable, front to back
+
+    template <typename Fun>
+    void MapInPlace(Fun &&); // Apply callable to each element (mutable), front to back
+
+    /* ************************************************************************ */
+
+    // Specific member functions (bidirectional iterators, invalidated by any insertion or removal)
+
+    using Iterator = SlotIterator<false>;
+    using ConstIterator = SlotIterator<true>;
+
+    Iterator begin() noexcept; // First element
+    Iterator end() noexcept;   // Past the last element
+
+    ConstIterator begin() const noexcept; // First element (read-only)
+    ConstIterator end() const noexcept;   // Past the last element (read-only)
+
+    ConstIterator cbegin() const noexcept; // First element (read-only, also on a mutable list)
+    ConstIterator cend() const noexcept;   // Past the last element (read-only, also on a mutable list)
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from ClearableContainer)
+
+    void Clear() override; // Remove all elements from the list
+
+  protected:
+    // Auxiliary functions
+
+    Node *Locate(ulong index, ulong &offset) const; // Node holding position index, offset receives the slot in it
+
+    Node *LinkNewNode(Node *after);       // Link an empty node after the given one (at the front when nullptr)
+    void UnlinkNode(Node *node) noexcept; // Unlink and delete an empty node
+
+    void SplitNode(Node *node); // Move the upper half of a full node into a new node after it
+    bool MergeNext(Node *node); // Absorb the next node when both fit into one (returns true if merged)
+
+    template <typename Value>
+    void InsertInNode(Node *node, ulong offset, Value &&value); // Construct value at slot offset of a non-full node
+
+    void RemoveFromNode(Node *node, ulong offset); // Destroy the element at slot offset, dropping the node when it empties
+
+    template <typename Value>
+    void InsertAtPosition(ulong index, Value &&value); // Shared body of InsertAt
+  };
+
+  /* ************************************************************************** */
+
+}
+
+#include "unrolledlist.cpp" // Include implementation file
+
+#endif
@@ -4,8 +4,8 @@ namespace lasd
   /* ************************************************************************** */
 
   // Default constructor
-  template <typename Data>
-  PQHeap<Data>::PQHeap() : Vector<Data>(), HeapVec<Data>()
+  template <typename Data, ulong Arity, typename Compare>
+  PQHeap<Data, Arity, Compare>::PQHeap() : Vector<Data>(), HeapVec<Data, Arity, Compare>()
   {
     // Default construction - creates empty PQ using HeapVec
   }
@@ -13,16 +13,19 @@ namespace lasd
   /* ************************************************************************** */
 
   // Specific constructors
-  template <typename Data>
-  PQHeap<Data>::PQHeap(const TraversableContainer<Data> &container)
-      : Vector<Data>(container), HeapVec<Data>(container)
+  template <typename Data, ulong Arity, typename Compare>
+  PQHeap<Data, Arity, Compare>::PQHeap(const Compare &order) : Vector<Data>(), HeapVec<Data, Arity, Compare>(order) {}
+
+  template <typename Data, ulong Arity, typename Compare>
+  PQHeap<Data, Arity, Compare>::PQHeap(const TraversableContainer<Data> &container, const Compare &order)
+      : Vector<Data>(container), HeapVec<Data, Arity, Compare>(container, order)
   {
     // Initialize from TraversableContainer - call both Vector and HeapVec constructors explicitly
   }
 
-  template <typename Data>
-  PQHeap<Data>::PQHeap(MappableContainer<Data> &&container)
-      : Vector<Data>(std::move(container)), HeapVec<Data>(std::move(container))
+  template <typename Data, ulong Arity, typename Compare>
+  PQHeap<Data, Arity, Compare>::PQHeap(MappableContainer<Data> &&container, const Compare &order)
+      : Vector<Data>(std::move(container)), HeapVec<Data, Arity, Compare>(std::move(container), order)
   {
     // Initialize from MappableContainer - call both Vector and HeapVec constructors explicitly
   }
@@ -30,17 +33,17 @@ namespace lasd
   /* ************************************************************************** */
 
   // Copy constructor
-  template <typename Data>
-  PQHeap<Data>::PQHeap(const PQHeap<Data> &other)
-      : Vector<Data>(other), HeapVec<Data>(other)
+  template <typename Data, ulong Arity, typename Compare>
+  PQHeap<Data, Arity, Compare>::PQHeap(const PQHeap<Data, Arity, Compare> &other)
+      : Vector<Data>(other), HeapVec<Data, Arity, Compare>(other)
   {
     // Copy construction - call both Vector and HeapVec copy constructors explicitly
   }
 
   // Move constructor
-  template <typename Data>
-  PQHeap<Data>::PQHeap(PQHeap<Data> &&other) noexcept
-      : Vector<Data>(std::move(other)), HeapVec<Data>(std::move(other))
+  template <typename Data, ulong Arity, typename Compare>
+  PQHeap<Data, Arity, Compare>::PQHeap(PQHeap<Data, Arity, Compare> &&other) noexcept
+      : Vector<Data>(std::move(other)), HeapVec<Data, Arity, Compare>(std::move(other))
   {
     // Move construction - call both Vector and HeapVec move constructors explicitly
   }
@@ -48,23 +51,23 @@ namespace lasd
   /* ************************************************************************** */
 
   // Copy assignment
-  template <typename Data>
-  PQHeap<Data> &PQHeap<Data>::operator=(const PQHeap<Data> &other)
+  template <typename Data, ulong Arity, typename Compare>
+  PQHeap<Data, Arity, Compare> &PQHeap<Data, Arity, Compare>::operator=(const PQHeap<Data, Arity, Compare> &other)
   {
     if (this != &other)
     {
-      HeapVec<Data>::operator=(other);
+      HeapVec<Data, Arity, Compare>::operator=(other);
     }
     return *this;
   }
 
   // Move assignment
-  template <typename Data>
-  PQHeap<Data> &PQHeap<Data>::operator=(PQHeap<Data> &&other) noexcept
+  template <typename Data, ulong Arity, typename Compare>
+  PQHeap<Data, Arity, Compare> &PQHeap<Data, Arity, Compare>::operator=(PQHeap<Data, Arity, Compare> &&other) noexcept
   {
     if (this != &other)
     {
-      HeapVec<Data>::operator=(std::move(other));
+      HeapVec<Data, Arity, Compare>::operator=(std::move(other));
     }
     return *this;
   }
@@ -73,104 +76,122 @@ namespace lasd
 
   // Specific member functions (inherited from LinearContainer)
 
-  template <typename Data>
-  const Data &PQHeap<Data>::operator[](const ulong index) const
+  template <typename Data, ulong Arity, typename Compare>
+  const Data &PQHeap<Data, Arity, Compare>::operator[](const ulong index) const
   {
-    return HeapVec<Data>::operator[](index); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::operator[](index); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  Data &PQHeap<Data>::operator[](const ulong index)
+  template <typename Data, ulong Arity, typename Compare>
+  Data &PQHeap<Data, Arity, Compare>::operator[](const ulong index)
   {
-    return HeapVec<Data>::operator[](index); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::operator[](index); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  const Data &PQHeap<Data>::Front() const
+  template <typename Data, ulong Arity, typename Compare>
+  const Data &PQHeap<Data, Arity, Compare>::Front() const
   {
-    return HeapVec<Data>::Front(); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::Front(); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  Data &PQHeap<Data>::Front()
+  template <typename Data, ulong Arity, typename Compare>
+  Data &PQHeap<Data, Arity, Compare>::Front()
   {
-    return HeapVec<Data>::Front(); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::Front(); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  const Data &PQHeap<Data>::Back() const
+  template <typename Data, ulong Arity, typename Compare>
+  const Data &PQHeap<Data, Arity, Compare>::Back() const
   {
-    return HeapVec<Data>::Back(); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::Back(); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  Data &PQHeap<Data>::Back()
+  template <typename Data, ulong Arity, typename Compare>
+  Data &PQHeap<Data, Arity, Compare>::Back()
   {
-    return HeapVec<Data>::Back(); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::Back(); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  bool PQHeap<Data>::Empty() const noexcept
+  template <typename Data, ulong Arity, typename Compare>
+  bool PQHeap<Data, Arity, Compare>::Empty() const noexcept
   {
-    return HeapVec<Data>::Empty(); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::Empty(); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  ulong PQHeap<Data>::Size() const noexcept
+  template <typename Data, ulong Arity, typename Compare>
+  ulong PQHeap<Data, Arity, Compare>::Size() const noexcept
   {
-    return HeapVec<Data>::Size(); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::Size(); // Access HeapVec through inheritance
   }
 
   // Traversal and mapping functions (da TraversableContainer/MappableContainer)
-  template <typename Data>
-  void PQHeap<Data>::Traverse(typename TraversableContainer<Data>::TraverseFun fun) const
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::Traverse(typename TraversableContainer<Data>::TraverseFun fun) const
+  {
+    HeapVec<Data, Arity, Compare>::Traverse(fun); // Access HeapVec through inheritance
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::PreOrderTraverse(typename TraversableContainer<Data>::TraverseFun fun) const
+  {
+    HeapVec<Data, Arity, Compare>::PreOrderTraverse(fun); // Access HeapVec through inheritance
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::PostOrderTraverse(typename TraversableContainer<Data>::TraverseFun fun) const
+  {
+    HeapVec<Data, Arity, Compare>::PostOrderTraverse(fun); // Access HeapVec through inheritance
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::Map(typename MappableContainer<Data>::MapFun fun)
   {
-    HeapVec<Data>::Traverse(fun); // Access HeapVec through inheritance
+    HeapVec<Data, Arity, Compare>::Map(fun); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  void PQHeap<Data>::PreOrderTraverse(typename TraversableContainer<Data>::TraverseFun fun) const
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::PreOrderMap(typename MappableContainer<Data>::MapFun fun)
   {
-    HeapVec<Data>::PreOrderTraverse(fun); // Access HeapVec through inheritance
+    HeapVec<Data, Arity, Compare>::PreOrderMap(fun); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  void PQHeap<Data>::PostOrderTraverse(typename TraversableContainer<Data>::TraverseFun fun) const
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::PostOrderMap(typename MappableContainer<Data>::MapFun fun)
   {
-    HeapVec<Data>::PostOrderTraverse(fun); // Access HeapVec through inheritance
+    HeapVec<Data, Arity, Compare>::PostOrderMap(fun); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  void PQHeap<Data>::Map(typename MappableContainer<Data>::MapFun fun)
+  template <typename Data, ulong Arity, typename Compare>
+  bool PQHeap<Data, Arity, Compare>::TraverseWhile(typename TraversableContainer<Data>::TraverseWhileFun fun) const
   {
-    HeapVec<Data>::Map(fun); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::TraverseWhile(fun); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  void PQHeap<Data>::PreOrderMap(typename MappableContainer<Data>::MapFun fun)
+  template <typename Data, ulong Arity, typename Compare>
+  bool PQHeap<Data, Arity, Compare>::Exists(const Data &data) const noexcept
   {
-    HeapVec<Data>::PreOrderMap(fun); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::Exists(data); // Access HeapVec through inheritance
   }
 
-  template <typename Data>
-  void PQHeap<Data>::PostOrderMap(typename MappableContainer<Data>::MapFun fun)
+  template <typename Data, ulong Arity, typename Compare>
+  typename PQHeap<Data, Arity, Compare>::ConstIterator PQHeap<Data, Arity, Compare>::begin() const noexcept
   {
-    HeapVec<Data>::PostOrderMap(fun); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::cbegin(); // Read-only: writing through it could break the heap property
   }
 
-  template <typename Data>
-  bool PQHeap<Data>::Exists(const Data &data) const noexcept
+  template <typename Data, ulong Arity, typename Compare>
+  typename PQHeap<Data, Arity, Compare>::ConstIterator PQHeap<Data, Arity, Compare>::end() const noexcept
   {
-    return HeapVec<Data>::Exists(data); // Access HeapVec through inheritance
+    return HeapVec<Data, Arity, Compare>::cend();
   }
 
   /* ************************************************************************** */
 
   // Specific member functions (inherited from ClearableContainer)
-  template <typename Data>
-  void PQHeap<Data>::Clear()
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::Clear()
   {
-    HeapVec<Data>::Clear(); // Access HeapVec through inheritance
+    HeapVec<Data, Arity, Compare>::Clear(); // Access HeapVec through inheritance
   }
 
   /* ************************************************************************ */
@@ -178,21 +199,21 @@ namespace lasd
   // Specific member functions (inherited from PQ)
 
   // Tip function - returns the maximum element (root of max heap)
-  template <typename Data>
-  const Data &PQHeap<Data>::Tip() const
+  template <typename Data, ulong Arity, typename Compare>
+  const Data &PQHeap<Data, Arity, Compare>::Tip() const
   {
-    if (HeapVec<Data>::Empty())
+    if (HeapVec<Data, Arity, Compare>::Empty())
     {
       throw std::length_error("Priority queue is empty");
     }
-    return HeapVec<Data>::operator[](0); // Root is at index 0
+    return HeapVec<Data, Arity, Compare>::operator[](0); // Root is at index 0
   }
 
   // RemoveTip function - removes the maximum element
-  template <typename Data>
-  void PQHeap<Data>::RemoveTip()
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::RemoveTip()
   {
-    if (HeapVec<Data>::Empty())
+    if (HeapVec<Data, Arity, Compare>::Empty())
     {
       throw std::length_error("Priority queue is empty");
     }
@@ -203,52 +224,50 @@ namespace lasd
     }
     else
     {
-      elements[0] = std::move(elements[size - 1]);
+      Data last = std::move(elements[size - 1]);
       Vector<Data>::Resize(size - 1);
-      HeapifyDown(0);
+      SiftRootBottomUp(std::move(last), size); // The old tip is overwritten on the way down
     }
   }
 
   // TipNRemove function - returns and removes the maximum element
-  template <typename Data>
-  Data PQHeap<Data>::TipNRemove()
+  template <typename Data, ulong Arity, typename Compare>
+  Data PQHeap<Data, Arity, Compare>::TipNRemove()
   {
-    if (HeapVec<Data>::Empty())
+    if (HeapVec<Data, Arity, Compare>::Empty())
     {
       throw std::length_error("Priority queue is empty");
     }
-    Data tip = HeapVec<Data>::operator[](0); // Save the root element
-    RemoveTip();                             // Remove the root
+    Data tip = std::move(elements[0]); // Move the root element out
+    RemoveTip();                       // Remove the (moved-from) root
     return tip;
   }
 
   // Insert function - copy version
-  template <typename Data>
-  void PQHeap<Data>::Insert(const Data &value)
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::Insert(const Data &value)
   {
-    Vector<Data>::Resize(size + 1);
-    elements[size - 1] = value;
+    Vector<Data>::PushBack(value); // Amortized constant time append
     HeapifyUp(size - 1);
   }
 
   // Insert function - move version
-  template <typename Data>
-  void PQHeap<Data>::Insert(Data &&value)
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::Insert(Data &&value)
   {
-    Vector<Data>::Resize(size + 1);
-    elements[size - 1] = std::move(value);
+    Vector<Data>::PushBack(std::move(value)); // Amortized constant time append
     HeapifyUp(size - 1);
   }
 
   // Change function - copy version
-  template <typename Data>
-  void PQHeap<Data>::Change(ulong index, const Data &value)
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::Change(ulong index, const Data &value)
   {
-    if (index >= HeapVec<Data>::Size())
+    if (index >= HeapVec<Data, Arity, Compare>::Size())
     {
       throw std::out_of_range("Vector: Index out of range");
     }
-    HeapVec<Data>::operator[](index) = value; // Change the value
+    HeapVec<Data, Arity, Compare>::operator[](index) = value; // Change the value
 
     // Restore heap property by trying both directions
     HeapifyUp(index);   // Check if we need to bubble up
@@ -256,14 +275,14 @@ namespace lasd
   }
 
   // Change function - move version
-  template <typename Data>
-  void PQHeap<Data>::Change(ulong index, Data &&value)
+  template <typename Data, ulong Arity, typename Compare>
+  void PQHeap<Data, Arity, Compare>::Change(ulong index, Data &&value)
   {
-    if (index >= HeapVec<Data>::Size())
+    if (index >= HeapVec<Data, Arity, Compare>::Size())
     {
       throw std::out_of_range("Vector: Index out of range");
     }
-    HeapVec<Data>::operator[](index) = std::move(value); // Change the value with move
+    HeapVec<Data, Arity, Compare>::operator[](index) = std::move(value); // Change the value with move
 
     // Restore heap property by trying both directions
     HeapifyUp(index);   // Check if we need to bubble up
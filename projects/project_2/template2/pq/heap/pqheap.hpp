@@ -13,12 +13,15 @@ namespace lasd
 
   /* ************************************************************************** */
 
-  template <typename Data>
+  template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
   class PQHeap : virtual public PQ<Data>,
-                 private HeapVec<Data>
+                 private HeapVec<Data, Arity, Compare>
   {
     // Must extend PQ<Data>,
     // Could extend HeapVec<Data>
+    // Arity: children per heap node (see HeapVec)
+    // Compare: the tip is the last element in Compare order (std::greater
+    // gives a min-priority queue)
 
   private:
     // ...
@@ -27,11 +30,10 @@ namespace lasd
     using Container::size;
 
     // Import specific functions from HeapVec
-    using HeapVec<Data>::HeapifyUp;
-    using HeapVec<Data>::HeapifyDown;
-    using HeapVec<Data>::elements;
-
-    // ...
+    using HeapVec<Data, Arity, Compare>::HeapifyUp;
+    using HeapVec<Data, Arity, Compare>::HeapifyDown;
+    using HeapVec<Data, Arity, Compare>::SiftRootBottomUp;
+    using HeapVec<Data, Arity, Compare>::elements;
 
   public:
     // Default constructor
@@ -40,8 +42,9 @@ namespace lasd
     /* ************************************************************************ */
 
     // Specific constructors
-    PQHeap(const TraversableContainer<Data> &); // A priority queue obtained from a TraversableContainer
-    PQHeap(MappableContainer<Data> &&);         // A priority queue obtained from a MappableContainer
+    explicit PQHeap(const Compare &);                                        // An empty priority queue ordered by the given comparator
+    PQHeap(const TraversableContainer<Data> &, const Compare & = Compare()); // A priority queue obtained from a TraversableContainer
+    PQHeap(MappableContainer<Data> &&, const Compare & = Compare());         // A priority queue obtained from a MappableContainer
 
     /* ************************************************************************ */
 
@@ -89,8 +92,31 @@ namespace lasd
     void PreOrderMap(typename MappableContainer<Data>::MapFun) override;
     void PostOrderMap(typename MappableContainer<Data>::MapFun) override;
 
+    bool TraverseWhile(typename TraversableContainer<Data>::TraverseWhileFun) const override;
+
     bool Exists(const Data &) const noexcept override;
 
+    using HeapVec<Data, Arity, Compare>::ForEach; // Template traversal fast path (heap array order)
+    using HeapVec<Data, Arity, Compare>::Reduce;  // Template fold fast path (heap array order)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (read-only contiguous iterators, heap array order)
+
+    using ConstIterator = typename HeapVec<Data, Arity, Compare>::ConstIterator;
+
+    ConstIterator begin() const noexcept; // Tip of the queue
+    ConstIterator end() const noexcept;   // Past the last heap slot
+
+    using HeapVec<Data, Arity, Compare>::cbegin;
+    using HeapVec<Data, Arity, Compare>::cend;
+
+    /* ************************************************************************ */
+
+    // Specific member functions
+
+    using HeapVec<Data, Arity, Compare>::Comparator; // The ordering of the queue
+
     /* ************************************************************************ */
 
     // Specific member functions (inherited from ClearableContainer)
@@ -0,0 +1,542 @@
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Specific constructors
+  template <typename Data, ulong Arity, typename Compare>
+  PQIndexed<Data, Arity, Compare>::PQIndexed(const Compare &order) : compare(order) {}
+
+  template <typename Data, ulong Arity, typename Compare>
+  PQIndexed<Data, Arity, Compare>::PQIndexed(const TraversableContainer<Data> &container, const Compare &order) : compare(order)
+  {
+    entries.Reserve(container.Size());
+    container.Traverse([this](const Data &data)
+                       { entries.PushBack(Entry{data, entries.Size()}); });
+    Build();
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  PQIndexed<Data, Arity, Compare>::PQIndexed(MappableContainer<Data> &&container, const Compare &order) : compare(order)
+  {
+    entries.Reserve(container.Size());
+    container.Map([this](Data &data)
+                  { entries.PushBack(Entry{std::move(data), entries.Size()}); });
+    Build();
+  }
+
+  /* ************************************************************************** */
+
+  // Copy constructor
+  template <typename Data, ulong Arity, typename Compare>
+  PQIndexed<Data, Arity, Compare>::PQIndexed(const PQIndexed<Data, Arity, Compare> &other)
+      : entries(other.entries), positions(other.positions), generations(other.generations), freeSlot(other.freeSlot), compare(other.compare)
+  {
+    size = entries.Size();
+  }
+
+  // Move constructor
+  template <typename Data, ulong Arity, typename Compare>
+  PQIndexed<Data, Arity, Compare>::PQIndexed(PQIndexed<Data, Arity, Compare> &&other) noexcept
+      : entries(std::move(other.entries)), positions(std::move(other.positions)), generations(std::move(other.generations)),
+        freeSlot(std::exchange(other.freeSlot, NoSlot)), compare(other.compare)
+  {
+    size = entries.Size();
+    other.size = 0;
+  }
+
+  /* ************************************************************************** */
+
+  // Copy assignment
+  template <typename Data, ulong Arity, typename Compare>
+  PQIndexed<Data, Arity, Compare> &PQIndexed<Data, Arity, Compare>::operator=(const PQIndexed<Data, Arity, Compare> &other)
+  {
+    if (this != &other)
+    {
+      PQIndexed<Data, Arity, Compare> copy(other); // Copy first: a failed copy leaves this queue as it was
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  // Move assignment
+  template <typename Data, ulong Arity, typename Compare>
+  PQIndexed<Data, Arity, Compare> &PQIndexed<Data, Arity, Compare>::operator=(PQIndexed<Data, Arity, Compare> &&other) noexcept
+  {
+    if (this != &other)
+    {
+      entries = std::move(other.entries); // Vector move assignments swap: other gets the previous contents
+      positions = std::move(other.positions);
+      generations = std::move(other.generations);
+      std::swap(freeSlot, other.freeSlot);
+      std::swap(compare, other.compare);
+      size = entries.Size();
+      other.size = other.entries.Size();
+    }
+    return *this;
+  }
+
+  /* ************************************************************************** */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  template <typename Data, ulong Arity, typename Compare>
+  const Data &PQIndexed<Data, Arity, Compare>::operator[](const ulong index) const
+  {
+    if (index >= size)
+    {
+      throw std::out_of_range("PQIndexed: Index out of range");
+    }
+    return entries[index].value;
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  const Data &PQIndexed<Data, Arity, Compare>::Front() const
+  {
+    return Tip();
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  const Data &PQIndexed<Data, Arity, Compare>::Back() const
+  {
+    if (size == 0)
+    {
+      throw std::length_error("PQIndexed: Empty container");
+    }
+    return entries[size - 1].value;
+  }
+
+  // Specific member function (inherited from TestableContainer)
+
+  template <typename Data, ulong Arity, typename Compare>
+  bool PQIndexed<Data, Arity, Compare>::Exists(const Data &data) const noexcept
+  {
+    for (const Entry &entry : entries)
+    {
+      if (entry.value == data)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Specific member function (inherited from ClearableContainer)
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Clear()
+  {
+    entries.Clear();
+    size = 0;
+
+    // Every live slot turns stale; the whole table becomes the free list, lowest slot first
+    freeSlot = NoSlot;
+    for (ulong slot = generations.Size(); slot > 0; --slot)
+    {
+      if (generations[slot - 1] % 2 == 1)
+      {
+        generations[slot - 1]++;
+      }
+      positions[slot - 1] = freeSlot;
+      freeSlot = slot - 1;
+    }
+  }
+
+  /* ************************************************************************** */
+
+  // Specific member functions (inherited from PQ)
+
+  template <typename Data, ulong Arity, typename Compare>
+  const Data &PQIndexed<Data, Arity, Compare>::Tip() const
+  {
+    if (size == 0)
+    {
+      throw std::length_error("PQIndexed: Empty container");
+    }
+    return entries[0].value;
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::RemoveTip()
+  {
+    if (size == 0)
+    {
+      throw std::length_error("PQIndexed: Empty container");
+    }
+    RemoveAt(0);
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  Data PQIndexed<Data, Arity, Compare>::TipNRemove()
+  {
+    if (size == 0)
+    {
+      throw std::length_error("PQIndexed: Empty container");
+    }
+    Data tip = std::move(entries[0].value); // The root is overwritten on the way down
+    RemoveAt(0);
+    return tip;
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Insert(const Data &value)
+  {
+    PushValue(value);
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Insert(Data &&value)
+  {
+    PushValue(std::move(value));
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Change(ulong index, const Data &value)
+  {
+    if (index >= size)
+    {
+      throw std::out_of_range("PQIndexed: Index out of range");
+    }
+    ChangeAt(index, value);
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Change(ulong index, Data &&value)
+  {
+    if (index >= size)
+    {
+      throw std::out_of_range("PQIndexed: Index out of range");
+    }
+    ChangeAt(index, std::move(value));
+  }
+
+  /* ************************************************************************** */
+
+  // Specific member functions (handles)
+
+  template <typename Data, ulong Arity, typename Compare>
+  typename PQIndexed<Data, Arity, Compare>::Handle PQIndexed<Data, Arity, Compare>::Push(const Data &value)
+  {
+    return PushValue(value);
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  typename PQIndexed<Data, Arity, Compare>::Handle PQIndexed<Data, Arity, Compare>::Push(Data &&value)
+  {
+    return PushValue(std::move(value));
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  bool PQIndexed<Data, Arity, Compare>::Contains(Handle handle) const noexcept
+  {
+    const ulong slot = handle & 0xFFFFFFFFUL;
+    const ulong generation = handle >> 32;
+    return slot < generations.Size() && generations[slot] == generation && generation % 2 == 1;
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  const Data &PQIndexed<Data, Arity, Compare>::Value(Handle handle) const
+  {
+    return entries[Locate(handle)].value;
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::ChangeKey(Handle handle, const Data &value)
+  {
+    ChangeAt(Locate(handle), value);
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::ChangeKey(Handle handle, Data &&value)
+  {
+    ChangeAt(Locate(handle), std::move(value));
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Remove(Handle handle)
+  {
+    RemoveAt(Locate(handle));
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  typename PQIndexed<Data, Arity, Compare>::Handle PQIndexed<Data, Arity, Compare>::TipHandle() const
+  {
+    if (size == 0)
+    {
+      throw std::length_error("PQIndexed: Empty container");
+    }
+    return HandleAt(0);
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  typename PQIndexed<Data, Arity, Compare>::Handle PQIndexed<Data, Arity, Compare>::HandleAt(const ulong index) const
+  {
+    if (index >= size)
+    {
+      throw std::out_of_range("PQIndexed: Index out of range");
+    }
+    const ulong slot = entries[index].slot;
+    return (static_cast<ulong>(generations[slot]) << 32) | slot;
+  }
+
+  /* ************************************************************************** */
+
+  // Specific member functions
+
+  template <typename Data, ulong Arity, typename Compare>
+  Compare PQIndexed<Data, Arity, Compare>::Comparator() const
+  {
+    return compare;
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Reserve(const ulong count)
+  {
+    entries.Reserve(count);
+    positions.Reserve(count);
+    generations.Reserve(count);
+  }
+
+  /* ************************************************************************** */
+
+  // Auxiliary functions
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Put(ulong position, Entry &&entry)
+  {
+    positions[entry.slot] = position;
+    entries[position] = std::move(entry);
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::SiftUp(ulong position, Entry &&entry)
+  {
+    while (position > 0)
+    {
+      const ulong parent = Parent(position);
+      if (!compare(entries[parent].value, entry.value))
+      {
+        break;
+      }
+      Put(position, std::move(entries[parent]));
+      position = parent;
+    }
+    Put(position, std::move(entry));
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::SiftDown(ulong position, Entry &&entry)
+  {
+    for (ulong first = FirstChild(position); first < size; first = FirstChild(position))
+    {
+      const ulong largest = LargestChild(first);
+      if (!compare(entry.value, entries[largest].value))
+      {
+        break;
+      }
+      Put(position, std::move(entries[largest]));
+      position = largest;
+    }
+    Put(position, std::move(entry));
+  }
+
+  // Same as HeapVec::SiftRootBottomUp: the hole sinks along the largest
+  // children to a leaf, then the entry rises from there
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::SiftRootBottomUp(Entry &&entry)
+  {
+    ulong hole = 0;
+    for (ulong first = FirstChild(hole); first < size; first = FirstChild(hole))
+    {
+      const ulong largest = LargestChild(first);
+      Put(hole, std::move(entries[largest]));
+      hole = largest;
+    }
+    SiftUp(hole, std::move(entry));
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Restore(ulong position, Entry &&entry)
+  {
+    if (position > 0 && compare(entries[Parent(position)].value, entry.value))
+    {
+      SiftUp(position, std::move(entry));
+    }
+    else
+    {
+      SiftDown(position, std::move(entry));
+    }
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::RemoveAt(ulong position)
+  {
+    const ulong slot = entries[position].slot;
+    Entry last = std::move(entries[size - 1]);
+    entries.Resize(size - 1);
+    size--;
+    Release(slot);
+
+    if (position < size) // Otherwise the removed element was the last one
+    {
+      if (position == 0)
+      {
+        SiftRootBottomUp(std::move(last));
+      }
+      else
+      {
+        Restore(position, std::move(last));
+      }
+    }
+  }
+
+  // Get the largest of the children starting at first (which must be inside the heap)
+  template <typename Data, ulong Arity, typename Compare>
+  ulong PQIndexed<Data, Arity, Compare>::LargestChild(ulong first) const
+  {
+    const ulong last = (first + Arity < size) ? first + Arity : size; // Past the last child inside the heap
+    ulong largest = first;
+    for (ulong child = first + 1; child < last; ++child)
+    {
+      if (compare(entries[largest].value, entries[child].value))
+      {
+        largest = child;
+      }
+    }
+    return largest;
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  ulong PQIndexed<Data, Arity, Compare>::Acquire()
+  {
+    ulong slot = freeSlot;
+    if (slot == NoSlot)
+    {
+      slot = generations.Size();
+      if (slot > 0xFFFFFFFFUL) // Slots must fit in 32 bits
+      {
+        throw std::length_error("PQIndexed: Too many elements");
+      }
+      positions.PushBack(NoSlot);
+      generations.PushBack(0);
+    }
+    else
+    {
+      freeSlot = positions[slot];
+    }
+    generations[slot]++; // Odd: live
+    return slot;
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Release(ulong slot)
+  {
+    generations[slot]++; // Even: free, and every handle to it is stale
+    positions[slot] = freeSlot;
+    freeSlot = slot;
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  ulong PQIndexed<Data, Arity, Compare>::Locate(Handle handle) const
+  {
+    if (!Contains(handle))
+    {
+      throw std::out_of_range("PQIndexed: Invalid handle");
+    }
+    return positions[handle & 0xFFFFFFFFUL];
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  template <typename Item>
+  typename PQIndexed<Data, Arity, Compare>::Handle PQIndexed<Data, Arity, Compare>::PushValue(Item &&value)
+  {
+    Entry entry{Data(std::forward<Item>(value)), 0};
+
+    // Room first (doubling, as PushBack would): once the slot is taken nothing below can throw
+    if (size == entries.Capacity())
+    {
+      entries.Reserve(2 * size + 1);
+    }
+    if (freeSlot == NoSlot)
+    {
+      const ulong slots = generations.Size();
+      if (slots == positions.Capacity())
+      {
+        positions.Reserve(2 * slots + 1);
+      }
+      if (slots == generations.Capacity())
+      {
+        generations.Reserve(2 * slots + 1);
+      }
+    }
+
+    const ulong slot = Acquire();
+    entry.slot = slot;
+    entries.PushBack(std::move(entry));
+    const ulong position = size++;
+    if (position > 0 && compare(entries[Parent(position)].value, entries[position].value))
+    {
+      Entry lifted = std::move(entries[position]);
+      SiftUp(position, std::move(lifted));
+    }
+    else
+    {
+      positions[slot] = position; // Already in place: nothing moves
+    }
+    return (static_cast<ulong>(generations[slot]) << 32) | slot;
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  template <typename Item>
+  void PQIndexed<Data, Arity, Compare>::ChangeAt(ulong position, Item &&value)
+  {
+    Entry entry{Data(std::forward<Item>(value)), entries[position].slot};
+    Restore(position, std::move(entry)); // The previous element is overwritten
+  }
+
+  template <typename Data, ulong Arity, typename Compare>
+  void PQIndexed<Data, Arity, Compare>::Build()
+  {
+    size = entries.Size();
+    if (size > (1UL << 32)) // Slots must fit in 32 bits
+    {
+      entries.Clear();
+      size = 0;
+      throw std::length_error("PQIndexed: Too many elements");
+    }
+
+    // Slot i for the i-th element loaded, generation 1, then heapify bottom-up
+    positions.Resize(size);
+    generations.Resize(size);
+    for (ulong slot = 0; slot < size; slot++)
+    {
+      positions[slot] = slot;
+      generations[slot] = 1;
+    }
+    if (size > 1)
+    {
+      for (ulong i = Parent(size - 1) + 1; i > 0; --i)
+      {
+        Entry entry = std::move(entries[i - 1]);
+        SiftDown(i - 1, std::move(entry));
+      }
+    }
+  }
+
+  // Get the index of the first child
+  template <typename Data, ulong Arity, typename Compare>
+  ulong PQIndexed<Data, Arity, Compare>::FirstChild(ulong index) const noexcept
+  {
+    return (Arity * index) + 1;
+  }
+
+  // Get parent index
+  template <typename Data, ulong Arity, typename Compare>
+  ulong PQIndexed<Data, Arity, Compare>::Parent(ulong index) const noexcept
+  {
+    return (index - 1) / Arity;
+  }
+
+  /* ************************************************************************** */
+
+}
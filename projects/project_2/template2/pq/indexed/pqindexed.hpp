@@ -0,0 +1,191 @@
+#ifndef PQINDEXED_HPP
+#define PQINDEXED_HPP
+
+/* ************************************************************************** */
+
+#include <utility>
+
+#include "../pq.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
+  class PQIndexed : virtual public PQ<Data>
+  {
+    // Must extend PQ<Data>
+    // Arity, Compare: as in PQHeap (the tip is the last element in Compare order)
+
+    // Addressable priority queue: Push returns a handle that keeps naming the
+    // same element while the heap reorders, until the element leaves the queue.
+    // Every element sits in a slot; the slot records where the element is in
+    // the heap and every sift updates it, so a handle finds its element in
+    // O(1) and ChangeKey and Remove cost one sift, O(log n).
+    // A handle packs the slot (low 32 bits) and the slot generation (high 32
+    // bits, odd while the slot is in use): a slot freed and reused gets a new
+    // generation, so stale handles are refused instead of naming a newcomer.
+
+    static_assert(Arity >= 2, "PQIndexed: Arity must be at least 2");
+
+  private:
+    // ...
+
+  protected:
+    using Container::size;
+
+    // Heap node: the element and the slot that addresses it
+    struct Entry
+    {
+      Data value;
+      ulong slot = 0;
+
+      bool operator==(const Entry &) const = default;
+    };
+
+    static constexpr ulong NoSlot = ~0UL; // End of the free slot list
+
+    Vector<Entry> entries;    // The heap, level by level
+    Vector<ulong> positions;  // Per slot: heap position of its element, or the next free slot
+    Vector<uint> generations; // Per slot: odd while the slot holds an element
+    ulong freeSlot = NoSlot;  // First free slot (lowest after a Clear)
+
+    [[no_unique_address]] Compare compare = Compare(); // Takes no space when stateless
+
+  public:
+    using Handle = ulong;
+
+    // Default constructor
+    PQIndexed() = default;
+
+    /* ************************************************************************ */
+
+    // Specific constructors (one heapify pass, O(n); handles through TipHandle and HandleAt)
+    explicit PQIndexed(const Compare &);                                        // An empty priority queue ordered by the given comparator
+    PQIndexed(const TraversableContainer<Data> &, const Compare & = Compare()); // A priority queue obtained from a TraversableContainer
+    PQIndexed(MappableContainer<Data> &&, const Compare & = Compare());         // A priority queue obtained from a MappableContainer
+
+    /* ************************************************************************ */
+
+    // Copy constructor (the handles of the original address the same elements in the copy)
+    PQIndexed(const PQIndexed &);
+
+    // Move constructor
+    PQIndexed(PQIndexed &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Destructor
+    virtual ~PQIndexed() = default;
+
+    /* ************************************************************************ */
+
+    // Copy assignment
+    PQIndexed &operator=(const PQIndexed &);
+
+    // Move assignment
+    PQIndexed &operator=(PQIndexed &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from LinearContainer, heap array order)
+
+    const Data &operator[](const ulong) const override; // Element at a heap position (must throw std::out_of_range when out of range)
+
+    const Data &Front() const override; // Tip of the queue (must throw std::length_error when empty)
+    const Data &Back() const override;  // Last heap slot (must throw std::length_error when empty)
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from TestableContainer)
+
+    bool Exists(const Data &) const noexcept override; // Scan the heap array
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from ClearableContainer)
+
+    void Clear() override; // Remove every element: every handle becomes stale
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from PQ)
+
+    const Data &Tip() const override; // Override PQ member (must throw std::length_error when empty)
+    void RemoveTip() override;        // Override PQ member (must throw std::length_error when empty)
+    Data TipNRemove() override;       // Override PQ member (must throw std::length_error when empty)
+
+    void Insert(const Data &) override; // Override PQ member (Copy of the value; Push also returns the handle)
+    void Insert(Data &&) override;      // Override PQ member (Move of the value; Push also returns the handle)
+
+    void Change(ulong, const Data &) override; // Override PQ member (heap position; must throw std::out_of_range when out of range)
+    void Change(ulong, Data &&) override;      // Override PQ member (heap position; must throw std::out_of_range when out of range)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (handles: O(log n) updates, O(1) lookups;
+    // those taking a handle must throw std::out_of_range when it is stale)
+
+    Handle Push(const Data &); // Insert a copy of the value and return its handle
+    Handle Push(Data &&);      // Insert the moved value and return its handle
+
+    bool Contains(Handle) const noexcept; // Whether the handle names an element of the queue
+    const Data &Value(Handle) const;      // Element named by the handle
+
+    void ChangeKey(Handle, const Data &); // Replace the element named by the handle (Copy of the value), either direction
+    void ChangeKey(Handle, Data &&);      // Replace the element named by the handle (Move of the value), either direction
+
+    void Remove(Handle); // Remove the element named by the handle (the handle becomes stale)
+
+    Handle TipHandle() const;           // Handle of the tip (must throw std::length_error when empty)
+    Handle HandleAt(const ulong) const; // Handle of the element at a heap position (must throw std::out_of_range when out of range)
+
+    /* ************************************************************************ */
+
+    // Specific member functions
+
+    Compare Comparator() const; // The ordering of the queue
+
+    void Reserve(const ulong); // Make room for the given number of elements (and slots) at once
+
+  protected:
+    // Auxiliary functions
+
+    // Sifting moves the entry out once and shifts the others through the
+    // hole, updating the position of every entry that moves
+
+    void Put(ulong, Entry &&);       // Store the entry at a heap position and record the position in its slot
+    void SiftUp(ulong, Entry &&);    // Fill the hole at a position with the entry, moving smaller parents down
+    void SiftDown(ulong, Entry &&);  // Fill the hole at a position with the entry, moving larger children up
+    void SiftRootBottomUp(Entry &&); // Fill the hole at the root with the entry (Floyd bottom-up)
+    void Restore(ulong, Entry &&);   // Fill the hole at a position with the entry, moving it either way
+    void RemoveAt(ulong);            // Remove the element at a heap position and free its slot
+    ulong LargestChild(ulong) const; // Largest of the children from the given first one
+
+    ulong Acquire();            // Take a free slot, or a new one (the slot becomes live)
+    void Release(ulong);        // Put a slot back on the free list (its handles become stale)
+    ulong Locate(Handle) const; // Heap position of the element named by the handle (must throw std::out_of_range when stale)
+
+    template <typename Item>
+    Handle PushValue(Item &&); // Insert a copied or moved value
+
+    template <typename Item>
+    void ChangeAt(ulong, Item &&); // Replace the element at a heap position with a copied or moved value
+
+    void Build(); // Give the bulk-loaded entries one slot each and heapify them
+
+    ulong FirstChild(ulong) const noexcept; // Get the index of the first of the Arity children
+    ulong Parent(ulong) const noexcept;     // Get parent index
+  };
+
+  /* ************************************************************************** */
+
+}
+
+#include "pqindexed.cpp"
+
+#endif
@@ -0,0 +1,1018 @@
+namespace lasd
+{
+  /* ************************************************************************** */
+
+  // Specific constructors
+
+  template <typename Data, template <typename> class Allocator>
+  SetAvl<Data, Allocator>::SetAvl(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> staged(container); // Sorting an array beats a search per element
+    BuildSorted(staged, false);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  SetAvl<Data, Allocator>::SetAvl(MappableContainer<Data> &&container) noexcept
+  {
+    Vector<Data> staged(std::move(container)); // Elements are moved through the array into the nodes
+    BuildSorted(staged, false);
+  }
+
+  // Specific factories
+
+  template <typename Data, template <typename> class Allocator>
+  SetAvl<Data, Allocator> SetAvl<Data, Allocator>::FromSorted(const TraversableContainer<Data> &container)
+  {
+    SetAvl<Data, Allocator> set;
+    Vector<Data> staged(container); // The middle element goes first: the input is needed by position
+    set.BuildSorted(staged, true);
+    return set;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  SetAvl<Data, Allocator> SetAvl<Data, Allocator>::FromSorted(MappableContainer<Data> &&container)
+  {
+    SetAvl<Data, Allocator> set;
+    Vector<Data> staged(std::move(container));
+    set.BuildSorted(staged, true);
+    return set;
+  }
+
+  // Copy constructor
+  template <typename Data, template <typename> class Allocator>
+  SetAvl<Data, Allocator>::SetAvl(const SetAvl<Data, Allocator> &other)
+  {
+    root = CloneSubtree(other.root, nullptr); // Other is already balanced: keep its shape
+    first = (root == nullptr) ? nullptr : Leftmost(root);
+    last = (root == nullptr) ? nullptr : Rightmost(root);
+    size = other.size;
+  }
+
+  // Move constructor
+  template <typename Data, template <typename> class Allocator>
+  SetAvl<Data, Allocator>::SetAvl(SetAvl<Data, Allocator> &&other) noexcept
+  {
+    std::swap(root, other.root);
+    std::swap(first, other.first);
+    std::swap(last, other.last);
+    std::swap(size, other.size);
+    std::swap(allocator, other.allocator); // The nodes may live in storage owned by other
+  }
+
+  // Destructor
+  template <typename Data, template <typename> class Allocator>
+  SetAvl<Data, Allocator>::~SetAvl()
+  {
+    Clear();
+  }
+
+  // Copy assignment
+  template <typename Data, template <typename> class Allocator>
+  SetAvl<Data, Allocator> &SetAvl<Data, Allocator>::operator=(const SetAvl<Data, Allocator> &other)
+  {
+    if (this != &other)
+    {
+      SetAvl<Data, Allocator> copy(other);
+      *this = std::move(copy); // The old nodes leave with copy
+    }
+    return *this;
+  }
+
+  // Move assignment
+  template <typename Data, template <typename> class Allocator>
+  SetAvl<Data, Allocator> &SetAvl<Data, Allocator>::operator=(SetAvl<Data, Allocator> &&other) noexcept
+  {
+    if (this != &other)
+    {
+      std::swap(root, other.root);
+      std::swap(first, other.first);
+      std::swap(last, other.last);
+      std::swap(size, other.size);
+      std::swap(allocator, other.allocator);
+    }
+    return *this;
+  }
+
+  // Comparison operators
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::operator==(const SetAvl<Data, Allocator> &other) const noexcept
+  {
+    if (size != other.size)
+    {
+      return false; // Sets of different sizes cannot be equal
+    }
+
+    // Both in-order walks are sorted: compare them side by side, whatever the shapes
+    for (Node *mine = first, *theirs = other.first; mine != nullptr; mine = Next(mine), theirs = Next(theirs))
+    {
+      if (!(mine->element == theirs->element))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::operator!=(const SetAvl<Data, Allocator> &other) const noexcept
+  {
+    return !(*this == other); // Use equality operator for inverse check
+  }
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  template <typename Data, template <typename> class Allocator>
+  const Data &SetAvl<Data, Allocator>::Min() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    return first->element;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  Data SetAvl<Data, Allocator>::MinNRemove()
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    return TakeNode(first);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::RemoveMin()
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    RemoveNode(first);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  const Data &SetAvl<Data, Allocator>::Max() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    return last->element;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  Data SetAvl<Data, Allocator>::MaxNRemove()
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    return TakeNode(last);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::RemoveMax()
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    RemoveNode(last);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  const Data &SetAvl<Data, Allocator>::Predecessor(const Data &data) const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    Node *predNode = FindPredecessor(data);
+    if (predNode == nullptr)
+    {
+      throw std::length_error("SetAvl: Predecessor not found");
+    }
+
+    return predNode->element;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  Data SetAvl<Data, Allocator>::PredecessorNRemove(const Data &data)
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    Node *predNode = FindPredecessor(data);
+    if (predNode == nullptr)
+    {
+      throw std::length_error("SetAvl: Predecessor not found");
+    }
+
+    return TakeNode(predNode);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::RemovePredecessor(const Data &data)
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    Node *predNode = FindPredecessor(data);
+    if (predNode == nullptr)
+    {
+      throw std::length_error("SetAvl: Predecessor not found");
+    }
+
+    RemoveNode(predNode);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  const Data &SetAvl<Data, Allocator>::Successor(const Data &data) const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    Node *succNode = FindSuccessor(data);
+    if (succNode == nullptr)
+    {
+      throw std::length_error("SetAvl: Successor not found");
+    }
+
+    return succNode->element;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  Data SetAvl<Data, Allocator>::SuccessorNRemove(const Data &data)
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    Node *succNode = FindSuccessor(data);
+    if (succNode == nullptr)
+    {
+      throw std::length_error("SetAvl: Successor not found");
+    }
+
+    return TakeNode(succNode);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::RemoveSuccessor(const Data &data)
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    Node *succNode = FindSuccessor(data);
+    if (succNode == nullptr)
+    {
+      throw std::length_error("SetAvl: Successor not found");
+    }
+
+    RemoveNode(succNode);
+  }
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::Insert(const Data &data)
+  {
+    return InsertValue(data);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::Insert(Data &&data)
+  {
+    return InsertValue(std::move(data));
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::Remove(const Data &data)
+  {
+    Node *node = FindNode(data);
+    if (node == nullptr)
+    {
+      return false; // Not in the set
+    }
+
+    RemoveNode(node);
+    return true;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::InsertAll(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return InsertStaged(batch) == batch.Size();
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::InsertAll(MappableContainer<Data> &&container)
+  {
+    Vector<Data> batch(std::move(container));
+    return InsertStaged(batch) == batch.Size();
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::RemoveAll(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container); // Rotations and removals would upset a walk over the set itself
+    return RemoveStaged(batch) == batch.Size();
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::InsertSome(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return InsertStaged(batch) > 0;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::InsertSome(MappableContainer<Data> &&container)
+  {
+    Vector<Data> batch(std::move(container));
+    return InsertStaged(batch) > 0;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::RemoveSome(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return RemoveStaged(batch) > 0;
+  }
+
+  // Specific member functions (inherited from TestableContainer)
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::Exists(const Data &data) const noexcept
+  {
+    return FindNode(data) != nullptr;
+  }
+
+  // Specific member functions (inherited from LinearContainer)
+
+  template <typename Data, template <typename> class Allocator>
+  const Data &SetAvl<Data, Allocator>::operator[](const ulong index) const
+  {
+    if (index >= size)
+    {
+      throw std::out_of_range("SetAvl: Index out of range");
+    }
+
+    // The left subtree size is the rank of a node within its subtree
+    ulong rank = index;
+    const Node *current = root;
+    while (true)
+    {
+      const ulong leftCount = CountOf(current->left);
+      if (rank < leftCount)
+      {
+        current = current->left;
+      }
+      else if (rank > leftCount)
+      {
+        rank -= leftCount + 1;
+        current = current->right;
+      }
+      else
+      {
+        return current->element;
+      }
+    }
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  const Data &SetAvl<Data, Allocator>::Front() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    return first->element;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  const Data &SetAvl<Data, Allocator>::Back() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetAvl: Empty container");
+    }
+
+    return last->element;
+  }
+
+  // Specific member function (inherited from TraversableContainer, PreOrderTraversableContainer, PostOrderTraversableContainer)
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::Traverse(TraverseFun fun) const
+  {
+    PreOrderTraverse(fun); // Ascending order, as every set
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  bool SetAvl<Data, Allocator>::TraverseWhile(TraverseWhileFun fun) const
+  {
+    for (Node *current = first; current != nullptr; current = Next(current))
+    {
+      if (!fun(current->element))
+      {
+        return false; // Stop at the first node the function rejects
+      }
+    }
+    return true;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::PreOrderTraverse(TraverseFun fun) const
+  {
+    for (Node *current = first; current != nullptr; current = Next(current))
+    {
+      fun(current->element); // Each link is crossed twice over the whole walk: O(n)
+    }
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::PostOrderTraverse(TraverseFun fun) const
+  {
+    for (Node *current = last; current != nullptr; current = Previous(current))
+    {
+      fun(current->element);
+    }
+  }
+
+  // Specific member functions (visits following the tree shape)
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::InOrderTraverse(TraverseFun fun) const
+  {
+    InOrderFrom(root, fun);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::TreePreOrderTraverse(TraverseFun fun) const
+  {
+    PreOrderFrom(root, fun);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::TreePostOrderTraverse(TraverseFun fun) const
+  {
+    PostOrderFrom(root, fun);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  ulong SetAvl<Data, Allocator>::Height() const noexcept
+  {
+    return HeightOf(root);
+  }
+
+  // Template fast paths
+
+  template <typename Data, template <typename> class Allocator>
+  template <typename Fun>
+  void SetAvl<Data, Allocator>::ForEach(Fun &&fun) const
+  {
+    for (Node *current = first; current != nullptr; current = Next(current))
+    {
+      fun(current->element);
+    }
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  template <typename Accumulator, typename Fun>
+  Accumulator SetAvl<Data, Allocator>::Reduce(Fun &&fun, Accumulator accumulator) const
+  {
+    for (Node *current = first; current != nullptr; current = Next(current))
+    {
+      accumulator = fun(current->element, accumulator);
+    }
+    return accumulator;
+  }
+
+  // Specific member functions (read-only bidirectional iterators)
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::ConstIterator SetAvl<Data, Allocator>::begin() const noexcept
+  {
+    return ConstIterator(first, this);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::ConstIterator SetAvl<Data, Allocator>::end() const noexcept
+  {
+    return ConstIterator(nullptr, this);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::ConstIterator SetAvl<Data, Allocator>::cbegin() const noexcept
+  {
+    return begin();
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::ConstIterator SetAvl<Data, Allocator>::cend() const noexcept
+  {
+    return end();
+  }
+
+  // Specific member function (inherited from ClearableContainer)
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::Clear()
+  {
+    if constexpr (!(Allocator<Node>::BulkRelease && std::is_trivially_destructible_v<Node>))
+    {
+      DeleteSubtree(root);
+    }
+    allocator.Release(); // No node is left: pooled storage goes back at once
+
+    root = nullptr;
+    first = nullptr;
+    last = nullptr;
+    size = 0;
+  }
+
+  /* ************************************************************************** */
+
+  // Auxiliary functions
+
+  template <typename Data, template <typename> class Allocator>
+  ulong SetAvl<Data, Allocator>::HeightOf(const Node *node) noexcept
+  {
+    return (node == nullptr) ? 0 : node->height;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  ulong SetAvl<Data, Allocator>::CountOf(const Node *node) noexcept
+  {
+    return (node == nullptr) ? 0 : node->count;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::Update(Node *node) noexcept
+  {
+    const ulong leftHeight = HeightOf(node->left);
+    const ulong rightHeight = HeightOf(node->right);
+    node->height = 1 + ((leftHeight > rightHeight) ? leftHeight : rightHeight);
+    node->count = 1 + CountOf(node->left) + CountOf(node->right);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::Leftmost(Node *node) noexcept
+  {
+    while (node->left != nullptr)
+    {
+      node = node->left;
+    }
+    return node;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::Rightmost(Node *node) noexcept
+  {
+    while (node->right != nullptr)
+    {
+      node = node->right;
+    }
+    return node;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::Next(Node *node) noexcept
+  {
+    if (node->right != nullptr)
+    {
+      return Leftmost(node->right);
+    }
+    while (node->parent != nullptr && node->parent->right == node)
+    {
+      node = node->parent; // Climb out of right subtrees: their ancestors come first
+    }
+    return node->parent;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::Previous(Node *node) noexcept
+  {
+    if (node->left != nullptr)
+    {
+      return Rightmost(node->left);
+    }
+    while (node->parent != nullptr && node->parent->left == node)
+    {
+      node = node->parent;
+    }
+    return node->parent;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::FindNode(const Data &data) const noexcept
+  {
+    Node *current = root;
+    while (current != nullptr)
+    {
+      if (data < current->element)
+      {
+        current = current->left;
+      }
+      else if (current->element < data)
+      {
+        current = current->right;
+      }
+      else
+      {
+        return current;
+      }
+    }
+    return nullptr;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::FindPredecessor(const Data &data) const noexcept
+  {
+    Node *candidate = nullptr;
+    Node *current = root;
+    while (current != nullptr)
+    {
+      if (current->element < data)
+      {
+        candidate = current; // Smaller: the best so far, look for a larger one on the right
+        current = current->right;
+      }
+      else
+      {
+        current = current->left;
+      }
+    }
+    return candidate;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::FindSuccessor(const Data &data) const noexcept
+  {
+    Node *candidate = nullptr;
+    Node *current = root;
+    while (current != nullptr)
+    {
+      if (data < current->element)
+      {
+        candidate = current; // Larger: the best so far, look for a smaller one on the left
+        current = current->left;
+      }
+      else
+      {
+        current = current->right;
+      }
+    }
+    return candidate;
+  }
+
+  // Restructuring
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::ReplaceChild(Node *parent, Node *child, Node *replacement) noexcept
+  {
+    if (parent == nullptr)
+    {
+      root = replacement;
+    }
+    else if (parent->left == child)
+    {
+      parent->left = replacement;
+    }
+    else
+    {
+      parent->right = replacement;
+    }
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::RotateLeft(Node *node) noexcept
+  {
+    Node *pivot = node->right;
+    node->right = pivot->left;
+    if (pivot->left != nullptr)
+    {
+      pivot->left->parent = node;
+    }
+    pivot->parent = node->parent;
+    ReplaceChild(node->parent, node, pivot);
+    pivot->left = node;
+    node->parent = pivot;
+
+    Update(node); // Now below the pivot: update it first
+    Update(pivot);
+    return pivot;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::RotateRight(Node *node) noexcept
+  {
+    Node *pivot = node->left;
+    node->left = pivot->right;
+    if (pivot->right != nullptr)
+    {
+      pivot->right->parent = node;
+    }
+    pivot->parent = node->parent;
+    ReplaceChild(node->parent, node, pivot);
+    pivot->right = node;
+    node->parent = pivot;
+
+    Update(node);
+    Update(pivot);
+    return pivot;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::Rebalance(Node *node) noexcept
+  {
+    // Counts change on the whole path, so the walk always reaches the root: O(log n)
+    while (node != nullptr)
+    {
+      Update(node);
+      const ulong leftHeight = HeightOf(node->left);
+      const ulong rightHeight = HeightOf(node->right);
+
+      if (leftHeight > rightHeight + 1)
+      {
+        if (HeightOf(node->left->left) < HeightOf(node->left->right))
+        {
+          RotateLeft(node->left); // Left-right case: straighten the left child first
+        }
+        node = RotateRight(node);
+      }
+      else if (rightHeight > leftHeight + 1)
+      {
+        if (HeightOf(node->right->right) < HeightOf(node->right->left))
+        {
+          RotateRight(node->right); // Right-left case
+        }
+        node = RotateLeft(node);
+      }
+      node = node->parent;
+    }
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  template <typename Value>
+  bool SetAvl<Data, Allocator>::InsertValue(Value &&value)
+  {
+    Node *parent = nullptr;
+    Node *current = root;
+    bool toLeft = false;
+    while (current != nullptr)
+    {
+      parent = current;
+      if (value < current->element)
+      {
+        toLeft = true;
+        current = current->left;
+      }
+      else if (current->element < value)
+      {
+        toLeft = false;
+        current = current->right;
+      }
+      else
+      {
+        return false; // Element already exists
+      }
+    }
+
+    Node *node = allocator.New(std::forward<Value>(value));
+    node->parent = parent;
+    if (parent == nullptr)
+    {
+      root = node;
+    }
+    else if (toLeft)
+    {
+      parent->left = node;
+    }
+    else
+    {
+      parent->right = node;
+    }
+
+    if (first == nullptr || node->element < first->element)
+    {
+      first = node;
+    }
+    if (last == nullptr || last->element < node->element)
+    {
+      last = node;
+    }
+    size++;
+
+    Rebalance(parent);
+    return true;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::RemoveNode(Node *node) noexcept
+  {
+    if (node == first)
+    {
+      first = Next(node);
+    }
+    if (node == last)
+    {
+      last = Previous(node);
+    }
+
+    Node *from; // Lowest node whose subtree changed
+    if (node->left != nullptr && node->right != nullptr)
+    {
+      // Relink the in-order successor in place of the node: no element is moved,
+      // so iterators to the other nodes stay valid
+      Node *successor = Leftmost(node->right);
+      if (successor->parent != node)
+      {
+        from = successor->parent;
+        ReplaceChild(successor->parent, successor, successor->right);
+        if (successor->right != nullptr)
+        {
+          successor->right->parent = successor->parent;
+        }
+        successor->right = node->right;
+        node->right->parent = successor;
+      }
+      else
+      {
+        from = successor;
+      }
+      successor->left = node->left;
+      node->left->parent = successor;
+      successor->parent = node->parent;
+      ReplaceChild(node->parent, node, successor);
+    }
+    else
+    {
+      Node *child = (node->left != nullptr) ? node->left : node->right;
+      if (child != nullptr)
+      {
+        child->parent = node->parent;
+      }
+      ReplaceChild(node->parent, node, child);
+      from = node->parent;
+    }
+
+    size--;
+    Rebalance(from);
+    allocator.Delete(node);
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  Data SetAvl<Data, Allocator>::TakeNode(Node *node)
+  {
+    Data data(std::move(node->element));
+    RemoveNode(node); // Unlinking compares no element
+    return data;
+  }
+
+  // Bulk loading
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::BuildBalanced(Data *begin, Data *end, Node *parent)
+  {
+    if (begin == end)
+    {
+      return nullptr;
+    }
+
+    Data *middle = begin + (end - begin) / 2;
+    Node *node = allocator.New(std::move(*middle));
+    node->parent = parent;
+    node->left = BuildBalanced(begin, middle, node);
+    node->right = BuildBalanced(middle + 1, end, node);
+    Update(node);
+    return node;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::BuildSorted(Vector<Data> &staged, bool sorted)
+  {
+    if (!sorted)
+    {
+      PdqSort(staged.begin(), staged.end());
+    }
+    else if (!IsSorted(staged.begin(), staged.end()))
+    {
+      throw std::invalid_argument("SetAvl: Input not sorted");
+    }
+    Data *end = Unique(staged.begin(), staged.end()); // Duplicates are adjacent once sorted
+
+    root = BuildBalanced(staged.begin(), end, nullptr);
+    first = (root == nullptr) ? nullptr : Leftmost(root);
+    last = (root == nullptr) ? nullptr : Rightmost(root);
+    size = end - staged.begin();
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  typename SetAvl<Data, Allocator>::Node *SetAvl<Data, Allocator>::CloneSubtree(const Node *node, Node *parent)
+  {
+    if (node == nullptr)
+    {
+      return nullptr;
+    }
+
+    Node *copy = allocator.New(node->element);
+    copy->parent = parent;
+    copy->left = CloneSubtree(node->left, copy);
+    copy->right = CloneSubtree(node->right, copy);
+    copy->count = node->count;
+    copy->height = node->height;
+    return copy;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::DeleteSubtree(Node *node) noexcept
+  {
+    if (node != nullptr)
+    {
+      DeleteSubtree(node->left);
+      DeleteSubtree(node->right);
+      allocator.Delete(node);
+    }
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  ulong SetAvl<Data, Allocator>::InsertStaged(Vector<Data> &batch)
+  {
+    ulong added = 0;
+    for (Data *current = batch.begin(); current != batch.end(); ++current)
+    {
+      added += InsertValue(std::move(*current)); // Moved only when linked
+    }
+    return added;
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  ulong SetAvl<Data, Allocator>::RemoveStaged(Vector<Data> &batch)
+  {
+    ulong removed = 0;
+    for (const Data *current = batch.begin(); current != batch.end(); ++current)
+    {
+      removed += Remove(*current);
+    }
+    return removed;
+  }
+
+  // Tree-shaped visits
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::InOrderFrom(const Node *node, TraverseFun &fun)
+  {
+    if (node != nullptr)
+    {
+      InOrderFrom(node->left, fun);
+      fun(node->element);
+      InOrderFrom(node->right, fun);
+    }
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::PreOrderFrom(const Node *node, TraverseFun &fun)
+  {
+    if (node != nullptr)
+    {
+      fun(node->element);
+      PreOrderFrom(node->left, fun);
+      PreOrderFrom(node->right, fun);
+    }
+  }
+
+  template <typename Data, template <typename> class Allocator>
+  void SetAvl<Data, Allocator>::PostOrderFrom(const Node *node, TraverseFun &fun)
+  {
+    if (node != nullptr)
+    {
+      PostOrderFrom(node->left, fun);
+      PostOrderFrom(node->right, fun);
+      fun(node->element);
+    }
+  }
+
+  /* ************************************************************************** */
+
+}
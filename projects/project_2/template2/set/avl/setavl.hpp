@@ -0,0 +1,332 @@
+#ifndef SETAVL_HPP
+#define SETAVL_HPP
+
+/* ************************************************************************** */
+
+#include <iterator>
+
+#include "../set.hpp"
+#include "../../allocator/allocator.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  template <typename Data, template <typename> class Allocator = HeapAllocator>
+  class SetAvl : virtual public Set<Data>
+  {
+    // Must extend Set<Data>
+
+    // AVL tree with parent links and subtree sizes: every update is worst-case
+    // O(log n), and so is positional access by rank. The smallest and largest
+    // nodes are cached for O(1) Min, Max, Front and Back.
+
+  private:
+    // ...
+
+  protected:
+    using Container::size;
+
+    struct Node
+    {
+      Data element;
+      Node *left = nullptr;
+      Node *right = nullptr;
+      Node *parent = nullptr; // nullptr for the root
+      ulong count = 1;        // Nodes in the subtree rooted here
+      ulong height = 1;       // Levels in the subtree rooted here
+
+      // Specific constructor
+      template <typename Value>
+      explicit Node(Value &&value) : element(std::forward<Value>(value)) {}
+    };
+
+    Node *root = nullptr;
+    Node *first = nullptr; // Smallest element
+    Node *last = nullptr;  // Largest element
+
+    Allocator<Node> allocator; // Storage policy for the nodes
+
+    class NodeIterator;
+
+  public:
+    // Default constructor
+    SetAvl() = default;
+
+    /* ************************************************************************ */
+
+    // Specific constructors (staged in one array, sorted and deduplicated there,
+    // then built already balanced: O(n log n))
+    SetAvl(const TraversableContainer<Data> &);  // A set obtained from a TraversableContainer
+    SetAvl(MappableContainer<Data> &&) noexcept; // A set obtained from a MappableContainer
+
+    /* ************************************************************************ */
+
+    // Specific factories (input in ascending order, duplicates allowed: O(n), built
+    // already balanced; must throw std::invalid_argument when the input is not sorted)
+    static SetAvl FromSorted(const TraversableContainer<Data> &); // A set copied from sorted input
+    static SetAvl FromSorted(MappableContainer<Data> &&);         // A set moved from sorted input
+
+    /* ************************************************************************ */
+
+    // Copy constructor
+    SetAvl(const SetAvl &);
+
+    // Move constructor
+    SetAvl(SetAvl &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Destructor
+    virtual ~SetAvl();
+
+    /* ************************************************************************ */
+
+    // Copy assignment
+    SetAvl &operator=(const SetAvl &);
+
+    // Move assignment
+    SetAvl &operator=(SetAvl &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Comparison operators
+    bool operator==(const SetAvl &) const noexcept;
+    bool operator!=(const SetAvl &) const noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from OrderedDictionaryContainer)
+
+    const Data &Min() const override; // Return the smallest element in the set, O(1)
+    Data MinNRemove() override;       // Remove and return the smallest element
+    void RemoveMin() override;        // Remove the smallest element
+
+    const Data &Max() const override; // Return the largest element in the set, O(1)
+    Data MaxNRemove() override;       // Remove and return the largest element
+    void RemoveMax() override;        // Remove the largest element
+
+    const Data &Predecessor(const Data &) const override; // Find the largest element smaller than the given value
+    Data PredecessorNRemove(const Data &) override;       // Remove and return the predecessor
+    void RemovePredecessor(const Data &) override;        // Remove the predecessor
+
+    const Data &Successor(const Data &) const override; // Find the smallest element larger than the given value
+    Data SuccessorNRemove(const Data &) override;       // Remove and return the successor
+    void RemoveSuccessor(const Data &) override;        // Remove the successor
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from DictionaryContainer)
+
+    bool Insert(const Data &) override; // Add an element if not already present (copy)
+    bool Insert(Data &&) override;      // Add an element if not already present (move)
+    bool Remove(const Data &) override; // Remove an element if present
+
+    // Batched operations: the batch is staged first, so it may be the set itself
+
+    bool InsertAll(const TraversableContainer<Data> &) override; // True if every element was inserted (copy)
+    bool InsertAll(MappableContainer<Data> &&) override;         // True if every element was inserted (move)
+    bool RemoveAll(const TraversableContainer<Data> &) override; // True if every element was removed
+
+    bool InsertSome(const TraversableContainer<Data> &) override; // True if some element was inserted (copy)
+    bool InsertSome(MappableContainer<Data> &&) override;         // True if some element was inserted (move)
+    bool RemoveSome(const TraversableContainer<Data> &) override; // True if some element was removed
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from TestableContainer)
+
+    bool Exists(const Data &) const noexcept override; // Check if an element exists in the set
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from LinearContainer)
+
+    const Data &operator[](const ulong) const override; // Access by rank through the subtree sizes (must throw std::out_of_range when out of range)
+    const Data &Front() const override;                 // Smallest element (must throw std::length_error when empty)
+    const Data &Back() const override;                  // Largest element (must throw std::length_error when empty)
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from TraversableContainer)
+
+    using typename TraversableContainer<Data>::TraverseFun;
+
+    void Traverse(TraverseFun) const override; // Apply function to all elements in ascending order (in-order visit)
+
+    using typename TraversableContainer<Data>::TraverseWhileFun;
+
+    bool TraverseWhile(TraverseWhileFun) const override; // Walk in ascending order until the function returns false
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from PreOrderTraversableContainer)
+
+    void PreOrderTraverse(TraverseFun) const override; // Apply function to all elements in ascending order, as every LinearContainer
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from PostOrderTraversableContainer)
+
+    void PostOrderTraverse(TraverseFun) const override; // Apply function to all elements in descending order, as every LinearContainer
+
+    /* ************************************************************************ */
+
+    // Specific member functions (visits following the tree shape)
+
+    void InOrderTraverse(TraverseFun) const;       // Left subtree, node, right subtree (ascending order)
+    void TreePreOrderTraverse(TraverseFun) const;  // Node, left subtree, right subtree
+    void TreePostOrderTraverse(TraverseFun) const; // Left subtree, right subtree, node
+
+    ulong Height() const noexcept; // Levels in the tree (0 when empty), at most 1.44 log2(n + 2)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (template fast paths, hiding the type-erased ones)
+
+    template <typename Fun>
+    void ForEach(Fun &&) const; // Apply callable to each element, ascending order
+
+    template <typename Accumulator, typename Fun>
+    Accumulator Reduce(Fun &&, Accumulator) const; // Fold with any callable, ascending order
+
+    /* ************************************************************************ */
+
+    // Specific member functions (read-only bidirectional iterators, ascending order)
+
+    using ConstIterator = NodeIterator;
+
+    ConstIterator begin() const noexcept; // Smallest element
+    ConstIterator end() const noexcept;   // Past the largest element
+
+    ConstIterator cbegin() const noexcept;
+    ConstIterator cend() const noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from ClearableContainer)
+
+    void Clear() override; // Remove all elements from the set
+
+  protected:
+    // Auxiliary functions
+
+    static ulong HeightOf(const Node *) noexcept; // 0 for nullptr
+    static ulong CountOf(const Node *) noexcept;  // 0 for nullptr
+    static void Update(Node *) noexcept;          // Recompute height and count from the children
+
+    static Node *Leftmost(Node *) noexcept;
+    static Node *Rightmost(Node *) noexcept;
+    static Node *Next(Node *) noexcept;     // In-order successor (nullptr after the largest)
+    static Node *Previous(Node *) noexcept; // In-order predecessor (nullptr before the smallest)
+
+    Node *FindNode(const Data &) const noexcept;        // Node holding the value (nullptr if absent)
+    Node *FindPredecessor(const Data &) const noexcept; // Largest node smaller than the value (nullptr for none)
+    Node *FindSuccessor(const Data &) const noexcept;   // Smallest node larger than the value (nullptr for none)
+
+    // Restructuring
+
+    void ReplaceChild(Node *, Node *, Node *) noexcept; // Hang the third node where the second hung under the first (the root for nullptr)
+    Node *RotateLeft(Node *) noexcept;                  // Returns the new subtree root
+    Node *RotateRight(Node *) noexcept;                 // Returns the new subtree root
+    void Rebalance(Node *) noexcept;                    // Fix heights, counts and balance from a node up to the root
+
+    template <typename Value>
+    bool InsertValue(Value &&); // Link a new leaf unless the value is present
+
+    void RemoveNode(Node *) noexcept; // Unlink, rebalance and free a node of the set
+    Data TakeNode(Node *);            // Unlink a node, returning its element
+
+    // Bulk loading
+
+    Node *BuildBalanced(Data *, Data *, Node *); // Perfectly balanced subtree of a sorted unique range (elements are moved)
+    void BuildSorted(Vector<Data> &, bool);      // Deduplicate (after sorting when not claimed sorted), then build (must throw std::invalid_argument when claimed sorted but not)
+
+    Node *CloneSubtree(const Node *, Node *); // Same-shaped copy of a subtree
+    void DeleteSubtree(Node *) noexcept;
+
+    // Batched operations on a staged copy of the batch
+    ulong InsertStaged(Vector<Data> &); // Returns how many were new
+    ulong RemoveStaged(Vector<Data> &); // Returns how many were present
+
+    // Tree-shaped visits (recursion depth bounded by the AVL height)
+    static void InOrderFrom(const Node *, TraverseFun &);
+    static void PreOrderFrom(const Node *, TraverseFun &);
+    static void PostOrderFrom(const Node *, TraverseFun &);
+
+    /* ************************************************************************ */
+
+    class NodeIterator
+    {
+      // Bidirectional in-order iterator: end() is the null node,
+      // from which a decrement steps back onto the largest element
+
+      friend class SetAvl;
+
+    public:
+      using iterator_concept = std::bidirectional_iterator_tag;
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type = Data;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const Data *;
+      using reference = const Data &;
+
+      /* ********************************************************************** */
+
+      // Default constructor
+      NodeIterator() = default;
+
+      /* ********************************************************************** */
+
+      // Specific member functions
+
+      reference operator*() const noexcept { return current->element; }
+      pointer operator->() const noexcept { return &current->element; }
+
+      NodeIterator &operator++() noexcept
+      {
+        current = Next(current);
+        return *this;
+      }
+
+      NodeIterator operator++(int) noexcept
+      {
+        NodeIterator previous = *this;
+        ++*this;
+        return previous;
+      }
+
+      NodeIterator &operator--() noexcept
+      {
+        current = (current == nullptr) ? owner->last : Previous(current);
+        return *this;
+      }
+
+      NodeIterator operator--(int) noexcept
+      {
+        NodeIterator previous = *this;
+        --*this;
+        return previous;
+      }
+
+      bool operator==(const NodeIterator &other) const noexcept { return current == other.current; }
+
+    private:
+      NodeIterator(Node *node, const SetAvl *set) noexcept : current(node), owner(set) {}
+
+      Node *current = nullptr;       // Node under the iterator (nullptr past the end)
+      const SetAvl *owner = nullptr; // Set walked, to step back from the end
+    };
+  };
+
+  /* ************************************************************************** */
+
+}
+
+#include "setavl.cpp" // Include implementation file
+
+#endif
@@ -0,0 +1,1090 @@
+#include <memory>
+
+namespace lasd
+{
+  /* ************************************************************************** */
+
+  // Specific constructors
+
+  template <typename Data, ulong NodeCapacity>
+  SetBTree<Data, NodeCapacity>::SetBTree(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> staged(container); // Sorting an array beats a search per element
+    BuildSorted(staged, false);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  SetBTree<Data, NodeCapacity>::SetBTree(MappableContainer<Data> &&container) noexcept
+  {
+    Vector<Data> staged(std::move(container)); // Elements are moved through the array into the leaves
+    BuildSorted(staged, false);
+  }
+
+  // Specific factories
+
+  template <typename Data, ulong NodeCapacity>
+  SetBTree<Data, NodeCapacity> SetBTree<Data, NodeCapacity>::FromSorted(const TraversableContainer<Data> &container)
+  {
+    SetBTree<Data, NodeCapacity> set;
+    Vector<Data> staged(container); // The leaf sizes depend on the total: the input is counted first
+    set.BuildSorted(staged, true);
+    return set;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  SetBTree<Data, NodeCapacity> SetBTree<Data, NodeCapacity>::FromSorted(MappableContainer<Data> &&container)
+  {
+    SetBTree<Data, NodeCapacity> set;
+    Vector<Data> staged(std::move(container));
+    set.BuildSorted(staged, true);
+    return set;
+  }
+
+  // Copy constructor
+  template <typename Data, ulong NodeCapacity>
+  SetBTree<Data, NodeCapacity>::SetBTree(const SetBTree<Data, NodeCapacity> &other)
+  {
+    Vector<Data> staged(other); // Other is already sorted: bulk load its keys into full leaves
+    BuildSorted(staged, true);
+  }
+
+  // Move constructor
+  template <typename Data, ulong NodeCapacity>
+  SetBTree<Data, NodeCapacity>::SetBTree(SetBTree<Data, NodeCapacity> &&other) noexcept
+  {
+    std::swap(root, other.root);
+    std::swap(first, other.first);
+    std::swap(last, other.last);
+    std::swap(size, other.size);
+  }
+
+  // Destructor
+  template <typename Data, ulong NodeCapacity>
+  SetBTree<Data, NodeCapacity>::~SetBTree()
+  {
+    Clear();
+  }
+
+  // Copy assignment
+  template <typename Data, ulong NodeCapacity>
+  SetBTree<Data, NodeCapacity> &SetBTree<Data, NodeCapacity>::operator=(const SetBTree<Data, NodeCapacity> &other)
+  {
+    if (this != &other)
+    {
+      SetBTree<Data, NodeCapacity> copy(other);
+      *this = std::move(copy); // The old nodes leave with copy
+    }
+    return *this;
+  }
+
+  // Move assignment
+  template <typename Data, ulong NodeCapacity>
+  SetBTree<Data, NodeCapacity> &SetBTree<Data, NodeCapacity>::operator=(SetBTree<Data, NodeCapacity> &&other) noexcept
+  {
+    if (this != &other)
+    {
+      std::swap(root, other.root);
+      std::swap(first, other.first);
+      std::swap(last, other.last);
+      std::swap(size, other.size);
+    }
+    return *this;
+  }
+
+  // Comparison operators
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::operator==(const SetBTree<Data, NodeCapacity> &other) const noexcept
+  {
+    if (size != other.size)
+    {
+      return false; // Sets of different sizes cannot be equal
+    }
+
+    // Both leaf chains are sorted: compare them side by side, whatever the leaf sizes
+    ConstIterator theirs = other.begin();
+    for (ConstIterator mine = begin(); mine != end(); ++mine, ++theirs)
+    {
+      if (!(*mine == *theirs))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::operator!=(const SetBTree<Data, NodeCapacity> &other) const noexcept
+  {
+    return !(*this == other); // Use equality operator for inverse check
+  }
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &SetBTree<Data, NodeCapacity>::Min() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetBTree: Empty container");
+    }
+
+    return first->Keys()[0];
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  Data SetBTree<Data, NodeCapacity>::MinNRemove()
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetBTree: Empty container");
+    }
+
+    Data data(first->Keys()[0]); // The removal walks down by value: keep a copy to find it
+    Remove(data);
+    return data;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::RemoveMin()
+  {
+    MinNRemove();
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &SetBTree<Data, NodeCapacity>::Max() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetBTree: Empty container");
+    }
+
+    return last->Keys()[last->count - 1];
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  Data SetBTree<Data, NodeCapacity>::MaxNRemove()
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetBTree: Empty container");
+    }
+
+    Data data(last->Keys()[last->count - 1]);
+    Remove(data);
+    return data;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::RemoveMax()
+  {
+    MaxNRemove();
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &SetBTree<Data, NodeCapacity>::Predecessor(const Data &data) const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetBTree: Empty container");
+    }
+
+    const Leaf *leaf = FindLeaf(data);
+    const ulong slot = LowerBound(leaf->Keys(), leaf->count, data);
+    if (slot > 0)
+    {
+      return leaf->Keys()[slot - 1];
+    }
+    if (leaf->prev == nullptr)
+    {
+      throw std::length_error("SetBTree: Predecessor not found");
+    }
+
+    return leaf->prev->Keys()[leaf->prev->count - 1]; // Every key of the leaf is larger: last of the previous one
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  Data SetBTree<Data, NodeCapacity>::PredecessorNRemove(const Data &data)
+  {
+    Data predecessor(Predecessor(data));
+    Remove(predecessor);
+    return predecessor;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::RemovePredecessor(const Data &data)
+  {
+    PredecessorNRemove(data);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &SetBTree<Data, NodeCapacity>::Successor(const Data &data) const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetBTree: Empty container");
+    }
+
+    const Leaf *leaf = FindLeaf(data);
+    const ulong slot = UpperBound(leaf->Keys(), leaf->count, data);
+    if (slot < leaf->count)
+    {
+      return leaf->Keys()[slot];
+    }
+    if (leaf->next == nullptr)
+    {
+      throw std::length_error("SetBTree: Successor not found");
+    }
+
+    return leaf->next->Keys()[0]; // Every key of the leaf is smaller: first of the next one
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  Data SetBTree<Data, NodeCapacity>::SuccessorNRemove(const Data &data)
+  {
+    Data successor(Successor(data));
+    Remove(successor);
+    return successor;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::RemoveSuccessor(const Data &data)
+  {
+    SuccessorNRemove(data);
+  }
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::Insert(const Data &data)
+  {
+    return InsertValue(data);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::Insert(Data &&data)
+  {
+    return InsertValue(std::move(data));
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::Remove(const Data &data)
+  {
+    if (root == nullptr)
+    {
+      return false;
+    }
+
+    Inner *path[MaxDepth]; // Inner nodes walked, to fix their child sizes once the key is gone
+    ulong slots[MaxDepth];
+    ulong depth = 0;
+
+    Node *node = root;
+    while (!node->leaf)
+    {
+      Inner *inner = static_cast<Inner *>(node);
+      ulong index = UpperBound(inner->Keys(), inner->count, data);
+      if (inner->children[index]->count <= MinKeys)
+      {
+        index = RefillChild(inner, index); // The child can now lose a key without underflowing
+      }
+
+      if (inner == root && inner->count == 0)
+      {
+        root = inner->children[0]; // The root merged its last two children: the tree gets shorter
+        delete inner;
+        node = root;
+        continue;
+      }
+
+      path[depth] = inner;
+      slots[depth] = index;
+      depth++;
+      node = inner->children[index];
+    }
+
+    Leaf *leaf = static_cast<Leaf *>(node);
+    const ulong slot = LowerBound(leaf->Keys(), leaf->count, data);
+    if (slot == leaf->count || data < leaf->Keys()[slot])
+    {
+      return false; // Not in the set
+    }
+
+    EraseAt(leaf->Keys(), leaf->count, slot);
+    leaf->count--;
+    for (ulong level = 0; level < depth; level++)
+    {
+      path[level]->weights[slots[level]]--;
+    }
+    size--;
+
+    if (leaf->count == 0)
+    {
+      delete leaf; // Only the root leaf may empty
+      root = nullptr;
+      first = nullptr;
+      last = nullptr;
+    }
+    return true;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::InsertAll(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return InsertStaged(batch) == batch.Size();
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::InsertAll(MappableContainer<Data> &&container)
+  {
+    Vector<Data> batch(std::move(container));
+    return InsertStaged(batch) == batch.Size();
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::RemoveAll(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container); // Splits and merges would upset a walk over the set itself
+    return RemoveStaged(batch) == batch.Size();
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::InsertSome(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return InsertStaged(batch) > 0;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::InsertSome(MappableContainer<Data> &&container)
+  {
+    Vector<Data> batch(std::move(container));
+    return InsertStaged(batch) > 0;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::RemoveSome(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return RemoveStaged(batch) > 0;
+  }
+
+  // Specific member functions (inherited from TestableContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::Exists(const Data &data) const noexcept
+  {
+    if (root == nullptr)
+    {
+      return false;
+    }
+
+    const Leaf *leaf = FindLeaf(data);
+    const ulong slot = LowerBound(leaf->Keys(), leaf->count, data);
+    return slot < leaf->count && !(data < leaf->Keys()[slot]);
+  }
+
+  // Specific member functions (inherited from LinearContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &SetBTree<Data, NodeCapacity>::operator[](const ulong index) const
+  {
+    if (index >= size)
+    {
+      throw std::out_of_range("SetBTree: Index out of range");
+    }
+
+    ulong rank = index;
+    const Node *node = root;
+    while (!node->leaf)
+    {
+      const Inner *inner = static_cast<const Inner *>(node);
+      ulong child = 0;
+      while (rank >= inner->weights[child])
+      {
+        rank -= inner->weights[child++]; // Skip the whole subtree
+      }
+      node = inner->children[child];
+    }
+    return static_cast<const Leaf *>(node)->Keys()[rank];
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &SetBTree<Data, NodeCapacity>::Front() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetBTree: Empty container");
+    }
+
+    return first->Keys()[0];
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &SetBTree<Data, NodeCapacity>::Back() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetBTree: Empty container");
+    }
+
+    return last->Keys()[last->count - 1];
+  }
+
+  // Specific member function (inherited from TraversableContainer, PreOrderTraversableContainer, PostOrderTraversableContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::Traverse(TraverseFun fun) const
+  {
+    PreOrderTraverse(fun); // Ascending order, as every set
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  bool SetBTree<Data, NodeCapacity>::TraverseWhile(TraverseWhileFun fun) const
+  {
+    for (const Leaf *leaf = first; leaf != nullptr; leaf = leaf->next)
+    {
+      const Data *keys = leaf->Keys();
+      for (ulong slot = 0; slot < leaf->count; slot++)
+      {
+        if (!fun(keys[slot]))
+        {
+          return false; // Stop at the first element the function rejects
+        }
+      }
+    }
+    return true;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::PreOrderTraverse(TraverseFun fun) const
+  {
+    for (const Leaf *leaf = first; leaf != nullptr; leaf = leaf->next)
+    {
+      const Data *keys = leaf->Keys();
+      for (ulong slot = 0; slot < leaf->count; slot++)
+      {
+        fun(keys[slot]);
+      }
+    }
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::PostOrderTraverse(TraverseFun fun) const
+  {
+    for (const Leaf *leaf = last; leaf != nullptr; leaf = leaf->prev)
+    {
+      const Data *keys = leaf->Keys();
+      for (ulong slot = leaf->count; slot > 0; slot--)
+      {
+        fun(keys[slot - 1]);
+      }
+    }
+  }
+
+  // Specific member functions (range scans along the leaves)
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::TraverseRange(const Data &low, const Data &high, TraverseFun fun) const
+  {
+    if (root == nullptr)
+    {
+      return;
+    }
+
+    const Leaf *leaf = FindLeaf(low);
+    ulong slot = LowerBound(leaf->Keys(), leaf->count, low);
+    for (; leaf != nullptr; leaf = leaf->next, slot = 0)
+    {
+      const Data *keys = leaf->Keys();
+      for (; slot < leaf->count; slot++)
+      {
+        if (high < keys[slot])
+        {
+          return;
+        }
+        fun(keys[slot]);
+      }
+    }
+  }
+
+  // Template fast paths
+
+  template <typename Data, ulong NodeCapacity>
+  template <typename Fun>
+  void SetBTree<Data, NodeCapacity>::ForEach(Fun &&fun) const
+  {
+    for (const Leaf *leaf = first; leaf != nullptr; leaf = leaf->next)
+    {
+      const Data *keys = leaf->Keys();
+      for (ulong slot = 0; slot < leaf->count; slot++)
+      {
+        fun(keys[slot]);
+      }
+    }
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  template <typename Accumulator, typename Fun>
+  Accumulator SetBTree<Data, NodeCapacity>::Reduce(Fun &&fun, Accumulator accumulator) const
+  {
+    for (const Leaf *leaf = first; leaf != nullptr; leaf = leaf->next)
+    {
+      const Data *keys = leaf->Keys();
+      for (ulong slot = 0; slot < leaf->count; slot++)
+      {
+        accumulator = fun(keys[slot], accumulator);
+      }
+    }
+    return accumulator;
+  }
+
+  // Specific member functions (read-only bidirectional iterators)
+
+  template <typename Data, ulong NodeCapacity>
+  typename SetBTree<Data, NodeCapacity>::ConstIterator SetBTree<Data, NodeCapacity>::begin() const noexcept
+  {
+    return ConstIterator(first, 0, this);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  typename SetBTree<Data, NodeCapacity>::ConstIterator SetBTree<Data, NodeCapacity>::end() const noexcept
+  {
+    return ConstIterator(nullptr, 0, this);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  typename SetBTree<Data, NodeCapacity>::ConstIterator SetBTree<Data, NodeCapacity>::cbegin() const noexcept
+  {
+    return begin();
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  typename SetBTree<Data, NodeCapacity>::ConstIterator SetBTree<Data, NodeCapacity>::cend() const noexcept
+  {
+    return end();
+  }
+
+  // Specific member function (inherited from ClearableContainer)
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::Clear()
+  {
+    DeleteSubtree(root);
+    root = nullptr;
+    first = nullptr;
+    last = nullptr;
+    size = 0;
+  }
+
+  /* ************************************************************************** */
+
+  // Auxiliary functions (searches inside one node)
+
+  template <typename Data, ulong NodeCapacity>
+  ulong SetBTree<Data, NodeCapacity>::LowerBound(const Data *keys, ulong count, const Data &data) noexcept
+  {
+    if (count == 0)
+    {
+      return 0;
+    }
+
+    // The answer stays in [base, base + count]: halving without a branch on the
+    // comparison (a conditional move), so the loop never mispredicts
+    const Data *base = keys;
+    while (count > 1)
+    {
+      const ulong half = count / 2;
+      base = (base[half] < data) ? base + half : base;
+      count -= half;
+    }
+    return (base - keys) + (*base < data);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  ulong SetBTree<Data, NodeCapacity>::UpperBound(const Data *keys, ulong count, const Data &data) noexcept
+  {
+    if (count == 0)
+    {
+      return 0;
+    }
+
+    const Data *base = keys;
+    while (count > 1)
+    {
+      const ulong half = count / 2;
+      base = (data < base[half]) ? base : base + half;
+      count -= half;
+    }
+    return (base - keys) + !(data < *base);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  const typename SetBTree<Data, NodeCapacity>::Leaf *SetBTree<Data, NodeCapacity>::FindLeaf(const Data &data) const noexcept
+  {
+    const Node *node = root;
+    while (!node->leaf)
+    {
+      const Inner *inner = static_cast<const Inner *>(node);
+      node = inner->children[UpperBound(inner->Keys(), inner->count, data)]; // Keys equal to a separator live on its right
+      Prefetch(node);
+    }
+    return static_cast<const Leaf *>(node);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::Prefetch(const Node *node) noexcept
+  {
+    // The halving search reads its lines one after the other: requested up
+    // front, they arrive together, one memory latency per level
+    const char *bytes = reinterpret_cast<const char *>(node);
+    for (ulong offset = 0; offset < sizeof(Leaf); offset += 64)
+    {
+      __builtin_prefetch(bytes + offset);
+    }
+  }
+
+  // Slot shuffling on raw storage
+
+  template <typename Data, ulong NodeCapacity>
+  template <typename Value>
+  void SetBTree<Data, NodeCapacity>::InsertAt(Data *keys, ulong count, ulong position, Value &&value)
+  {
+    if (position == count)
+    {
+      new (keys + count) Data(std::forward<Value>(value));
+      return;
+    }
+
+    new (keys + count) Data(std::move(keys[count - 1])); // The last key moves into raw storage
+    for (ulong slot = count - 1; slot > position; slot--)
+    {
+      keys[slot] = std::move(keys[slot - 1]);
+    }
+    keys[position] = std::forward<Value>(value);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::EraseAt(Data *keys, ulong count, ulong position)
+  {
+    for (ulong slot = position; slot + 1 < count; slot++)
+    {
+      keys[slot] = std::move(keys[slot + 1]);
+    }
+    std::destroy_at(keys + count - 1);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::MoveAppend(Data *source, ulong count, Data *target, ulong targetCount)
+  {
+    std::uninitialized_move(source, source + count, target + targetCount);
+    std::destroy(source, source + count);
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::InsertChild(Inner *inner, ulong position, Node *child, ulong weight) noexcept
+  {
+    for (ulong slot = inner->count + 1; slot > position; slot--)
+    {
+      inner->children[slot] = inner->children[slot - 1];
+      inner->weights[slot] = inner->weights[slot - 1];
+    }
+    inner->children[position] = child;
+    inner->weights[position] = weight;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::EraseChild(Inner *inner, ulong position) noexcept
+  {
+    for (ulong slot = position; slot < inner->count; slot++)
+    {
+      inner->children[slot] = inner->children[slot + 1];
+      inner->weights[slot] = inner->weights[slot + 1];
+    }
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  const Data &SetBTree<Data, NodeCapacity>::LeftmostKey(const Node *node) noexcept
+  {
+    while (!node->leaf)
+    {
+      node = static_cast<const Inner *>(node)->children[0];
+    }
+    return static_cast<const Leaf *>(node)->Keys()[0];
+  }
+
+  // Restructuring
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::SplitChild(Inner *parent, ulong index)
+  {
+    Node *child = parent->children[index];
+    const ulong keep = NodeCapacity / 2; // Keys left in the child
+    const ulong total = parent->weights[index];
+
+    if (child->leaf)
+    {
+      Leaf *left = static_cast<Leaf *>(child);
+      Leaf *right = new Leaf();
+      MoveAppend(left->Keys() + keep, NodeCapacity - keep, right->Keys(), 0);
+      right->count = NodeCapacity - keep;
+      left->count = keep;
+
+      right->prev = left;
+      right->next = left->next;
+      if (left->next != nullptr)
+      {
+        left->next->prev = right;
+      }
+      else
+      {
+        last = right;
+      }
+      left->next = right;
+
+      InsertAt(parent->Keys(), parent->count, index, right->Keys()[0]); // Leaves keep their keys: the separator is a copy
+      InsertChild(parent, index + 1, right, right->count);
+      parent->weights[index] = keep;
+    }
+    else
+    {
+      Inner *left = static_cast<Inner *>(child);
+      Inner *right = new Inner();
+      MoveAppend(left->Keys() + keep + 1, NodeCapacity - keep - 1, right->Keys(), 0);
+      ulong moved = 0;
+      for (ulong slot = keep + 1; slot <= NodeCapacity; slot++)
+      {
+        right->children[slot - keep - 1] = left->children[slot];
+        right->weights[slot - keep - 1] = left->weights[slot];
+        moved += left->weights[slot];
+      }
+      right->count = NodeCapacity - keep - 1;
+
+      InsertAt(parent->Keys(), parent->count, index, std::move(left->Keys()[keep])); // The middle separator moves up
+      std::destroy_at(left->Keys() + keep);
+      left->count = keep;
+
+      InsertChild(parent, index + 1, right, moved);
+      parent->weights[index] = total - moved;
+    }
+    parent->count++;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  ulong SetBTree<Data, NodeCapacity>::RefillChild(Inner *parent, ulong index)
+  {
+    Node *child = parent->children[index];
+    Node *left = (index > 0) ? parent->children[index - 1] : nullptr;
+    Node *right = (index < parent->count) ? parent->children[index + 1] : nullptr;
+
+    if (left != nullptr && left->count > MinKeys)
+    {
+      // Borrow the largest key of the left sibling
+      if (child->leaf)
+      {
+        Leaf *target = static_cast<Leaf *>(child);
+        Leaf *source = static_cast<Leaf *>(left);
+        InsertAt(target->Keys(), target->count, 0, std::move(source->Keys()[source->count - 1]));
+        std::destroy_at(source->Keys() + source->count - 1);
+        parent->Keys()[index - 1] = target->Keys()[0];
+        parent->weights[index - 1]--;
+        parent->weights[index]++;
+      }
+      else
+      {
+        Inner *target = static_cast<Inner *>(child);
+        Inner *source = static_cast<Inner *>(left);
+        const ulong weight = source->weights[source->count];
+        InsertAt(target->Keys(), target->count, 0, std::move(parent->Keys()[index - 1])); // The separator comes down
+        InsertChild(target, 0, source->children[source->count], weight);
+        parent->Keys()[index - 1] = std::move(source->Keys()[source->count - 1]); // The sibling's last separator goes up
+        std::destroy_at(source->Keys() + source->count - 1);
+        parent->weights[index - 1] -= weight;
+        parent->weights[index] += weight;
+      }
+      left->count--;
+      child->count++;
+      return index;
+    }
+
+    if (right != nullptr && right->count > MinKeys)
+    {
+      // Borrow the smallest key of the right sibling
+      if (child->leaf)
+      {
+        Leaf *target = static_cast<Leaf *>(child);
+        Leaf *source = static_cast<Leaf *>(right);
+        new (target->Keys() + target->count) Data(std::move(source->Keys()[0]));
+        EraseAt(source->Keys(), source->count, 0);
+        parent->Keys()[index] = source->Keys()[0];
+        parent->weights[index]++;
+        parent->weights[index + 1]--;
+      }
+      else
+      {
+        Inner *target = static_cast<Inner *>(child);
+        Inner *source = static_cast<Inner *>(right);
+        const ulong weight = source->weights[0];
+        new (target->Keys() + target->count) Data(std::move(parent->Keys()[index]));
+        target->children[target->count + 1] = source->children[0];
+        target->weights[target->count + 1] = weight;
+        parent->Keys()[index] = std::move(source->Keys()[0]);
+        EraseAt(source->Keys(), source->count, 0);
+        EraseChild(source, 0);
+        parent->weights[index] += weight;
+        parent->weights[index + 1] -= weight;
+      }
+      right->count--;
+      child->count++;
+      return index;
+    }
+
+    // Both siblings are minimal: merge with one of them
+    if (right != nullptr)
+    {
+      MergeChildren(parent, index);
+      return index;
+    }
+    MergeChildren(parent, index - 1);
+    return index - 1;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::MergeChildren(Inner *parent, ulong index)
+  {
+    Node *leftNode = parent->children[index];
+    Node *rightNode = parent->children[index + 1];
+
+    if (leftNode->leaf)
+    {
+      Leaf *left = static_cast<Leaf *>(leftNode);
+      Leaf *right = static_cast<Leaf *>(rightNode);
+      MoveAppend(right->Keys(), right->count, left->Keys(), left->count);
+      left->count += right->count;
+
+      left->next = right->next;
+      if (right->next != nullptr)
+      {
+        right->next->prev = left;
+      }
+      else
+      {
+        last = left;
+      }
+      delete right;
+    }
+    else
+    {
+      Inner *left = static_cast<Inner *>(leftNode);
+      Inner *right = static_cast<Inner *>(rightNode);
+      new (left->Keys() + left->count) Data(std::move(parent->Keys()[index])); // The separator comes down between them
+      MoveAppend(right->Keys(), right->count, left->Keys(), left->count + 1);
+      for (ulong slot = 0; slot <= right->count; slot++)
+      {
+        left->children[left->count + 1 + slot] = right->children[slot];
+        left->weights[left->count + 1 + slot] = right->weights[slot];
+      }
+      left->count += right->count + 1;
+      delete right;
+    }
+
+    parent->weights[index] += parent->weights[index + 1];
+    EraseAt(parent->Keys(), parent->count, index);
+    EraseChild(parent, index + 1);
+    parent->count--;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::DeleteSubtree(Node *node) noexcept
+  {
+    if (node == nullptr)
+    {
+      return;
+    }
+
+    if (node->leaf)
+    {
+      Leaf *leaf = static_cast<Leaf *>(node);
+      std::destroy(leaf->Keys(), leaf->Keys() + leaf->count);
+      delete leaf;
+    }
+    else
+    {
+      Inner *inner = static_cast<Inner *>(node);
+      for (ulong slot = 0; slot <= inner->count; slot++)
+      {
+        DeleteSubtree(inner->children[slot]);
+      }
+      std::destroy(inner->Keys(), inner->Keys() + inner->count);
+      delete inner;
+    }
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  template <typename Value>
+  bool SetBTree<Data, NodeCapacity>::InsertValue(Value &&value)
+  {
+    if (root == nullptr)
+    {
+      Leaf *leaf = new Leaf();
+      new (leaf->Keys()) Data(std::forward<Value>(value));
+      leaf->count = 1;
+      root = first = last = leaf;
+      size = 1;
+      return true;
+    }
+
+    if (root->count == NodeCapacity)
+    {
+      Inner *top = new Inner(); // A full root splits under a new one: the tree gets taller
+      top->children[0] = root;
+      top->weights[0] = size;
+      root = top;
+      SplitChild(top, 0);
+    }
+
+    Inner *path[MaxDepth]; // Inner nodes walked, to fix their child sizes once the key is in
+    ulong slots[MaxDepth];
+    ulong depth = 0;
+
+    Node *node = root;
+    while (!node->leaf)
+    {
+      Inner *inner = static_cast<Inner *>(node);
+      ulong index = UpperBound(inner->Keys(), inner->count, value);
+      if (inner->children[index]->count == NodeCapacity)
+      {
+        SplitChild(inner, index); // The child can now take a key without overflowing
+        if (!(value < inner->Keys()[index]))
+        {
+          index++;
+        }
+      }
+
+      path[depth] = inner;
+      slots[depth] = index;
+      depth++;
+      node = inner->children[index];
+    }
+
+    Leaf *leaf = static_cast<Leaf *>(node);
+    const ulong slot = LowerBound(leaf->Keys(), leaf->count, value);
+    if (slot < leaf->count && !(value < leaf->Keys()[slot]))
+    {
+      return false; // Element already exists
+    }
+
+    InsertAt(leaf->Keys(), leaf->count, slot, std::forward<Value>(value));
+    leaf->count++;
+    for (ulong level = 0; level < depth; level++)
+    {
+      path[level]->weights[slots[level]]++;
+    }
+    size++;
+    return true;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  void SetBTree<Data, NodeCapacity>::BuildSorted(Vector<Data> &staged, bool sorted)
+  {
+    if (!sorted)
+    {
+      PdqSort(staged.begin(), staged.end());
+    }
+    else if (!IsSorted(staged.begin(), staged.end()))
+    {
+      throw std::invalid_argument("SetBTree: Input not sorted");
+    }
+    Data *end = Unique(staged.begin(), staged.end()); // Duplicates are adjacent once sorted
+    const ulong count = end - staged.begin();
+    if (count == 0)
+    {
+      return;
+    }
+
+    // Leaves as full as possible, sizes spread evenly so that none is below the minimum
+    ulong nodes = (count + NodeCapacity - 1) / NodeCapacity;
+    Vector<Node *> level(nodes);
+    Vector<ulong> weights(nodes);
+    Data *cursor = staged.begin();
+    Leaf *previous = nullptr;
+    for (ulong index = 0; index < nodes; index++)
+    {
+      const ulong take = count / nodes + ((index < count % nodes) ? 1 : 0);
+      Leaf *leaf = new Leaf();
+      MoveAppend(cursor, take, leaf->Keys(), 0);
+      leaf->count = take;
+      cursor += take;
+
+      leaf->prev = previous;
+      if (previous != nullptr)
+      {
+        previous->next = leaf;
+      }
+      previous = leaf;
+      level[index] = leaf;
+      weights[index] = take;
+    }
+    first = static_cast<Leaf *>(level[0]);
+    last = previous;
+
+    // Then every level of inner nodes, the same way, until one node is left
+    while (level.Size() > 1)
+    {
+      const ulong children = level.Size();
+      nodes = (children + NodeCapacity) / (NodeCapacity + 1);
+      Vector<Node *> upper(nodes);
+      Vector<ulong> upperWeights(nodes);
+      ulong next = 0;
+      for (ulong index = 0; index < nodes; index++)
+      {
+        const ulong take = children / nodes + ((index < children % nodes) ? 1 : 0);
+        Inner *inner = new Inner();
+        ulong weight = 0;
+        for (ulong slot = 0; slot < take; slot++, next++)
+        {
+          if (slot > 0)
+          {
+            new (inner->Keys() + slot - 1) Data(LeftmostKey(level[next]));
+          }
+          inner->children[slot] = level[next];
+          inner->weights[slot] = weights[next];
+          weight += weights[next];
+        }
+        inner->count = take - 1;
+        upper[index] = inner;
+        upperWeights[index] = weight;
+      }
+      level = std::move(upper);
+      weights = std::move(upperWeights);
+    }
+
+    root = level[0];
+    size = count;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  ulong SetBTree<Data, NodeCapacity>::InsertStaged(Vector<Data> &batch)
+  {
+    ulong added = 0;
+    for (Data *current = batch.begin(); current != batch.end(); ++current)
+    {
+      added += InsertValue(std::move(*current)); // Moved only when linked
+    }
+    return added;
+  }
+
+  template <typename Data, ulong NodeCapacity>
+  ulong SetBTree<Data, NodeCapacity>::RemoveStaged(Vector<Data> &batch)
+  {
+    ulong removed = 0;
+    for (const Data *current = batch.begin(); current != batch.end(); ++current)
+    {
+      removed += Remove(*current);
+    }
+    return removed;
+  }
+
+  /* ************************************************************************** */
+
+}
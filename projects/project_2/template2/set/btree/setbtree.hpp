@@ -0,0 +1,366 @@
+#ifndef SETBTREE_HPP
+#define SETBTREE_HPP
+
+/* ************************************************************************** */
+
+#include <iterator>
+#include <new>
+
+#include "../set.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Default number of keys per node: about 256 bytes of keys, at least 4
+  template <typename Data>
+  constexpr ulong BTreeNodeCapacity = (sizeof(Data) * 4 >= 256) ? 4 : 256 / sizeof(Data);
+
+  /* ************************************************************************** */
+
+  template <typename Data, ulong NodeCapacity = BTreeNodeCapacity<Data>>
+  class SetBTree : virtual public Set<Data>
+  {
+    // Must extend Set<Data>
+
+    // B+ tree: the elements live in leaves of up to NodeCapacity contiguous
+    // slots, linked in order for traversals and range walks; inner nodes hold
+    // separators, children and the size of every child subtree, so searches,
+    // updates and positional access are all O(log n) with a few cache lines
+    // read per level.
+
+    static_assert(NodeCapacity >= 4, "SetBTree nodes must hold at least four keys");
+
+  private:
+    // ...
+
+  protected:
+    using Container::size;
+
+    static constexpr ulong MinKeys = (NodeCapacity - 1) / 2; // Fewest keys in a node other than the root
+    static constexpr ulong MaxDepth = 64;                     // Levels below a root: far above any reachable height
+
+    struct Node
+    {
+      ulong count = 0; // Keys in a leaf, separators in an inner node
+      bool leaf;
+
+      // Specific constructor
+      explicit Node(bool isLeaf) noexcept : leaf(isLeaf) {}
+    };
+
+    struct Leaf : Node
+    {
+      Leaf *prev = nullptr; // Leaf with the preceding keys
+      Leaf *next = nullptr; // Leaf with the following keys
+
+      alignas(Data) unsigned char storage[NodeCapacity * sizeof(Data)]; // Keys, constructed in slots [0, count)
+
+      // Default constructor
+      Leaf() noexcept : Node(true) {}
+
+      Data *Keys() noexcept { return std::launder(reinterpret_cast<Data *>(storage)); }
+      const Data *Keys() const noexcept { return std::launder(reinterpret_cast<const Data *>(storage)); }
+    };
+
+    struct Inner : Node
+    {
+      // Separator i is above every key of child i and not above any key of child i + 1
+
+      alignas(Data) unsigned char storage[NodeCapacity * sizeof(Data)]; // Separators, constructed in slots [0, count)
+      Node *children[NodeCapacity + 1];                                 // count + 1 children
+      ulong weights[NodeCapacity + 1];                                  // Keys below every child
+
+      // Default constructor
+      Inner() noexcept : Node(false) {}
+
+      Data *Keys() noexcept { return std::launder(reinterpret_cast<Data *>(storage)); }
+      const Data *Keys() const noexcept { return std::launder(reinterpret_cast<const Data *>(storage)); }
+    };
+
+    Node *root = nullptr;  // nullptr when empty, a leaf while everything fits in one
+    Leaf *first = nullptr; // Leaf with the smallest keys
+    Leaf *last = nullptr;  // Leaf with the largest keys
+
+    class LeafIterator;
+
+  public:
+    // Default constructor
+    SetBTree() = default;
+
+    /* ************************************************************************ */
+
+    // Specific constructors (staged in one array, sorted and deduplicated there,
+    // then bulk loaded: O(n log n))
+    SetBTree(const TraversableContainer<Data> &);  // A set obtained from a TraversableContainer
+    SetBTree(MappableContainer<Data> &&) noexcept; // A set obtained from a MappableContainer
+
+    /* ************************************************************************ */
+
+    // Specific factories (input in ascending order, duplicates allowed: O(n), full
+    // leaves built bottom up; must throw std::invalid_argument when the input is not sorted)
+    static SetBTree FromSorted(const TraversableContainer<Data> &); // A set copied from sorted input
+    static SetBTree FromSorted(MappableContainer<Data> &&);         // A set moved from sorted input
+
+    /* ************************************************************************ */
+
+    // Copy constructor
+    SetBTree(const SetBTree &);
+
+    // Move constructor
+    SetBTree(SetBTree &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Destructor
+    virtual ~SetBTree();
+
+    /* ************************************************************************ */
+
+    // Copy assignment
+    SetBTree &operator=(const SetBTree &);
+
+    // Move assignment
+    SetBTree &operator=(SetBTree &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Comparison operators
+    bool operator==(const SetBTree &) const noexcept;
+    bool operator!=(const SetBTree &) const noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from OrderedDictionaryContainer)
+
+    const Data &Min() const override; // Return the smallest element in the set, O(1)
+    Data MinNRemove() override;       // Remove and return the smallest element
+    void RemoveMin() override;        // Remove the smallest element
+
+    const Data &Max() const override; // Return the largest element in the set, O(1)
+    Data MaxNRemove() override;       // Remove and return the largest element
+    void RemoveMax() override;        // Remove the largest element
+
+    const Data &Predecessor(const Data &) const override; // Find the largest element smaller than the given value
+    Data PredecessorNRemove(const Data &) override;       // Remove and return the predecessor
+    void RemovePredecessor(const Data &) override;        // Remove the predecessor
+
+    const Data &Successor(const Data &) const override; // Find the smallest element larger than the given value
+    Data SuccessorNRemove(const Data &) override;       // Remove and return the successor
+    void RemoveSuccessor(const Data &) override;        // Remove the successor
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from DictionaryContainer)
+
+    bool Insert(const Data &) override; // Add an element if not already present (copy)
+    bool Insert(Data &&) override;      // Add an element if not already present (move)
+    bool Remove(const Data &) override; // Remove an element if present
+
+    // Batched operations: the batch is staged first, so it may be the set itself
+
+    bool InsertAll(const TraversableContainer<Data> &) override; // True if every element was inserted (copy)
+    bool InsertAll(MappableContainer<Data> &&) override;         // True if every element was inserted (move)
+    bool RemoveAll(const TraversableContainer<Data> &) override; // True if every element was removed
+
+    bool InsertSome(const TraversableContainer<Data> &) override; // True if some element was inserted (copy)
+    bool InsertSome(MappableContainer<Data> &&) override;         // True if some element was inserted (move)
+    bool RemoveSome(const TraversableContainer<Data> &) override; // True if some element was removed
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from TestableContainer)
+
+    bool Exists(const Data &) const noexcept override; // Check if an element exists in the set
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from LinearContainer)
+
+    const Data &operator[](const ulong) const override; // Access by rank through the child sizes (must throw std::out_of_range when out of range)
+    const Data &Front() const override;                 // Smallest element (must throw std::length_error when empty)
+    const Data &Back() const override;                  // Largest element (must throw std::length_error when empty)
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from TraversableContainer)
+
+    using typename TraversableContainer<Data>::TraverseFun;
+
+    void Traverse(TraverseFun) const override; // Apply function to all elements in ascending order
+
+    using typename TraversableContainer<Data>::TraverseWhileFun;
+
+    bool TraverseWhile(TraverseWhileFun) const override; // Walk the leaves until the function returns false
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from PreOrderTraversableContainer)
+
+    void PreOrderTraverse(TraverseFun) const override; // Apply function to all elements in ascending order
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from PostOrderTraversableContainer)
+
+    void PostOrderTraverse(TraverseFun) const override; // Apply function to all elements in descending order
+
+    /* ************************************************************************ */
+
+    // Specific member functions (range scans along the leaves)
+
+    void TraverseRange(const Data &, const Data &, TraverseFun) const; // Elements in [low, high], ascending: O(log n + k)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (template fast paths, hiding the type-erased ones)
+
+    template <typename Fun>
+    void ForEach(Fun &&) const; // Apply callable to each element, ascending order
+
+    template <typename Accumulator, typename Fun>
+    Accumulator Reduce(Fun &&, Accumulator) const; // Fold with any callable, ascending order
+
+    /* ************************************************************************ */
+
+    // Specific member functions (read-only bidirectional iterators, ascending order)
+
+    using ConstIterator = LeafIterator;
+
+    ConstIterator begin() const noexcept; // Smallest element
+    ConstIterator end() const noexcept;   // Past the largest element
+
+    ConstIterator cbegin() const noexcept;
+    ConstIterator cend() const noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from ClearableContainer)
+
+    void Clear() override; // Remove all elements from the set
+
+  protected:
+    // Auxiliary functions (searches inside one node)
+
+    static ulong LowerBound(const Data *, ulong, const Data &) noexcept; // First slot not smaller than the value
+    static ulong UpperBound(const Data *, ulong, const Data &) noexcept; // First slot larger than the value
+
+    const Leaf *FindLeaf(const Data &) const noexcept; // Leaf whose range holds the value
+
+    static void Prefetch(const Node *) noexcept; // Request the header and the keys of a node
+
+    // Slot shuffling on raw storage
+
+    template <typename Value>
+    static void InsertAt(Data *, ulong, ulong, Value &&); // Open slot at the position of a run of count constructed keys
+    static void EraseAt(Data *, ulong, ulong);            // Close the slot, destroying the last one
+    static void MoveAppend(Data *, ulong, Data *, ulong); // Move a run to the end of another, destroying the source
+
+    static void InsertChild(Inner *, ulong, Node *, ulong) noexcept; // Open child slot at position
+    static void EraseChild(Inner *, ulong) noexcept;                 // Close child slot at position
+
+    static const Data &LeftmostKey(const Node *) noexcept;
+
+    // Restructuring (top down: a node is fixed before the walk enters it)
+
+    void SplitChild(Inner *, ulong);         // Split a full child, raising a separator into the parent
+    ulong RefillChild(Inner *, ulong);       // Give a minimal child one more key (borrow or merge), returns where its range went
+    void MergeChildren(Inner *, ulong);      // Merge child i + 1 into child i
+    void DeleteSubtree(Node *) noexcept;     // Destroy the keys and free every node below
+
+    template <typename Value>
+    bool InsertValue(Value &&);
+
+    void BuildSorted(Vector<Data> &, bool); // Deduplicate (after sorting when not claimed sorted), then bulk load (must throw std::invalid_argument when claimed sorted but not)
+
+    // Batched operations on a staged copy of the batch
+    ulong InsertStaged(Vector<Data> &); // Returns how many were new
+    ulong RemoveStaged(Vector<Data> &); // Returns how many were present
+
+    /* ************************************************************************ */
+
+    class LeafIterator
+    {
+      // Bidirectional iterator over (leaf, slot) positions: slots advance
+      // inside a leaf and roll over to the next one; end() is the null leaf,
+      // from which a decrement steps back onto the largest element
+
+      friend class SetBTree;
+
+    public:
+      using iterator_concept = std::bidirectional_iterator_tag;
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type = Data;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const Data *;
+      using reference = const Data &;
+
+      /* ********************************************************************** */
+
+      // Default constructor
+      LeafIterator() = default;
+
+      /* ********************************************************************** */
+
+      // Specific member functions
+
+      reference operator*() const noexcept { return current->Keys()[slot]; }
+      pointer operator->() const noexcept { return current->Keys() + slot; }
+
+      LeafIterator &operator++() noexcept
+      {
+        if (++slot == current->count)
+        {
+          current = current->next;
+          slot = 0;
+        }
+        return *this;
+      }
+
+      LeafIterator operator++(int) noexcept
+      {
+        LeafIterator previous = *this;
+        ++*this;
+        return previous;
+      }
+
+      LeafIterator &operator--() noexcept
+      {
+        if (current == nullptr || slot == 0)
+        {
+          current = (current == nullptr) ? owner->last : current->prev;
+          slot = current->count;
+        }
+        slot--;
+        return *this;
+      }
+
+      LeafIterator operator--(int) noexcept
+      {
+        LeafIterator previous = *this;
+        --*this;
+        return previous;
+      }
+
+      bool operator==(const LeafIterator &other) const noexcept { return current == other.current && slot == other.slot; }
+
+    private:
+      LeafIterator(const Leaf *leaf, ulong position, const SetBTree *set) noexcept : current(leaf), slot(position), owner(set) {}
+
+      const Leaf *current = nullptr;   // Leaf under the iterator (nullptr past the end)
+      ulong slot = 0;                  // Position inside the leaf
+      const SetBTree *owner = nullptr; // Set walked, to step back from the end
+    };
+  };
+
+  /* ************************************************************************** */
+
+}
+
+#include "setbtree.cpp" // Include implementation file
+
+#endif
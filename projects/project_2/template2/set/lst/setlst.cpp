@@ -4,91 +4,101 @@ namespace lasd
 
   // Specific constructors
 
-  template <typename Data>
-  SetLst<Data>::SetLst(const TraversableContainer<Data> &container)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  SetLst<Data, Allocator, Compare>::SetLst(const Compare &order) : compare(order) {}
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  SetLst<Data, Allocator, Compare>::SetLst(const TraversableContainer<Data> &container, const Compare &order) : compare(order)
   {
-    container.Traverse([this](const Data &data)
-                       { Insert(data); }); // Insert each element from container into the set
+    Vector<Data> staged(container); // Sorting an array beats sorting nodes: one copy, then contiguous work
+    LinkStaged(staged);
   }
 
-  template <typename Data>
-  SetLst<Data>::SetLst(MappableContainer<Data> &&container) noexcept
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  SetLst<Data, Allocator, Compare>::SetLst(MappableContainer<Data> &&container, const Compare &order) noexcept : compare(order)
   {
-    container.Map([this](Data &data)
-                  { Insert(std::move(data)); }); // Move each element from container into the set
+    Vector<Data> staged(std::move(container)); // Elements are moved through the array into the nodes
+    LinkStaged(staged);
   }
 
-  // Copy constructor
-  template <typename Data>
-  SetLst<Data>::SetLst(const SetLst<Data> &other) : List<Data>()
+  // Specific factories
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  SetLst<Data, Allocator, Compare> SetLst<Data, Allocator, Compare>::FromSorted(const TraversableContainer<Data> &container, const Compare &order)
   {
-    if (!other.Empty())
-    {
-      other.Traverse([this](const Data &data)
-                     { Insert(data); }); // Insert elements one by one to maintain set properties
-    }
+    SetLst<Data, Allocator, Compare> set(order);
+    container.Traverse([&set](const Data &data)
+                       { set.AppendSorted(data); }); // No staging: the input order is the list order
+    return set;
+  }
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  SetLst<Data, Allocator, Compare> SetLst<Data, Allocator, Compare>::FromSorted(MappableContainer<Data> &&container, const Compare &order)
+  {
+    SetLst<Data, Allocator, Compare> set(order);
+    container.Map([&set](Data &data)
+                  { set.AppendSorted(std::move(data)); });
+    return set;
   }
 
+  // Copy constructor
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  SetLst<Data, Allocator, Compare>::SetLst(const SetLst<Data, Allocator, Compare> &other) : List<Data, Allocator>(other), compare(other.compare) {} // Other is already sorted: copy its chain as is
+
   // Move constructor
-  template <typename Data>
-  SetLst<Data>::SetLst(SetLst<Data> &&other) noexcept : List<Data>(std::move(other)) {} // Use List's move constructor
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  SetLst<Data, Allocator, Compare>::SetLst(SetLst<Data, Allocator, Compare> &&other) noexcept : List<Data, Allocator>(std::move(other)), compare(other.compare) {} // Use List's move constructor
 
   // Copy assignment
-  template <typename Data>
-  SetLst<Data> &SetLst<Data>::operator=(const SetLst<Data> &other)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  SetLst<Data, Allocator, Compare> &SetLst<Data, Allocator, Compare>::operator=(const SetLst<Data, Allocator, Compare> &other)
   {
     if (this != &other)
     {
-      Clear(); // Remove all existing elements
-      other.Traverse([this](const Data &data)
-                     { Insert(data); }); // Insert elements one by one to maintain set properties
+      List<Data, Allocator>::operator=(other); // Other is already sorted: reuse List's node-recycling copy
+      compare = other.compare;
     }
     return *this;
   }
 
   // Move assignment
-  template <typename Data>
-  SetLst<Data> &SetLst<Data>::operator=(SetLst<Data> &&other) noexcept
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  SetLst<Data, Allocator, Compare> &SetLst<Data, Allocator, Compare>::operator=(SetLst<Data, Allocator, Compare> &&other) noexcept
   {
     if (this != &other)
     {
-      List<Data>::operator=(std::move(other)); // Use List's move assignment
+      List<Data, Allocator>::operator=(std::move(other)); // Use List's move assignment
+      compare = other.compare; // Copied: the other set stays usable
     }
     return *this;
   }
 
   // Comparison operators
-  template <typename Data>
-  bool SetLst<Data>::operator==(const SetLst<Data> &other) const noexcept
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::operator==(const SetLst<Data, Allocator, Compare> &other) const noexcept
   {
     if (size != other.size)
     {
       return false; // Sets of different sizes cannot be equal
     }
 
-    // For sets, we need to check both ways:
-    // all elements of this exist in other and vice versa
-    bool allElementsExist = true;
-
-    this->Traverse([&other, &allElementsExist](const Data &data)
-                   {
-        if (!other.Exists(data)) {
-          allElementsExist = false;  // Element not found in other set
-        } });
-
-    return allElementsExist; // All elements match
+    // Same size, so every element of this in other means the sets are equal
+    return this->TraverseWhile([&other](const Data &data)
+                               {
+                                 return other.Exists(data); // Stop at the first element missing from other
+                               });
   }
 
-  template <typename Data>
-  bool SetLst<Data>::operator!=(const SetLst<Data> &other) const noexcept
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::operator!=(const SetLst<Data, Allocator, Compare> &other) const noexcept
   {
     return !(*this == other); // Use equality operator for inverse check
   }
 
   // Specific member functions (inherited from OrderedDictionaryContainer)
 
-  template <typename Data>
-  const Data &SetLst<Data>::Min() const
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  const Data &SetLst<Data, Allocator, Compare>::Min() const
   {
     if (this->Empty())
     {
@@ -98,30 +108,30 @@ namespace lasd
     return head->element; // In a sorted set, head element is the minimum
   }
 
-  template <typename Data>
-  Data SetLst<Data>::MinNRemove()
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  Data SetLst<Data, Allocator, Compare>::MinNRemove()
   {
     if (this->Empty())
     {
       throw std::length_error("SetLst: Empty container");
     }
 
-    return List<Data>::FrontNRemove(); // Remove and return first element
+    return List<Data, Allocator>::FrontNRemove(); // Remove and return first element
   }
 
-  template <typename Data>
-  void SetLst<Data>::RemoveMin()
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  void SetLst<Data, Allocator, Compare>::RemoveMin()
   {
     if (this->Empty())
     {
       throw std::length_error("SetLst: Empty container");
     }
 
-    List<Data>::RemoveFromFront(); // Remove first element
+    List<Data, Allocator>::RemoveFromFront(); // Remove first element
   }
 
-  template <typename Data>
-  const Data &SetLst<Data>::Max() const
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  const Data &SetLst<Data, Allocator, Compare>::Max() const
   {
     if (this->Empty())
     {
@@ -131,30 +141,30 @@ namespace lasd
     return tail->element; // In a sorted set, tail element is the maximum
   }
 
-  template <typename Data>
-  Data SetLst<Data>::MaxNRemove()
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  Data SetLst<Data, Allocator, Compare>::MaxNRemove()
   {
     if (this->Empty())
     {
       throw std::length_error("SetLst: Empty container");
     }
 
-    return List<Data>::BackNRemove(); // Remove and return last element
+    return List<Data, Allocator>::BackNRemove(); // Remove and return last element
   }
 
-  template <typename Data>
-  void SetLst<Data>::RemoveMax()
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  void SetLst<Data, Allocator, Compare>::RemoveMax()
   {
     if (this->Empty())
     {
       throw std::length_error("SetLst: Empty container");
     }
 
-    List<Data>::RemoveFromBack(); // Remove last element
+    List<Data, Allocator>::RemoveFromBack(); // Remove last element
   }
 
-  template <typename Data>
-  const Data &SetLst<Data>::Predecessor(const Data &data) const
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  const Data &SetLst<Data, Allocator, Compare>::Predecessor(const Data &data) const
   {
     if (this->Empty())
     {
@@ -170,8 +180,8 @@ namespace lasd
     return predNode->element; // Return predecessor element
   }
 
-  template <typename Data>
-  Data SetLst<Data>::PredecessorNRemove(const Data &data)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  Data SetLst<Data, Allocator, Compare>::PredecessorNRemove(const Data &data)
   {
     if (this->Empty())
     {
@@ -187,36 +197,13 @@ namespace lasd
     Data result = predNode->element; // Save predecessor value
 
     // Remove the predecessor
-    if (predNode == head)
-    {
-      RemoveMin(); // Use RemoveMin if predecessor is the first element
-    }
-    else
-    {
-      // Find the node before the predecessor
-      Node *current = head;
-      while (current->next != predNode)
-      {
-        current = current->next;
-      }
-
-      // Remove predecessor from the list
-      current->next = predNode->next;
-
-      if (predNode == tail)
-      {
-        tail = current; // Update tail if predecessor was the last element
-      }
-
-      delete predNode; // Free memory
-      size--;          // Update size
-    }
+    List<Data, Allocator>::RemoveNode(predNode); // Unlink through the prev link, no scan from head
 
     return result; // Return saved value
   }
 
-  template <typename Data>
-  void SetLst<Data>::RemovePredecessor(const Data &data)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  void SetLst<Data, Allocator, Compare>::RemovePredecessor(const Data &data)
   {
     if (this->Empty())
     {
@@ -230,34 +217,11 @@ namespace lasd
     }
 
     // Remove the predecessor
-    if (predNode == head)
-    {
-      RemoveMin(); // Use RemoveMin if predecessor is the first element
-    }
-    else
-    {
-      // Find the node before the predecessor
-      Node *current = head;
-      while (current->next != predNode)
-      {
-        current = current->next;
-      }
-
-      // Remove predecessor from the list
-      current->next = predNode->next;
-
-      if (predNode == tail)
-      {
-        tail = current; // Update tail if predecessor was the last element
-      }
-
-      delete predNode; // Free memory
-      size--;          // Update size
-    }
+    List<Data, Allocator>::RemoveNode(predNode); // Unlink through the prev link, no scan from head
   }
 
-  template <typename Data>
-  const Data &SetLst<Data>::Successor(const Data &data) const
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  const Data &SetLst<Data, Allocator, Compare>::Successor(const Data &data) const
   {
     if (this->Empty())
     {
@@ -273,8 +237,8 @@ namespace lasd
     return succNode->element; // Return successor element
   }
 
-  template <typename Data>
-  Data SetLst<Data>::SuccessorNRemove(const Data &data)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  Data SetLst<Data, Allocator, Compare>::SuccessorNRemove(const Data &data)
   {
     if (this->Empty())
     {
@@ -290,36 +254,13 @@ namespace lasd
     Data result = succNode->element; // Save successor value
 
     // Remove the successor
-    if (succNode == head)
-    {
-      RemoveMin(); // Use RemoveMin if successor is the first element
-    }
-    else
-    {
-      // Find the node before the successor
-      Node *current = head;
-      while (current->next != succNode)
-      {
-        current = current->next;
-      }
-
-      // Remove successor from the list
-      current->next = succNode->next;
-
-      if (succNode == tail)
-      {
-        tail = current; // Update tail if successor was the last element
-      }
-
-      delete succNode; // Free memory
-      size--;          // Update size
-    }
+    List<Data, Allocator>::RemoveNode(succNode); // Unlink through the prev link, no scan from head
 
     return result; // Return saved value
   }
 
-  template <typename Data>
-  void SetLst<Data>::RemoveSuccessor(const Data &data)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  void SetLst<Data, Allocator, Compare>::RemoveSuccessor(const Data &data)
   {
     if (this->Empty())
     {
@@ -333,98 +274,75 @@ namespace lasd
     }
 
     // Remove the successor
-    if (succNode == head)
-    {
-      RemoveMin(); // Use RemoveMin if successor is the first element
-    }
-    else
-    {
-      // Find the node before the successor
-      Node *current = head;
-      while (current->next != succNode)
-      {
-        current = current->next;
-      }
-
-      // Remove successor from the list
-      current->next = succNode->next;
-
-      if (succNode == tail)
-      {
-        tail = current; // Update tail if successor was the last element
-      }
-
-      delete succNode; // Free memory
-      size--;          // Update size
-    }
+    List<Data, Allocator>::RemoveNode(succNode); // Unlink through the prev link, no scan from head
   }
 
   // Specific member functions (inherited from DictionaryContainer)
 
-  template <typename Data>
-  bool SetLst<Data>::Insert(const Data &data)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::Insert(const Data &data)
   {
     if (this->Empty())
     {
-      List<Data>::InsertAtFront(data); // Insert into empty list
+      List<Data, Allocator>::InsertAtFront(data); // Insert into empty list
       return true;
     }
 
     Node *predNode = FindNodeWithBinarySearch(data); // Find insertion point
 
     // Check if element already exists
-    if (predNode != nullptr && predNode->next != nullptr && predNode->next->element == data)
+    if (predNode != nullptr && predNode->next != nullptr && Equivalent(predNode->next->element, data, compare))
     {
       return false; // Element already exists
     }
 
     if (predNode == nullptr)
     {
-      if (head->element == data)
+      if (Equivalent(head->element, data, compare))
       {
         return false; // Element already exists at head
       }
 
-      List<Data>::InsertAtFront(data); // Insert at front if smaller than head
+      List<Data, Allocator>::InsertAtFront(data); // Insert at front if smaller than head
       return true;
     }
 
     return InsertInOrder(predNode, data); // Insert at correct position to maintain order
   }
 
-  template <typename Data>
-  bool SetLst<Data>::Insert(Data &&data)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::Insert(Data &&data)
   {
     if (this->Empty())
     {
-      List<Data>::InsertAtFront(std::move(data)); // Insert into empty list
+      List<Data, Allocator>::InsertAtFront(std::move(data)); // Insert into empty list
       return true;
     }
 
     Node *predNode = FindNodeWithBinarySearch(data); // Find insertion point
 
     // Check if element already exists
-    if (predNode != nullptr && predNode->next != nullptr && predNode->next->element == data)
+    if (predNode != nullptr && predNode->next != nullptr && Equivalent(predNode->next->element, data, compare))
     {
       return false; // Element already exists
     }
 
     if (predNode == nullptr)
     {
-      if (head->element == data)
+      if (Equivalent(head->element, data, compare))
       {
         return false; // Element already exists at head
       }
 
-      List<Data>::InsertAtFront(std::move(data)); // Insert at front if smaller than head
+      List<Data, Allocator>::InsertAtFront(std::move(data)); // Insert at front if smaller than head
       return true;
     }
 
     return InsertInOrder(predNode, std::move(data)); // Insert at correct position to maintain order
   }
 
-  template <typename Data>
-  bool SetLst<Data>::Remove(const Data &data)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::Remove(const Data &data)
   {
     if (this->Empty())
     {
@@ -432,14 +350,14 @@ namespace lasd
     }
 
     // If the element is the head
-    if (head->element == data)
+    if (Equivalent(head->element, data, compare))
     {
       RemoveMin(); // Use RemoveMin for head element
       return true;
     }
 
     // If the element is the tail
-    if (tail->element == data)
+    if (Equivalent(tail->element, data, compare))
     {
       RemoveMax(); // Use RemoveMax for tail element
       return true;
@@ -448,58 +366,124 @@ namespace lasd
     Node *predNode = FindNodeWithBinarySearch(data); // Find node before target
 
     // Check if element exists
-    if (predNode != nullptr && predNode->next != nullptr && predNode->next->element == data)
+    if (predNode != nullptr && predNode->next != nullptr && Equivalent(predNode->next->element, data, compare))
     {
-      Node *toDelete = predNode->next; // Node to remove
-      predNode->next = toDelete->next; // Remove from list
-      delete toDelete;                 // Free memory
-      size--;                          // Update size
+      List<Data, Allocator>::RemoveNode(predNode->next); // Remove from list and free memory
       return true;
     }
 
     return false; // Element not found
   }
 
+  // Batched operations (inherited from DictionaryContainer)
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::InsertAll(const TraversableContainer<Data> &container)
+  {
+    ulong requested = container.Size();
+    Vector<Data> batch(container); // Staged first: container may be this set
+    return MergeInsert(batch) == requested; // Duplicates in the batch count as failed inserts
+  }
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::InsertAll(MappableContainer<Data> &&container)
+  {
+    ulong requested = container.Size();
+    Vector<Data> batch(std::move(container));
+    return MergeInsert(batch) == requested;
+  }
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::RemoveAll(const TraversableContainer<Data> &container)
+  {
+    ulong requested = container.Size();
+    Vector<Data> batch(container);
+    return MergeRemove(batch) == requested;
+  }
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::InsertSome(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return MergeInsert(batch) > 0;
+  }
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::InsertSome(MappableContainer<Data> &&container)
+  {
+    Vector<Data> batch(std::move(container));
+    return MergeInsert(batch) > 0;
+  }
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::RemoveSome(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return MergeRemove(batch) > 0;
+  }
+
+  // Specific member functions (iterators)
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  typename SetLst<Data, Allocator, Compare>::ConstIterator SetLst<Data, Allocator, Compare>::begin() const noexcept
+  {
+    return List<Data, Allocator>::cbegin(); // Read-only: writing through it could break the ordering
+  }
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  typename SetLst<Data, Allocator, Compare>::ConstIterator SetLst<Data, Allocator, Compare>::end() const noexcept
+  {
+    return List<Data, Allocator>::cend();
+  }
+
+  // Specific member functions (ordering)
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  Compare SetLst<Data, Allocator, Compare>::Comparator() const
+  {
+    return compare;
+  }
+
   // Specific member function (inherited from TestableContainer)
 
-  template <typename Data>
-  bool SetLst<Data>::Exists(const Data &data) const noexcept
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::Exists(const Data &data) const noexcept
   {
     if (this->Empty())
     {
       return false; // Empty set contains no elements
     }
 
-    if (head->element == data)
+    if (Equivalent(head->element, data, compare))
     {
       return true; // Check head element first
     }
 
     Node *predNode = FindNodeWithBinarySearch(data);                                              // Find node before target
-    return (predNode != nullptr && predNode->next != nullptr && predNode->next->element == data); // Check if element exists
+    return (predNode != nullptr && predNode->next != nullptr && Equivalent(predNode->next->element, data, compare)); // Check if element exists
   }
 
   // Auxiliary functions
 
-  template <typename Data>
-  typename SetLst<Data>::Node *SetLst<Data>::FindNodeWithBinarySearch(const Data &data) const
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  typename SetLst<Data, Allocator, Compare>::Node *SetLst<Data, Allocator, Compare>::FindNodeWithBinarySearch(const Data &data) const
   {
     if (this->Empty())
     {
       return nullptr; // Empty list
     }
 
-    if (data < head->element)
+    if (compare(data, head->element))
     {
       return nullptr; // Data is smaller than minimum
     }
 
-    if (data == head->element)
+    if (Equivalent(data, head->element, compare))
     {
       return nullptr; // Data equals head element
     }
 
-    if (data > tail->element)
+    if (compare(tail->element, data))
     {
       return tail; // Data is larger than maximum
     }
@@ -516,7 +500,7 @@ namespace lasd
 
       Node *midNode = this->GetNodeAt(mid); // Get node at middle index
 
-      if (midNode->element == data)
+      if (Equivalent(midNode->element, data, compare))
       {
         if (mid == 0)
         {
@@ -527,7 +511,7 @@ namespace lasd
           return this->GetNodeAt(mid - 1); // Return node before the match
         }
       }
-      else if (midNode->element < data)
+      else if (compare(midNode->element, data))
       {
         result = midNode; // Update result with potential predecessor
         left = mid + 1;   // Search right half
@@ -543,8 +527,8 @@ namespace lasd
     return result; // Return predecessor node or nullptr
   }
 
-  template <typename Data>
-  typename SetLst<Data>::Node *SetLst<Data>::FindSuccessorNode(const Data &data) const
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  typename SetLst<Data, Allocator, Compare>::Node *SetLst<Data, Allocator, Compare>::FindSuccessorNode(const Data &data) const
   {
     if (this->Empty())
     {
@@ -552,12 +536,12 @@ namespace lasd
     }
 
     // If data is greater than or equal to the maximum, there is no successor
-    if (data >= tail->element)
+    if (!compare(data, tail->element))
     {
       return nullptr; // No successor if data >= maximum
     }
 
-    if (data < head->element)
+    if (compare(data, head->element))
     {
       return head; // Head is successor if data < minimum
     }
@@ -566,14 +550,14 @@ namespace lasd
 
     if (predNode == nullptr)
     {
-      if (data == head->element && head->next != nullptr)
+      if (Equivalent(data, head->element, compare) && head->next != nullptr)
       {
         return head->next; // If data equals head, successor is next node
       }
       return head; // Otherwise head is successor
     }
 
-    if (predNode->next != nullptr && predNode->next->element == data)
+    if (predNode->next != nullptr && Equivalent(predNode->next->element, data, compare))
     {
       return predNode->next->next; // If found exact match, successor is next node
     }
@@ -581,8 +565,8 @@ namespace lasd
     return predNode->next; // Otherwise successor is next node after predecessor
   }
 
-  template <typename Data>
-  typename SetLst<Data>::Node *SetLst<Data>::FindPredecessorNode(const Data &data) const
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  typename SetLst<Data, Allocator, Compare>::Node *SetLst<Data, Allocator, Compare>::FindPredecessorNode(const Data &data) const
   {
     if (this->Empty())
     {
@@ -590,20 +574,20 @@ namespace lasd
     }
 
     // If data is less than or equal to the minimum, there is no predecessor
-    if (data <= head->element)
+    if (!compare(head->element, data))
     {
       return nullptr; // No predecessor if data <= minimum
     }
 
     // If data is greater than the maximum, the predecessor is the maximum
-    if (data > tail->element)
+    if (compare(tail->element, data))
     {
       return tail; // Tail is predecessor if data > maximum
     }
 
     Node *predNode = FindNodeWithBinarySearch(data); // Find predecessor node
 
-    if (predNode != nullptr && predNode->next != nullptr && predNode->next->element == data)
+    if (predNode != nullptr && predNode->next != nullptr && Equivalent(predNode->next->element, data, compare))
     {
       return predNode; // If found exact match, predecessor is previous node
     }
@@ -611,54 +595,142 @@ namespace lasd
     return predNode; // Otherwise return found predecessor
   }
 
-  template <typename Data>
-  bool SetLst<Data>::InsertInOrder(Node *predNode, const Data &data)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::InsertInOrder(Node *predNode, const Data &data)
   {
     if (predNode == nullptr)
     {
-      List<Data>::InsertAtFront(data); // Insert at front if no predecessor
+      List<Data, Allocator>::InsertAtFront(data); // Insert at front if no predecessor
       return true;
     }
 
-    if (predNode == tail && predNode->element < data)
+    if (predNode == tail && compare(predNode->element, data))
     {
-      List<Data>::InsertAtBack(data); // Insert at back if larger than maximum
+      List<Data, Allocator>::InsertAtBack(data); // Insert at back if larger than maximum
       return true;
     }
 
     // Insert between predecessor and its next node
-    Node *newNode = new Node(data); // Create new node
-    newNode->next = predNode->next; // Link to next node
-    predNode->next = newNode;       // Link from predecessor
+    Node *newNode = allocator.New(data); // Create new node
+    newNode->next = predNode->next;      // Link to next node
+    newNode->prev = predNode;            // Link back to predecessor
+    predNode->next->prev = newNode;      // Link back from next node
+    predNode->next = newNode;            // Link from predecessor
 
     size++; // Update size
     return true;
   }
 
-  template <typename Data>
-  bool SetLst<Data>::InsertInOrder(Node *predNode, Data &&data)
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  bool SetLst<Data, Allocator, Compare>::InsertInOrder(Node *predNode, Data &&data)
   {
     if (predNode == nullptr)
     {
-      List<Data>::InsertAtFront(std::move(data)); // Insert at front if no predecessor
+      List<Data, Allocator>::InsertAtFront(std::move(data)); // Insert at front if no predecessor
       return true;
     }
 
-    if (predNode == tail && predNode->element < data)
+    if (predNode == tail && compare(predNode->element, data))
     {
-      List<Data>::InsertAtBack(std::move(data)); // Insert at back if larger than maximum
+      List<Data, Allocator>::InsertAtBack(std::move(data)); // Insert at back if larger than maximum
       return true;
     }
 
     // Insert between predecessor and its next node
-    Node *newNode = new Node(std::move(data)); // Create new node with moved data
-    newNode->next = predNode->next;            // Link to next node
-    predNode->next = newNode;                  // Link from predecessor
+    Node *newNode = allocator.New(std::move(data)); // Create new node with moved data
+    newNode->next = predNode->next;                 // Link to next node
+    newNode->prev = predNode;                       // Link back to predecessor
+    predNode->next->prev = newNode;                 // Link back from next node
+    predNode->next = newNode;                       // Link from predecessor
 
     size++; // Update size
     return true;
   }
 
+  // Bulk loading
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  void SetLst<Data, Allocator, Compare>::LinkStaged(Vector<Data> &staged)
+  {
+    PdqSort(staged.begin(), staged.end(), compare);
+    Data *last = Unique(staged.begin(), staged.end(), compare); // Duplicates are adjacent once sorted
+
+    for (Data *current = staged.begin(); current != last; ++current)
+    {
+      List<Data, Allocator>::InsertAtBack(std::move(*current)); // O(1) each: the set is built in order
+    }
+  }
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  ulong SetLst<Data, Allocator, Compare>::MergeInsert(Vector<Data> &batch)
+  {
+    PdqSort(batch.begin(), batch.end(), compare);
+    Data *keys = batch.begin();
+    ulong count = Unique(batch.begin(), batch.end(), compare) - keys;
+
+    // One walk: the cursor only moves forward because the keys ascend
+    Node *cursor = head;
+    ulong added = 0;
+    for (ulong j = 0; j < count; j++)
+    {
+      while (cursor != nullptr && compare(cursor->element, keys[j]))
+      {
+        cursor = cursor->next;
+      }
+      if (cursor != nullptr && !compare(keys[j], cursor->element))
+      {
+        continue; // Already in the set
+      }
+      InsertInOrder((cursor == nullptr) ? tail : cursor->prev, std::move(keys[j])); // Link right before the cursor
+      added++;
+    }
+    return added;
+  }
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  ulong SetLst<Data, Allocator, Compare>::MergeRemove(Vector<Data> &batch)
+  {
+    PdqSort(batch.begin(), batch.end(), compare);
+    const Data *keys = batch.begin();
+    ulong count = Unique(batch.begin(), batch.end(), compare) - keys;
+
+    Node *cursor = head;
+    ulong removed = 0;
+    for (ulong j = 0; j < count && cursor != nullptr; j++)
+    {
+      while (cursor != nullptr && compare(cursor->element, keys[j]))
+      {
+        cursor = cursor->next;
+      }
+      if (cursor != nullptr && !compare(keys[j], cursor->element))
+      {
+        Node *next = cursor->next;
+        List<Data, Allocator>::RemoveNode(cursor); // O(1) through the prev link
+        cursor = next;
+        removed++;
+      }
+    }
+    return removed;
+  }
+
+  template <typename Data, template <typename> class Allocator, typename Compare>
+  template <typename Value>
+  void SetLst<Data, Allocator, Compare>::AppendSorted(Value &&data)
+  {
+    if (tail != nullptr)
+    {
+      if (compare(data, tail->element))
+      {
+        throw std::invalid_argument("SetLst: Input not sorted");
+      }
+      if (!compare(tail->element, data))
+      {
+        return; // Duplicate of the current maximum
+      }
+    }
+    List<Data, Allocator>::InsertAtBack(std::forward<Value>(data));
+  }
+
   /* ************************************************************************** */
 
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "../set.hpp"
 #include "../../list/list.hpp"
+#include "../../vector/vector.hpp"
 
 /* ************************************************************************** */
 
@@ -13,20 +14,25 @@ namespace lasd
 
   /* ************************************************************************** */
 
-  template <typename Data>
+  template <typename Data, template <typename> class Allocator = HeapAllocator, typename Compare = std::less<Data>>
   class SetLst : virtual public Set<Data>,
-                 virtual protected List<Data>
+                 virtual protected List<Data, Allocator>
   {
     // Must extend Set<Data>,
     //             List<Data>
+    // Compare: strict weak ordering of the elements (ascending by default);
+    // elements neither before nor after each other are the same element
 
   private:
     // ...
 
   protected:
-    using Container::size;  // Access to size member from Container
-    using List<Data>::head; // Access to head node pointer from List
-    using List<Data>::tail; // Access to tail node pointer from List
+    using Container::size;                  // Access to size member from Container
+    using List<Data, Allocator>::head;      // Access to head node pointer from List
+    using List<Data, Allocator>::tail;      // Access to tail node pointer from List
+    using List<Data, Allocator>::allocator; // Access to node storage from List
+
+    [[no_unique_address]] Compare compare = Compare(); // Takes no space when stateless
 
   public:
     // Default constructor
@@ -34,9 +40,18 @@ namespace lasd
 
     /* ************************************************************************ */
 
-    // Specific constructors
-    SetLst(const TraversableContainer<Data> &);  // A set obtained from a TraversableContainer
-    SetLst(MappableContainer<Data> &&) noexcept; // A set obtained from a MappableContainer
+    // Specific constructors (staged in one array, sorted and deduplicated there,
+    // then linked in one pass: O(n log n))
+    explicit SetLst(const Compare &);                                         // An empty set ordered by the given comparator
+    SetLst(const TraversableContainer<Data> &, const Compare & = Compare());  // A set obtained from a TraversableContainer
+    SetLst(MappableContainer<Data> &&, const Compare & = Compare()) noexcept; // A set obtained from a MappableContainer
+
+    /* ************************************************************************ */
+
+    // Specific factories (input in Compare order, duplicates allowed: O(n), linked
+    // as it is traversed; must throw std::invalid_argument when the input is not sorted)
+    static SetLst FromSorted(const TraversableContainer<Data> &, const Compare & = Compare()); // A set copied from sorted input
+    static SetLst FromSorted(MappableContainer<Data> &&, const Compare & = Compare());         // A set moved from sorted input
 
     /* ************************************************************************ */
 
@@ -93,6 +108,23 @@ namespace lasd
     bool Insert(Data &&) override;      // Add an element if not already present (move)
     bool Remove(const Data &) override; // Remove an element if present
 
+    // Batched operations: the batch is staged, sorted and deduplicated once, then merged
+    // with the set in one linear pass, O(n + m log m); results as with one call per element
+
+    bool InsertAll(const TraversableContainer<Data> &) override; // True if every element was inserted (copy)
+    bool InsertAll(MappableContainer<Data> &&) override;         // True if every element was inserted (move)
+    bool RemoveAll(const TraversableContainer<Data> &) override; // True if every element was removed
+
+    bool InsertSome(const TraversableContainer<Data> &) override; // True if some element was inserted (copy)
+    bool InsertSome(MappableContainer<Data> &&) override;         // True if some element was inserted (move)
+    bool RemoveSome(const TraversableContainer<Data> &) override; // True if some element was removed
+
+    /* ************************************************************************ */
+
+    // Specific member functions (ordering)
+
+    Compare Comparator() const; // The ordering of the elements (Min is the first in it)
+
     /* ************************************************************************ */
 
     // Specific member functions (inherited from TestableContainer)
@@ -103,19 +135,36 @@ namespace lasd
 
     // Specific member functions (inherited from LinearContainer)
 
-    using List<Data>::operator[]; // Access elements by index
-    using List<Data>::Front;      // Access first element
-    using List<Data>::Back;       // Access last element
+    using List<Data, Allocator>::operator[]; // Access elements by index
+    using List<Data, Allocator>::Front;      // Access first element
+    using List<Data, Allocator>::Back;       // Access last element
+
+    using List<Data, Allocator>::TraverseWhile; // Early-exit traversal (ascending order)
+
+    using List<Data, Allocator>::ForEach; // Template traversal fast path (ascending order)
+    using List<Data, Allocator>::Reduce;  // Template fold fast path (ascending order)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (read-only bidirectional iterators, ascending order)
+
+    using ConstIterator = typename List<Data, Allocator>::ConstIterator;
+
+    ConstIterator begin() const noexcept; // Smallest element
+    ConstIterator end() const noexcept;   // Past the largest element
+
+    using List<Data, Allocator>::cbegin;
+    using List<Data, Allocator>::cend;
 
     /* ************************************************************************ */
 
     // Specific member function (inherited from ClearableContainer)
 
-    using List<Data>::Clear; // Remove all elements from the set
+    using List<Data, Allocator>::Clear; // Remove all elements from the set
 
   protected:
     // Auxiliary functions for binary search operations
-    typedef typename List<Data>::Node Node; // Use Node type from List
+    typedef typename List<Data, Allocator>::Node Node; // Use Node type from List
 
     // Binary search (finds a node with the data or its insertion position)
     Node *FindNodeWithBinarySearch(const Data &) const; // Efficiently locate node in sorted list
@@ -129,6 +178,16 @@ namespace lasd
     // Insert maintaining order
     bool InsertInOrder(Node *, const Data &); // Insert element (copy) in sorted position
     bool InsertInOrder(Node *, Data &&);      // Insert element (move) in sorted position
+
+    // Bulk loading
+    void LinkStaged(Vector<Data> &); // Sort and deduplicate the staged elements, then move them to the back in order
+
+    template <typename Value>
+    void AppendSorted(Value &&); // Append at the back, skipping a duplicate of the tail (must throw std::invalid_argument when smaller than the tail)
+
+    // Batched operations on a staged copy of the batch (the batch is sorted and consumed)
+    ulong MergeInsert(Vector<Data> &); // Link the batch in one forward walk, returns how many were new
+    ulong MergeRemove(Vector<Data> &); // Unlink the batch in one forward walk, returns how many were present
   };
 
   /* ************************************************************************** */
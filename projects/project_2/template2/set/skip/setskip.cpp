@@ -0,0 +1,848 @@
+namespace lasd
+{
+  /* ************************************************************************** */
+
+  // Specific constructors
+
+  template <typename Data>
+  SetSkip<Data>::SetSkip(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> staged(container); // Sorting an array beats a search per element
+    LinkStaged(staged);
+  }
+
+  template <typename Data>
+  SetSkip<Data>::SetSkip(MappableContainer<Data> &&container) noexcept
+  {
+    Vector<Data> staged(std::move(container)); // Elements are moved through the array into the nodes
+    LinkStaged(staged);
+  }
+
+  // Specific factories
+
+  template <typename Data>
+  SetSkip<Data> SetSkip<Data>::FromSorted(const TraversableContainer<Data> &container)
+  {
+    SetSkip<Data> set;
+    Path path{};
+    container.Traverse([&set, &path](const Data &data)
+                       { set.AppendSorted(path, data); }); // No staging: the input order is the set order
+    return set;
+  }
+
+  template <typename Data>
+  SetSkip<Data> SetSkip<Data>::FromSorted(MappableContainer<Data> &&container)
+  {
+    SetSkip<Data> set;
+    Path path{};
+    container.Map([&set, &path](Data &data)
+                  { set.AppendSorted(path, std::move(data)); });
+    return set;
+  }
+
+  // Copy constructor
+  template <typename Data>
+  SetSkip<Data>::SetSkip(const SetSkip<Data> &other)
+  {
+    Path path{};
+    for (const Node *current = other.head[0].next; current != nullptr; current = Links(current)[0].next)
+    {
+      AppendNode(path, current->element); // Other is already sorted: append in its order
+    }
+  }
+
+  // Move constructor
+  template <typename Data>
+  SetSkip<Data>::SetSkip(SetSkip<Data> &&other) noexcept
+  {
+    std::swap(head, other.head); // No node points back at the head: the towers move as they are
+    std::swap(tail, other.tail);
+    std::swap(height, other.height);
+    std::swap(size, other.size);
+  }
+
+  // Destructor
+  template <typename Data>
+  SetSkip<Data>::~SetSkip()
+  {
+    Clear();
+  }
+
+  // Copy assignment
+  template <typename Data>
+  SetSkip<Data> &SetSkip<Data>::operator=(const SetSkip<Data> &other)
+  {
+    if (this != &other)
+    {
+      SetSkip<Data> copy(other);
+      *this = std::move(copy); // The old nodes leave with copy
+    }
+    return *this;
+  }
+
+  // Move assignment
+  template <typename Data>
+  SetSkip<Data> &SetSkip<Data>::operator=(SetSkip<Data> &&other) noexcept
+  {
+    if (this != &other)
+    {
+      std::swap(head, other.head);
+      std::swap(tail, other.tail);
+      std::swap(height, other.height);
+      std::swap(size, other.size);
+    }
+    return *this;
+  }
+
+  // Comparison operators
+  template <typename Data>
+  bool SetSkip<Data>::operator==(const SetSkip<Data> &other) const noexcept
+  {
+    if (size != other.size)
+    {
+      return false; // Sets of different sizes cannot be equal
+    }
+
+    // Both are sorted: compare level 0 side by side
+    const Node *mine = head[0].next;
+    const Node *theirs = other.head[0].next;
+    while (mine != nullptr)
+    {
+      if (!(mine->element == theirs->element))
+      {
+        return false;
+      }
+      mine = Links(mine)[0].next;
+      theirs = Links(theirs)[0].next;
+    }
+    return true;
+  }
+
+  template <typename Data>
+  bool SetSkip<Data>::operator!=(const SetSkip<Data> &other) const noexcept
+  {
+    return !(*this == other); // Use equality operator for inverse check
+  }
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  template <typename Data>
+  const Data &SetSkip<Data>::Min() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    return head[0].next->element; // First node of level 0
+  }
+
+  template <typename Data>
+  Data SetSkip<Data>::MinNRemove()
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    return TakeNode(head[0].next);
+  }
+
+  template <typename Data>
+  void SetSkip<Data>::RemoveMin()
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    RemoveNode(head[0].next);
+  }
+
+  template <typename Data>
+  const Data &SetSkip<Data>::Max() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    return tail->element;
+  }
+
+  template <typename Data>
+  Data SetSkip<Data>::MaxNRemove()
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    return TakeNode(tail);
+  }
+
+  template <typename Data>
+  void SetSkip<Data>::RemoveMax()
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    RemoveNode(tail);
+  }
+
+  template <typename Data>
+  const Data &SetSkip<Data>::Predecessor(const Data &data) const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    Node *predNode = FindBefore(data, nullptr);
+    if (predNode == nullptr)
+    {
+      throw std::length_error("SetSkip: Predecessor not found");
+    }
+
+    return predNode->element;
+  }
+
+  template <typename Data>
+  Data SetSkip<Data>::PredecessorNRemove(const Data &data)
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    Node *predNode = FindBefore(data, nullptr);
+    if (predNode == nullptr)
+    {
+      throw std::length_error("SetSkip: Predecessor not found");
+    }
+
+    return TakeNode(predNode);
+  }
+
+  template <typename Data>
+  void SetSkip<Data>::RemovePredecessor(const Data &data)
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    Node *predNode = FindBefore(data, nullptr);
+    if (predNode == nullptr)
+    {
+      throw std::length_error("SetSkip: Predecessor not found");
+    }
+
+    RemoveNode(predNode);
+  }
+
+  template <typename Data>
+  const Data &SetSkip<Data>::Successor(const Data &data) const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    Node *succNode = LinksOf(FindAtMost(data))[0].next; // First node larger than data
+    if (succNode == nullptr)
+    {
+      throw std::length_error("SetSkip: Successor not found");
+    }
+
+    return succNode->element;
+  }
+
+  template <typename Data>
+  Data SetSkip<Data>::SuccessorNRemove(const Data &data)
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    Node *succNode = LinksOf(FindAtMost(data))[0].next;
+    if (succNode == nullptr)
+    {
+      throw std::length_error("SetSkip: Successor not found");
+    }
+
+    return TakeNode(succNode);
+  }
+
+  template <typename Data>
+  void SetSkip<Data>::RemoveSuccessor(const Data &data)
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    Node *succNode = LinksOf(FindAtMost(data))[0].next;
+    if (succNode == nullptr)
+    {
+      throw std::length_error("SetSkip: Successor not found");
+    }
+
+    RemoveNode(succNode);
+  }
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  template <typename Data>
+  bool SetSkip<Data>::Insert(const Data &data)
+  {
+    return InsertValue(data);
+  }
+
+  template <typename Data>
+  bool SetSkip<Data>::Insert(Data &&data)
+  {
+    return InsertValue(std::move(data));
+  }
+
+  template <typename Data>
+  bool SetSkip<Data>::Remove(const Data &data)
+  {
+    Path path;
+    Node *node = LinksOf(FindBefore(data, &path))[0].next;
+    if (node == nullptr || !(node->element == data))
+    {
+      return false; // Not in the set
+    }
+
+    Unlink(path, node);
+    DeleteNode(node);
+    return true;
+  }
+
+  template <typename Data>
+  bool SetSkip<Data>::InsertAll(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return InsertStaged(batch) == batch.Size();
+  }
+
+  template <typename Data>
+  bool SetSkip<Data>::InsertAll(MappableContainer<Data> &&container)
+  {
+    Vector<Data> batch(std::move(container));
+    return InsertStaged(batch) == batch.Size();
+  }
+
+  template <typename Data>
+  bool SetSkip<Data>::RemoveAll(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container); // Removing while walking the set itself would free the walked node
+    return RemoveStaged(batch) == batch.Size();
+  }
+
+  template <typename Data>
+  bool SetSkip<Data>::InsertSome(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return InsertStaged(batch) > 0;
+  }
+
+  template <typename Data>
+  bool SetSkip<Data>::InsertSome(MappableContainer<Data> &&container)
+  {
+    Vector<Data> batch(std::move(container));
+    return InsertStaged(batch) > 0;
+  }
+
+  template <typename Data>
+  bool SetSkip<Data>::RemoveSome(const TraversableContainer<Data> &container)
+  {
+    Vector<Data> batch(container);
+    return RemoveStaged(batch) > 0;
+  }
+
+  // Specific member functions (inherited from TestableContainer)
+
+  template <typename Data>
+  bool SetSkip<Data>::Exists(const Data &data) const noexcept
+  {
+    const Node *node = LinksOf(FindBefore(data, nullptr))[0].next; // First node not smaller than data
+    return node != nullptr && node->element == data;
+  }
+
+  // Specific member functions (inherited from LinearContainer)
+
+  template <typename Data>
+  const Data &SetSkip<Data>::operator[](const ulong index) const
+  {
+    if (index >= size)
+    {
+      throw std::out_of_range("SetSkip: Index out of range");
+    }
+
+    // Step right while the span does not overshoot the wanted rank
+    const ulong rank = index + 1;
+    const Node *current = nullptr;
+    ulong reached = 0;
+    for (ulong level = height; level-- > 0;)
+    {
+      const Link *links = LinksOf(current);
+      while (links[level].next != nullptr && reached + links[level].span <= rank)
+      {
+        reached += links[level].span;
+        current = links[level].next;
+        links = Links(current);
+      }
+    }
+    return current->element;
+  }
+
+  template <typename Data>
+  const Data &SetSkip<Data>::Front() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    return head[0].next->element;
+  }
+
+  template <typename Data>
+  const Data &SetSkip<Data>::Back() const
+  {
+    if (this->Empty())
+    {
+      throw std::length_error("SetSkip: Empty container");
+    }
+
+    return tail->element;
+  }
+
+  // Specific member function (inherited from TraversableContainer, PreOrderTraversableContainer, PostOrderTraversableContainer)
+
+  template <typename Data>
+  void SetSkip<Data>::Traverse(TraverseFun fun) const
+  {
+    PreOrderTraverse(fun); // Ascending order, as every set
+  }
+
+  template <typename Data>
+  bool SetSkip<Data>::TraverseWhile(TraverseWhileFun fun) const
+  {
+    for (const Node *current = head[0].next; current != nullptr; current = Links(current)[0].next)
+    {
+      if (!fun(current->element))
+      {
+        return false; // Stop at the first node the function rejects
+      }
+    }
+    return true;
+  }
+
+  template <typename Data>
+  void SetSkip<Data>::PreOrderTraverse(TraverseFun fun) const
+  {
+    for (const Node *current = head[0].next; current != nullptr; current = Links(current)[0].next)
+    {
+      fun(current->element);
+    }
+  }
+
+  template <typename Data>
+  void SetSkip<Data>::PostOrderTraverse(TraverseFun fun) const
+  {
+    for (const Node *current = tail; current != nullptr; current = current->prev)
+    {
+      fun(current->element);
+    }
+  }
+
+  // Template fast paths
+
+  template <typename Data>
+  template <typename Fun>
+  void SetSkip<Data>::ForEach(Fun &&fun) const
+  {
+    for (const Node *current = head[0].next; current != nullptr; current = Links(current)[0].next)
+    {
+      fun(current->element);
+    }
+  }
+
+  template <typename Data>
+  template <typename Accumulator, typename Fun>
+  Accumulator SetSkip<Data>::Reduce(Fun &&fun, Accumulator accumulator) const
+  {
+    for (const Node *current = head[0].next; current != nullptr; current = Links(current)[0].next)
+    {
+      accumulator = fun(current->element, accumulator);
+    }
+    return accumulator;
+  }
+
+  // Specific member functions (read-only bidirectional iterators)
+
+  template <typename Data>
+  typename SetSkip<Data>::ConstIterator SetSkip<Data>::begin() const noexcept
+  {
+    return ConstIterator(head[0].next, this);
+  }
+
+  template <typename Data>
+  typename SetSkip<Data>::ConstIterator SetSkip<Data>::end() const noexcept
+  {
+    return ConstIterator(nullptr, this);
+  }
+
+  template <typename Data>
+  typename SetSkip<Data>::ConstIterator SetSkip<Data>::cbegin() const noexcept
+  {
+    return begin();
+  }
+
+  template <typename Data>
+  typename SetSkip<Data>::ConstIterator SetSkip<Data>::cend() const noexcept
+  {
+    return end();
+  }
+
+  // Specific member function (inherited from ClearableContainer)
+
+  template <typename Data>
+  void SetSkip<Data>::Clear()
+  {
+    Node *current = head[0].next;
+    while (current != nullptr)
+    {
+      Node *next = Links(current)[0].next;
+      DeleteNode(current);
+      current = next;
+    }
+
+    for (ulong level = 0; level < height; level++)
+    {
+      head[level] = Link(); // Levels above height were reset when they emptied
+    }
+    tail = nullptr;
+    height = 1;
+    size = 0;
+  }
+
+  /* ************************************************************************** */
+
+  // Node storage
+
+  template <typename Data>
+  typename SetSkip<Data>::Link *SetSkip<Data>::Links(Node *node) noexcept
+  {
+    return std::launder(reinterpret_cast<Link *>(reinterpret_cast<char *>(node) + LinksOffset));
+  }
+
+  template <typename Data>
+  const typename SetSkip<Data>::Link *SetSkip<Data>::Links(const Node *node) noexcept
+  {
+    return std::launder(reinterpret_cast<const Link *>(reinterpret_cast<const char *>(node) + LinksOffset));
+  }
+
+  template <typename Data>
+  typename SetSkip<Data>::Link *SetSkip<Data>::LinksOf(Node *node) noexcept
+  {
+    return (node == nullptr) ? head : Links(node);
+  }
+
+  template <typename Data>
+  const typename SetSkip<Data>::Link *SetSkip<Data>::LinksOf(const Node *node) const noexcept
+  {
+    return (node == nullptr) ? head : Links(node);
+  }
+
+  template <typename Data>
+  template <typename Value>
+  typename SetSkip<Data>::Node *SetSkip<Data>::NewNode(ulong levels, Value &&value)
+  {
+    // One block per node: the tower follows the node instead of living in a second allocation
+    void *block = ::operator new(LinksOffset + levels * sizeof(Link), std::align_val_t(alignof(Node)));
+    Node *node;
+    try
+    {
+      node = new (block) Node(levels, std::forward<Value>(value));
+    }
+    catch (...)
+    {
+      ::operator delete(block, std::align_val_t(alignof(Node)));
+      throw;
+    }
+
+    Link *links = reinterpret_cast<Link *>(static_cast<char *>(block) + LinksOffset);
+    for (ulong level = 0; level < levels; level++)
+    {
+      new (links + level) Link();
+    }
+    return node;
+  }
+
+  template <typename Data>
+  void SetSkip<Data>::DeleteNode(Node *node) noexcept
+  {
+    node->~Node(); // Links are trivially destructible
+    ::operator delete(static_cast<void *>(node), std::align_val_t(alignof(Node)));
+  }
+
+  template <typename Data>
+  ulong SetSkip<Data>::RandomHeight() noexcept
+  {
+    // xorshift64*, then two bits per level: each extra level with probability 1/4
+    seed ^= seed >> 12;
+    seed ^= seed << 25;
+    seed ^= seed >> 27;
+    ulong bits = seed * 2685821657736338717UL;
+
+    ulong levels = 1;
+    while (levels < MaxHeight && (bits & 3) == 0)
+    {
+      levels++;
+      bits >>= 2;
+    }
+    return levels;
+  }
+
+  // Searches
+
+  template <typename Data>
+  typename SetSkip<Data>::Node *SetSkip<Data>::FindBefore(const Data &data, Path *path) const noexcept
+  {
+    Node *current = nullptr;
+    ulong rank = 0;
+    for (ulong level = height; level-- > 0;)
+    {
+      const Link *links = LinksOf(current);
+      while (links[level].next != nullptr && links[level].next->element < data)
+      {
+        rank += links[level].span;
+        current = links[level].next;
+        links = Links(current);
+      }
+
+      if (path != nullptr)
+      {
+        path->last[level] = current;
+        path->rank[level] = rank;
+      }
+    }
+    return current;
+  }
+
+  template <typename Data>
+  typename SetSkip<Data>::Node *SetSkip<Data>::FindAtMost(const Data &data) const noexcept
+  {
+    Node *current = nullptr;
+    for (ulong level = height; level-- > 0;)
+    {
+      const Link *links = LinksOf(current);
+      while (links[level].next != nullptr && !(data < links[level].next->element))
+      {
+        current = links[level].next;
+        links = Links(current);
+      }
+    }
+    return current;
+  }
+
+  // Linking
+
+  template <typename Data>
+  void SetSkip<Data>::LinkAfter(Path &path, Node *node) noexcept
+  {
+    const ulong levels = node->height;
+    for (; height < levels; height++)
+    {
+      path.last[height] = nullptr; // New levels start from the head
+      path.rank[height] = 0;
+    }
+
+    const ulong rank = path.rank[0] + 1; // Rank of the new node
+    Link *links = Links(node);
+    for (ulong level = 0; level < levels; level++)
+    {
+      Link &before = LinksOf(path.last[level])[level];
+      links[level].next = before.next;
+      if (before.next != nullptr)
+      {
+        links[level].span = before.span - (rank - 1 - path.rank[level]);
+      }
+      before.next = node;
+      before.span = rank - path.rank[level];
+    }
+
+    for (ulong level = levels; level < height; level++)
+    {
+      Link &before = LinksOf(path.last[level])[level];
+      if (before.next != nullptr)
+      {
+        before.span++; // Jumps over the new node
+      }
+    }
+
+    node->prev = path.last[0];
+    if (links[0].next != nullptr)
+    {
+      links[0].next->prev = node;
+    }
+    else
+    {
+      tail = node;
+    }
+    size++;
+  }
+
+  template <typename Data>
+  void SetSkip<Data>::Unlink(Path &path, Node *node) noexcept
+  {
+    Link *links = Links(node);
+    for (ulong level = 0; level < height; level++)
+    {
+      Link &before = LinksOf(path.last[level])[level];
+      if (before.next == node)
+      {
+        if (links[level].next != nullptr)
+        {
+          before.span += links[level].span - 1;
+        }
+        before.next = links[level].next;
+      }
+      else if (before.next != nullptr)
+      {
+        before.span--; // Jumped over the removed node
+      }
+    }
+
+    if (links[0].next != nullptr)
+    {
+      links[0].next->prev = node->prev;
+    }
+    else
+    {
+      tail = node->prev;
+    }
+
+    while (height > 1 && head[height - 1].next == nullptr)
+    {
+      head[--height] = Link(); // Drop emptied top levels
+    }
+    size--;
+  }
+
+  template <typename Data>
+  void SetSkip<Data>::RemoveNode(Node *node) noexcept
+  {
+    Path path;
+    FindBefore(node->element, &path); // The path to a node is the path to its element
+    Unlink(path, node);
+    DeleteNode(node);
+  }
+
+  template <typename Data>
+  Data SetSkip<Data>::TakeNode(Node *node)
+  {
+    Path path;
+    FindBefore(node->element, &path);
+    Unlink(path, node);
+    Data data(std::move(node->element));
+    DeleteNode(node);
+    return data;
+  }
+
+  template <typename Data>
+  template <typename Value>
+  bool SetSkip<Data>::InsertValue(Value &&value)
+  {
+    Path path;
+    const Node *next = LinksOf(FindBefore(value, &path))[0].next;
+    if (next != nullptr && next->element == value)
+    {
+      return false; // Element already exists
+    }
+
+    LinkAfter(path, NewNode(RandomHeight(), std::forward<Value>(value)));
+    return true;
+  }
+
+  // Bulk loading
+
+  template <typename Data>
+  template <typename Value>
+  void SetSkip<Data>::AppendNode(Path &path, Value &&value)
+  {
+    Node *node = NewNode(RandomHeight(), std::forward<Value>(value));
+    LinkAfter(path, node);
+
+    // The new node closes the path on every level it reaches: O(1) per append
+    for (ulong level = 0; level < node->height; level++)
+    {
+      path.last[level] = node;
+      path.rank[level] = size;
+    }
+  }
+
+  template <typename Data>
+  template <typename Value>
+  void SetSkip<Data>::AppendSorted(Path &path, Value &&value)
+  {
+    if (tail != nullptr)
+    {
+      if (value < tail->element)
+      {
+        throw std::invalid_argument("SetSkip: Input not sorted");
+      }
+      if (value == tail->element)
+      {
+        return; // Duplicate of the current maximum
+      }
+    }
+
+    AppendNode(path, std::forward<Value>(value));
+  }
+
+  template <typename Data>
+  void SetSkip<Data>::LinkStaged(Vector<Data> &staged)
+  {
+    PdqSort(staged.begin(), staged.end());
+    Data *last = Unique(staged.begin(), staged.end()); // Duplicates are adjacent once sorted
+
+    Path path{};
+    for (Data *current = staged.begin(); current != last; ++current)
+    {
+      AppendNode(path, std::move(*current));
+    }
+  }
+
+  template <typename Data>
+  ulong SetSkip<Data>::InsertStaged(Vector<Data> &batch)
+  {
+    ulong added = 0;
+    for (Data *current = batch.begin(); current != batch.end(); ++current)
+    {
+      added += InsertValue(std::move(*current)); // Moved only when linked
+    }
+    return added;
+  }
+
+  template <typename Data>
+  ulong SetSkip<Data>::RemoveStaged(Vector<Data> &batch)
+  {
+    ulong removed = 0;
+    for (const Data *current = batch.begin(); current != batch.end(); ++current)
+    {
+      removed += Remove(*current);
+    }
+    return removed;
+  }
+
+  /* ************************************************************************** */
+
+}
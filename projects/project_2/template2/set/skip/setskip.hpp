@@ -0,0 +1,338 @@
+#ifndef SETSKIP_HPP
+#define SETSKIP_HPP
+
+/* ************************************************************************** */
+
+#include <iterator>
+#include <new>
+
+#include "../set.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  template <typename Data>
+  class SetSkip : virtual public Set<Data>
+  {
+    // Must extend Set<Data>
+
+    // Indexable skip list: every node carries a tower of forward links, each
+    // with the number of level-0 steps it jumps (its span), so searches and
+    // positional access both run in expected O(log n). Level 0 is also linked
+    // backwards for Max, Back and PostOrderTraverse.
+
+  private:
+    // ...
+
+  protected:
+    using Container::size;
+
+    static constexpr ulong MaxHeight = 32; // One level in four is promoted: enough for 4^32 elements
+
+    struct Node;
+
+    struct Link
+    {
+      Node *next = nullptr; // Following node at this level (nullptr past the last)
+      ulong span = 0;       // Level-0 steps to next (meaningful only when next is not nullptr)
+    };
+
+    struct Node
+    {
+      Data element;
+      Node *prev = nullptr; // Previous node at level 0 (nullptr for the first)
+      ulong height;         // Links stored right after the node
+
+      // Specific constructor
+      template <typename Value>
+      Node(ulong levels, Value &&value) : element(std::forward<Value>(value)), height(levels) {}
+    };
+
+    // Last node before the searched position at every level (nullptr for the head)
+    // and its rank, counted from 1 (0 for the head)
+    struct Path
+    {
+      Node *last[MaxHeight];
+      ulong rank[MaxHeight];
+    };
+
+    Link head[MaxHeight];  // Links out of the head, one per level
+    Node *tail = nullptr;  // Largest element, for Max, Back and backward walks
+    ulong height = 1;      // Levels in use
+    ulong seed = 88172645; // Tower heights come from a per-set xorshift generator
+
+    class TowerIterator;
+
+  public:
+    // Default constructor
+    SetSkip() = default;
+
+    /* ************************************************************************ */
+
+    // Specific constructors (staged in one array, sorted and deduplicated there,
+    // then linked in one pass at the back: O(n log n))
+    SetSkip(const TraversableContainer<Data> &);  // A set obtained from a TraversableContainer
+    SetSkip(MappableContainer<Data> &&) noexcept; // A set obtained from a MappableContainer
+
+    /* ************************************************************************ */
+
+    // Specific factories (input in ascending order, duplicates allowed: O(n), linked
+    // as it is traversed; must throw std::invalid_argument when the input is not sorted)
+    static SetSkip FromSorted(const TraversableContainer<Data> &); // A set copied from sorted input
+    static SetSkip FromSorted(MappableContainer<Data> &&);         // A set moved from sorted input
+
+    /* ************************************************************************ */
+
+    // Copy constructor
+    SetSkip(const SetSkip &);
+
+    // Move constructor
+    SetSkip(SetSkip &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Destructor
+    virtual ~SetSkip();
+
+    /* ************************************************************************ */
+
+    // Copy assignment
+    SetSkip &operator=(const SetSkip &);
+
+    // Move assignment
+    SetSkip &operator=(SetSkip &&) noexcept;
+
+    /* ************************************************************************ */
+
+    // Comparison operators
+    bool operator==(const SetSkip &) const noexcept;
+    bool operator!=(const SetSkip &) const noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from OrderedDictionaryContainer)
+
+    const Data &Min() const override; // Return the smallest element in the set, O(1)
+    Data MinNRemove() override;       // Remove and return the smallest element
+    void RemoveMin() override;        // Remove the smallest element
+
+    const Data &Max() const override; // Return the largest element in the set, O(1)
+    Data MaxNRemove() override;       // Remove and return the largest element
+    void RemoveMax() override;        // Remove the largest element
+
+    const Data &Predecessor(const Data &) const override; // Find the largest element smaller than the given value
+    Data PredecessorNRemove(const Data &) override;       // Remove and return the predecessor
+    void RemovePredecessor(const Data &) override;        // Remove the predecessor
+
+    const Data &Successor(const Data &) const override; // Find the smallest element larger than the given value
+    Data SuccessorNRemove(const Data &) override;       // Remove and return the successor
+    void RemoveSuccessor(const Data &) override;        // Remove the successor
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from DictionaryContainer)
+
+    bool Insert(const Data &) override; // Add an element if not already present (copy)
+    bool Insert(Data &&) override;      // Add an element if not already present (move)
+    bool Remove(const Data &) override; // Remove an element if present
+
+    // Batched operations: the batch is staged first, so it may be the set itself
+
+    bool InsertAll(const TraversableContainer<Data> &) override; // True if every element was inserted (copy)
+    bool InsertAll(MappableContainer<Data> &&) override;         // True if every element was inserted (move)
+    bool RemoveAll(const TraversableContainer<Data> &) override; // True if every element was removed
+
+    bool InsertSome(const TraversableContainer<Data> &) override; // True if some element was inserted (copy)
+    bool InsertSome(MappableContainer<Data> &&) override;         // True if some element was inserted (move)
+    bool RemoveSome(const TraversableContainer<Data> &) override; // True if some element was removed
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from TestableContainer)
+
+    bool Exists(const Data &) const noexcept override; // Check if an element exists in the set
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from LinearContainer)
+
+    const Data &operator[](const ulong) const override; // Access by rank through the spans (must throw std::out_of_range when out of range)
+    const Data &Front() const override;                 // Smallest element (must throw std::length_error when empty)
+    const Data &Back() const override;                  // Largest element (must throw std::length_error when empty)
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from TraversableContainer)
+
+    using typename TraversableContainer<Data>::TraverseFun;
+
+    void Traverse(TraverseFun) const override; // Apply function to all elements in ascending order
+
+    using typename TraversableContainer<Data>::TraverseWhileFun;
+
+    bool TraverseWhile(TraverseWhileFun) const override; // Walk level 0 until the function returns false
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from PreOrderTraversableContainer)
+
+    void PreOrderTraverse(TraverseFun) const override; // Apply function to all elements in ascending order
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from PostOrderTraversableContainer)
+
+    void PostOrderTraverse(TraverseFun) const override; // Apply function to all elements in descending order
+
+    /* ************************************************************************ */
+
+    // Specific member functions (template fast paths, hiding the type-erased ones)
+
+    template <typename Fun>
+    void ForEach(Fun &&) const; // Apply callable to each element, ascending order
+
+    template <typename Accumulator, typename Fun>
+    Accumulator Reduce(Fun &&, Accumulator) const; // Fold with any callable, ascending order
+
+    /* ************************************************************************ */
+
+    // Specific member functions (read-only bidirectional iterators, ascending order)
+
+    using ConstIterator = TowerIterator;
+
+    ConstIterator begin() const noexcept; // Smallest element
+    ConstIterator end() const noexcept;   // Past the largest element
+
+    ConstIterator cbegin() const noexcept;
+    ConstIterator cend() const noexcept;
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from ClearableContainer)
+
+    void Clear() override; // Remove all elements from the set
+
+  protected:
+    // Node storage: the links live in the same block, right after the node
+
+    static constexpr ulong LinksOffset = (sizeof(Node) + alignof(Link) - 1) / alignof(Link) * alignof(Link);
+
+    static Link *Links(Node *) noexcept;
+    static const Link *Links(const Node *) noexcept;
+
+    Link *LinksOf(Node *) noexcept;                   // Links of a node, or of the head for nullptr
+    const Link *LinksOf(const Node *) const noexcept; // Links of a node, or of the head for nullptr
+
+    template <typename Value>
+    static Node *NewNode(ulong, Value &&); // Node with a tower of the given height
+    static void DeleteNode(Node *) noexcept;
+
+    ulong RandomHeight() noexcept; // 1 with probability 3/4, 2 with 3/16, ...
+
+    // Searches from the top level down
+
+    Node *FindBefore(const Data &, Path *) const noexcept; // Last node smaller than the value (nullptr for none), recording the path when given
+    Node *FindAtMost(const Data &) const noexcept;         // Last node not larger than the value (nullptr for none)
+
+    // Linking
+
+    void LinkAfter(Path &, Node *) noexcept; // Link a node right after the path, fixing the spans it crosses
+    void Unlink(Path &, Node *) noexcept;    // Unlink the node right after the path, fixing the spans it crossed
+
+    void RemoveNode(Node *) noexcept; // Unlink and free a node already in the set
+    Data TakeNode(Node *);            // Unlink a node, returning its element
+
+    template <typename Value>
+    bool InsertValue(Value &&); // Link a new node unless the value is present
+
+    // Bulk loading (the path starts zeroed on an empty set and follows the tail)
+
+    template <typename Value>
+    void AppendNode(Path &, Value &&); // Append at the back, known to be larger than the tail
+
+    template <typename Value>
+    void AppendSorted(Path &, Value &&); // Append at the back, skipping a duplicate of the tail (must throw std::invalid_argument when smaller than the tail)
+
+    void LinkStaged(Vector<Data> &); // Sort and deduplicate the staged elements, then append them in order
+
+    // Batched operations on a staged copy of the batch
+    ulong InsertStaged(Vector<Data> &); // Returns how many were new
+    ulong RemoveStaged(Vector<Data> &); // Returns how many were present
+
+    /* ************************************************************************ */
+
+    class TowerIterator
+    {
+      // Bidirectional iterator over level 0: end() is the null node,
+      // from which a decrement steps back onto the tail of the owning set
+
+      friend class SetSkip;
+
+    public:
+      using iterator_concept = std::bidirectional_iterator_tag;
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type = Data;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const Data *;
+      using reference = const Data &;
+
+      /* ********************************************************************** */
+
+      // Default constructor
+      TowerIterator() = default;
+
+      /* ********************************************************************** */
+
+      // Specific member functions
+
+      reference operator*() const noexcept { return current->element; }
+      pointer operator->() const noexcept { return &current->element; }
+
+      TowerIterator &operator++() noexcept
+      {
+        current = Links(current)[0].next;
+        return *this;
+      }
+
+      TowerIterator operator++(int) noexcept
+      {
+        TowerIterator previous = *this;
+        ++*this;
+        return previous;
+      }
+
+      TowerIterator &operator--() noexcept
+      {
+        current = (current == nullptr) ? owner->tail : current->prev;
+        return *this;
+      }
+
+      TowerIterator operator--(int) noexcept
+      {
+        TowerIterator previous = *this;
+        --*this;
+        return previous;
+      }
+
+      bool operator==(const TowerIterator &other) const noexcept { return current == other.current; }
+
+    private:
+      TowerIterator(const Node *node, const SetSkip *set) noexcept : current(node), owner(set) {}
+
+      const Node *current = nullptr;  // Node under the iterator (nullptr past the end)
+      const SetSkip *owner = nullptr; // Set walked, to step back from the end
+    };
+  };
+
+  /* ************************************************************************** */
+
+}
+
+#include "setskip.cpp" // Include implementation file
+
+#endif
@@ -5,53 +5,75 @@ namespace lasd
 
     // Specific constructors
 
-    template <typename Data>
-    SetVec<Data>::SetVec(const TraversableContainer<Data> &container)
+    template <typename Data, typename Compare>
+    SetVec<Data, Compare>::SetVec(const Compare &order) : compare(order) {}
+
+    template <typename Data, typename Compare>
+    SetVec<Data, Compare>::SetVec(const TraversableContainer<Data> &container, const Compare &order) : Vector<Data>(container), compare(order)
     {
-        // Insert all elements from the container
-        container.Traverse([this](const Data &data)
-                           {
-                               Insert(data); // Using Insert ensures no duplicates are added
-                           });
+        SortUnique(false); // One allocation for the copy, then sort and deduplicate in place
     }
 
-    template <typename Data>
-    SetVec<Data>::SetVec(MappableContainer<Data> &&container) noexcept
+    template <typename Data, typename Compare>
+    SetVec<Data, Compare>::SetVec(MappableContainer<Data> &&container, const Compare &order) : Vector<Data>(std::move(container)), compare(order)
+    {
+        SortUnique(false); // Elements are moved in once, then sorted and deduplicated in place
+    }
+
+    // Specific factories
+
+    template <typename Data, typename Compare>
+    SetVec<Data, Compare> SetVec<Data, Compare>::FromSorted(const TraversableContainer<Data> &container, const Compare &order)
     {
-        // Move all elements from the container
-        container.Map([this](Data &data)
-                      {
-                          Insert(std::move(data)); // Move elements to avoid unnecessary copies
-                      });
+        SetVec<Data, Compare> set(order);
+        static_cast<Vector<Data> &>(set) = Vector<Data>(container); // Bulk copy, bypassing the sorting constructor
+        set.SortUnique(true);
+        return set;
+    }
+
+    template <typename Data, typename Compare>
+    SetVec<Data, Compare> SetVec<Data, Compare>::FromSorted(MappableContainer<Data> &&container, const Compare &order)
+    {
+        SetVec<Data, Compare> set(order);
+        static_cast<Vector<Data> &>(set) = Vector<Data>(std::move(container));
+        set.SortUnique(true);
+        return set;
     }
 
     // Copy constructor
-    template <typename Data>
-    SetVec<Data>::SetVec(const SetVec<Data> &other) : Vector<Data>(other) {} // Leverage Vector's copy constructor
+    template <typename Data, typename Compare>
+    SetVec<Data, Compare>::SetVec(const SetVec<Data, Compare> &other) : Vector<Data>(other), compare(other.compare), layout(other.layout) {} // Leverage Vector's copy constructor (the shadow is rebuilt when needed)
 
     // Move constructor
-    template <typename Data>
-    SetVec<Data>::SetVec(SetVec<Data> &&other) noexcept : Vector<Data>(std::move(other)) {} // Leverage Vector's move constructor
+    template <typename Data, typename Compare>
+    SetVec<Data, Compare>::SetVec(SetVec<Data, Compare> &&other) noexcept : Vector<Data>(std::move(other)), compare(other.compare), layout(other.layout) {} // Leverage Vector's move constructor
 
     // Copy assignment
-    template <typename Data>
-    SetVec<Data> &SetVec<Data>::operator=(const SetVec<Data> &other)
+    template <typename Data, typename Compare>
+    SetVec<Data, Compare> &SetVec<Data, Compare>::operator=(const SetVec<Data, Compare> &other)
     {
         Vector<Data>::operator=(other); // Delegate to Vector's copy assignment
+        compare = other.compare;
+        layout = other.layout;
+        indexed = false;
         return *this;
     }
 
     // Move assignment
-    template <typename Data>
-    SetVec<Data> &SetVec<Data>::operator=(SetVec<Data> &&other) noexcept
+    template <typename Data, typename Compare>
+    SetVec<Data, Compare> &SetVec<Data, Compare>::operator=(SetVec<Data, Compare> &&other) noexcept
     {
         Vector<Data>::operator=(std::move(other)); // Delegate to Vector's move assignment
+        compare = other.compare; // Copied: the other set stays usable
+        layout = other.layout;
+        indexed = false;
+        other.indexed = false; // Other now holds the previous elements
         return *this;
     }
 
     // Comparison operators
-    template <typename Data>
-    bool SetVec<Data>::operator==(const SetVec<Data> &other) const noexcept
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::operator==(const SetVec<Data, Compare> &other) const noexcept
     {
         if (size != other.size)
         {
@@ -70,16 +92,16 @@ namespace lasd
         return true; // All elements match
     }
 
-    template <typename Data>
-    bool SetVec<Data>::operator!=(const SetVec<Data> &other) const noexcept
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::operator!=(const SetVec<Data, Compare> &other) const noexcept
     {
         return !(*this == other); // Use equality operator for inverse check
     }
 
     // Specific member functions (inherited from OrderedDictionaryContainer)
 
-    template <typename Data>
-    const Data &SetVec<Data>::Min() const
+    template <typename Data, typename Compare>
+    const Data &SetVec<Data, Compare>::Min() const
     {
         if (this->Empty())
         {
@@ -88,8 +110,8 @@ namespace lasd
         return Front(); // In a sorted set, front element is the minimum
     }
 
-    template <typename Data>
-    Data SetVec<Data>::MinNRemove()
+    template <typename Data, typename Compare>
+    Data SetVec<Data, Compare>::MinNRemove()
     {
         if (this->Empty())
         {
@@ -100,8 +122,8 @@ namespace lasd
         return min;         // Return saved value
     }
 
-    template <typename Data>
-    void SetVec<Data>::RemoveMin()
+    template <typename Data, typename Compare>
+    void SetVec<Data, Compare>::RemoveMin()
     {
         if (this->Empty())
         {
@@ -110,8 +132,8 @@ namespace lasd
         ShiftLeft(0); // Remove first element by shifting all elements left
     }
 
-    template <typename Data>
-    const Data &SetVec<Data>::Max() const
+    template <typename Data, typename Compare>
+    const Data &SetVec<Data, Compare>::Max() const
     {
         if (this->Empty())
         {
@@ -120,8 +142,8 @@ namespace lasd
         return Back(); // In a sorted set, back element is the maximum
     }
 
-    template <typename Data>
-    Data SetVec<Data>::MaxNRemove()
+    template <typename Data, typename Compare>
+    Data SetVec<Data, Compare>::MaxNRemove()
     {
         if (this->Empty())
         {
@@ -132,24 +154,37 @@ namespace lasd
         return max;        // Return saved value
     }
 
-    template <typename Data>
-    void SetVec<Data>::RemoveMax()
+    template <typename Data, typename Compare>
+    void SetVec<Data, Compare>::RemoveMax()
     {
         if (this->Empty())
         {
             throw std::length_error("SetVec: Empty container");
         }
         Vector<Data>::Resize(size - 1); // Last element can be removed by simply resizing
+        indexed = false;
     }
 
-    template <typename Data>
-    const Data &SetVec<Data>::Predecessor(const Data &data) const
+    template <typename Data, typename Compare>
+    const Data &SetVec<Data, Compare>::Predecessor(const Data &data) const
     {
         if (this->Empty())
         {
             throw std::length_error("SetVec: Empty container");
         }
 
+        if (layout == SearchLayout::Eytzinger && IndexReady())
+        {
+            // The predecessor is the last node where the walk turned right
+            ulong node = Descend<false>(data);
+            node >>= std::countr_zero(node) + 1;
+            if (node == 0)
+            {
+                throw std::length_error("SetVec: Predecessor not found");
+            }
+            return shadow[shadowBase + node];
+        }
+
         long pos = FindPredecessorPos(data); // Find position of predecessor
         if (pos < 0)
         {
@@ -159,8 +194,8 @@ namespace lasd
         return elements[pos]; // Return predecessor element
     }
 
-    template <typename Data>
-    Data SetVec<Data>::PredecessorNRemove(const Data &data)
+    template <typename Data, typename Compare>
+    Data SetVec<Data, Compare>::PredecessorNRemove(const Data &data)
     {
         if (this->Empty())
         {
@@ -178,8 +213,8 @@ namespace lasd
         return pred;               // Return saved value
     }
 
-    template <typename Data>
-    void SetVec<Data>::RemovePredecessor(const Data &data)
+    template <typename Data, typename Compare>
+    void SetVec<Data, Compare>::RemovePredecessor(const Data &data)
     {
         if (this->Empty())
         {
@@ -195,14 +230,26 @@ namespace lasd
         ShiftLeft(pos); // Remove predecessor by shifting elements
     }
 
-    template <typename Data>
-    const Data &SetVec<Data>::Successor(const Data &data) const
+    template <typename Data, typename Compare>
+    const Data &SetVec<Data, Compare>::Successor(const Data &data) const
     {
         if (this->Empty())
         {
             throw std::length_error("SetVec: Empty container");
         }
 
+        if (layout == SearchLayout::Eytzinger && IndexReady())
+        {
+            // The successor is the last node where the walk turned left
+            ulong node = Descend<true>(data);
+            node >>= std::countr_one(node) + 1;
+            if (node == 0)
+            {
+                throw std::length_error("SetVec: Successor not found");
+            }
+            return shadow[shadowBase + node];
+        }
+
         long pos = FindSuccessorPos(data); // Find position of successor
         if (pos < 0 || static_cast<ulong>(pos) >= size)
         {
@@ -212,8 +259,8 @@ namespace lasd
         return elements[pos]; // Return successor element
     }
 
-    template <typename Data>
-    Data SetVec<Data>::SuccessorNRemove(const Data &data)
+    template <typename Data, typename Compare>
+    Data SetVec<Data, Compare>::SuccessorNRemove(const Data &data)
     {
         if (this->Empty())
         {
@@ -231,8 +278,8 @@ namespace lasd
         return succ;               // Return saved value
     }
 
-    template <typename Data>
-    void SetVec<Data>::RemoveSuccessor(const Data &data)
+    template <typename Data, typename Compare>
+    void SetVec<Data, Compare>::RemoveSuccessor(const Data &data)
     {
         if (this->Empty())
         {
@@ -250,27 +297,27 @@ namespace lasd
 
     // Specific member functions (inherited from DictionaryContainer)
 
-    template <typename Data>
-    bool SetVec<Data>::Insert(const Data &data)
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::Insert(const Data &data)
     {
         // Binary search to find position or check existence
         ulong pos = BinarySearch(data);
 
         // If the element is found, return false (no duplicate allowed)
-        if (static_cast<ulong>(pos) < size && elements[pos] == data)
+        if (Holds(pos, data))
         {
             return false; // Element already exists
         }
 
         // Insert the element at the correct position
-        if (this->Empty())
+        indexed = false;
+        if (pos == size)
         {
-            Vector<Data>::Resize(1); // Resize to accommodate first element
-            elements[0] = data;      // Insert element
+            Vector<Data>::PushBack(data); // Largest element so far: append (amortized constant time)
         }
         else
         {
-            Vector<Data>::Resize(size + 1); // Resize to accommodate new element
+            Vector<Data>::PushBack(std::move(elements[size - 1])); // Current maximum moves into the new slot
             // Shift elements to make space for the new element
             ShiftRight(pos);
             elements[pos] = data; // Insert element at correct position
@@ -278,27 +325,27 @@ namespace lasd
         return true; // Element successfully inserted
     }
 
-    template <typename Data>
-    bool SetVec<Data>::Insert(Data &&data)
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::Insert(Data &&data)
     {
         // Binary search to find position or check existence
         ulong pos = BinarySearch(data);
 
         // If the element is found, return false (no duplicate allowed)
-        if (static_cast<ulong>(pos) < size && elements[pos] == data)
+        if (Holds(pos, data))
         {
             return false; // Element already exists
         }
 
         // Insert the element at the correct position
-        if (this->Empty())
+        indexed = false;
+        if (pos == size)
         {
-            Vector<Data>::Resize(1);       // Resize to accommodate first element
-            elements[0] = std::move(data); // Move element into place
+            Vector<Data>::PushBack(std::move(data)); // Largest element so far: append (amortized constant time)
         }
         else
         {
-            Vector<Data>::Resize(size + 1); // Resize to accommodate new element
+            Vector<Data>::PushBack(std::move(elements[size - 1])); // Current maximum moves into the new slot
             // Shift elements to make space for the new element
             ShiftRight(pos);
             elements[pos] = std::move(data); // Move element into correct position
@@ -306,14 +353,14 @@ namespace lasd
         return true; // Element successfully inserted
     }
 
-    template <typename Data>
-    bool SetVec<Data>::Remove(const Data &data)
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::Remove(const Data &data)
     {
         // Binary search to find the element
         ulong pos = BinarySearch(data);
 
         // If the element is not found, return false
-        if (static_cast<ulong>(pos) >= size || elements[pos] != data)
+        if (!Holds(pos, data))
         {
             return false; // Element not found
         }
@@ -323,65 +370,154 @@ namespace lasd
         return true; // Element successfully removed
     }
 
+    // Batched operations (inherited from DictionaryContainer)
+
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::InsertAll(const TraversableContainer<Data> &container)
+    {
+        Vector<Data> batch(container); // Staged first: container may be this set
+        return MergeInsert(batch) == container.Size(); // Duplicates in the batch count as failed inserts
+    }
+
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::InsertAll(MappableContainer<Data> &&container)
+    {
+        ulong requested = container.Size();
+        Vector<Data> batch(std::move(container));
+        return MergeInsert(batch) == requested;
+    }
+
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::RemoveAll(const TraversableContainer<Data> &container)
+    {
+        ulong requested = container.Size();
+        Vector<Data> batch(container);
+        return MergeRemove(batch) == requested;
+    }
+
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::InsertSome(const TraversableContainer<Data> &container)
+    {
+        Vector<Data> batch(container);
+        return MergeInsert(batch) > 0;
+    }
+
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::InsertSome(MappableContainer<Data> &&container)
+    {
+        Vector<Data> batch(std::move(container));
+        return MergeInsert(batch) > 0;
+    }
+
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::RemoveSome(const TraversableContainer<Data> &container)
+    {
+        Vector<Data> batch(container);
+        return MergeRemove(batch) > 0;
+    }
+
     // Specific member function (inherited from TestableContainer)
 
-    template <typename Data>
-    bool SetVec<Data>::Exists(const Data &data) const noexcept
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::Exists(const Data &data) const noexcept
     {
         if (this->Empty())
         {
             return false; // Empty set contains no elements
         }
 
+        if (layout == SearchLayout::Eytzinger && IndexReady())
+        {
+            // The first node not below the value is the last where the walk turned left
+            ulong node = Descend<false>(data);
+            node >>= std::countr_one(node) + 1;
+            return node != 0 && !compare(data, shadow[shadowBase + node]);
+        }
+
         // Binary search to check if the element exists
-        ulong pos = BinarySearch(data);
-        return (static_cast<ulong>(pos) < size && elements[pos] == data); // Check if element found
+        return Holds(BinarySearch(data), data);
     }
 
-    template <typename Data>
-    void SetVec<Data>::Clear()
+    template <typename Data, typename Compare>
+    void SetVec<Data, Compare>::Clear()
     {
         Vector<Data>::Clear(); // Delegate to Vector's Clear method
+        indexed = false;
+    }
+
+    // Specific member functions (iterators)
+
+    template <typename Data, typename Compare>
+    typename SetVec<Data, Compare>::ConstIterator SetVec<Data, Compare>::begin() const noexcept
+    {
+        return Vector<Data>::cbegin(); // Read-only: writing through it could break the ordering
+    }
+
+    template <typename Data, typename Compare>
+    typename SetVec<Data, Compare>::ConstIterator SetVec<Data, Compare>::end() const noexcept
+    {
+        return Vector<Data>::cend();
     }
 
     // Protected auxiliary functions
 
-    template <typename Data>
-    ulong SetVec<Data>::BinarySearch(const Data &data) const
+    template <typename Data, typename Compare>
+    ulong SetVec<Data, Compare>::BinarySearch(const Data &data) const
     {
         if (this->Empty())
         {
             return 0; // Empty vector - insertion point is at beginning
         }
 
-        long left = 0;
-        long right = size - 1;
-
-        while (left <= right)
+        if constexpr (std::is_arithmetic_v<Data>)
         {
-            long mid = left + (right - left) / 2; // Calculate middle index (avoids overflow)
-
-            if (elements[mid] == data)
+            // Branchless: the comparison picks the half with a conditional move,
+            // so nothing mispredicts; both candidate midpoints of the next step
+            // are requested while this one is compared
+            const Data *base = elements;
+            ulong count = size;
+            while (count > 1)
             {
-                return mid; // Element found
+                const ulong half = count / 2;
+                const ulong next = (count - half) / 2;
+                __builtin_prefetch(base + next);
+                __builtin_prefetch(base + half + next);
+                base = compare(base[half], data) ? base + half : base;
+                count -= half;
             }
-            else if (elements[mid] < data)
+            return (base - elements) + compare(*base, data);
+        }
+
+        ulong left = 0;
+        ulong right = size;
+
+        while (left < right)
+        {
+            ulong mid = left + (right - left) / 2; // Calculate middle index (avoids overflow)
+
+            if (compare(elements[mid], data))
             {
                 left = mid + 1; // Search right half
             }
             else
             {
-                right = mid - 1; // Search left half
+                right = mid; // Search left half, mid included
             }
         }
 
-        return left; // Return insertion point if not found
+        return left; // One comparison per step: the caller checks for an equivalent element
     }
 
-    template <typename Data>
-    long SetVec<Data>::FindPredecessorPos(const Data &data) const
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::Holds(ulong pos, const Data &data) const noexcept
     {
-        if (this->Empty() || data <= Min())
+        return pos < size && !compare(data, elements[pos]); // Not below the value nor above it
+    }
+
+    template <typename Data, typename Compare>
+    long SetVec<Data, Compare>::FindPredecessorPos(const Data &data) const
+    {
+        if (this->Empty() || !compare(Min(), data))
         {
             return -1; // No predecessor if empty or if data is the minimum
         }
@@ -389,7 +525,7 @@ namespace lasd
         ulong pos = BinarySearch(data); // Find position of element or insertion point
 
         // If the exact element is found
-        if (static_cast<ulong>(pos) < size && elements[pos] == data)
+        if (Holds(pos, data))
         {
             if (pos > 0)
             {
@@ -410,10 +546,10 @@ namespace lasd
         return -1; // No predecessor found
     }
 
-    template <typename Data>
-    long SetVec<Data>::FindSuccessorPos(const Data &data) const
+    template <typename Data, typename Compare>
+    long SetVec<Data, Compare>::FindSuccessorPos(const Data &data) const
     {
-        if (this->Empty() || data >= Max())
+        if (this->Empty() || !compare(data, Max()))
         {
             return -1; // No successor if empty or if data is the maximum
         }
@@ -421,7 +557,7 @@ namespace lasd
         ulong pos = BinarySearch(data); // Find position of element or insertion point
 
         // If the exact element is found
-        if (static_cast<ulong>(pos) < size && elements[pos] == data)
+        if (Holds(pos, data))
         {
             if (static_cast<ulong>(pos) < size - 1)
             {
@@ -442,43 +578,227 @@ namespace lasd
         return -1; // No successor found
     }
 
-    template <typename Data>
-    void SetVec<Data>::ShiftRight(ulong pos)
+    // Specific member functions (ordering)
+
+    template <typename Data, typename Compare>
+    Compare SetVec<Data, Compare>::Comparator() const
     {
-        for (ulong i = size - 1; i > pos; i--)
+        return compare;
+    }
+
+    // Specific member functions (lookup engine)
+
+    template <typename Data, typename Compare>
+    void SetVec<Data, Compare>::Layout(SearchLayout engine) noexcept
+    {
+        layout = engine;
+        if (engine == SearchLayout::Sorted)
+        {
+            shadow.Clear(); // Nothing reads it any more
+            indexed = false;
+        }
+    }
+
+    template <typename Data, typename Compare>
+    SearchLayout SetVec<Data, Compare>::Layout() const noexcept
+    {
+        return layout;
+    }
+
+    template <typename Data, typename Compare>
+    bool SetVec<Data, Compare>::IndexReady() const noexcept
+    {
+        if (indexed)
+        {
+            return true;
+        }
+
+        try
+        {
+            shadow.Resize(size + 1 + IndexStride);
+
+            // Node 0 (never read) on a cache-line boundary: each prefetched line
+            // then holds IndexStride whole nodes of the same level
+            const ulong misalignment = reinterpret_cast<uintptr_t>(shadow.begin()) % 64;
+            shadowBase = ((64 - misalignment) % 64) / sizeof(Data);
+            FillIndex(shadow.begin() + shadowBase, 1, 0);
+        }
+        catch (...)
+        {
+            return false; // The sorted elements answer instead
+        }
+        indexed = true;
+        return true;
+    }
+
+    template <typename Data, typename Compare>
+    ulong SetVec<Data, Compare>::FillIndex(Data *tree, ulong node, ulong position) const
+    {
+        if (node > size)
+        {
+            return position;
+        }
+
+        // In-order walk of the implicit tree: the sorted elements go in one after the other
+        position = FillIndex(tree, 2 * node, position);
+        tree[node] = elements[position++];
+        return FillIndex(tree, 2 * node + 1, position);
+    }
+
+    template <typename Data, typename Compare>
+    template <bool Upper>
+    ulong SetVec<Data, Compare>::Descend(const Data &data) const noexcept
+    {
+        const Data *tree = shadow.begin() + shadowBase;
+        ulong node = 1;
+        while (node <= size)
+        {
+            __builtin_prefetch(tree + node * IndexStride); // Descendants a few levels down (may be past the end: a hint only)
+            if constexpr (Upper)
+            {
+                node = 2 * node + !compare(data, tree[node]);
+            }
+            else
+            {
+                node = 2 * node + compare(tree[node], data);
+            }
+        }
+        return node; // 1 followed by one bit per level: 1 where the walk turned right
+    }
+
+    template <typename Data, typename Compare>
+    void SetVec<Data, Compare>::ShiftRight(ulong pos)
+    {
+        // The last slot already holds the former maximum: shift the remaining tail into the moved-from slot
+        for (ulong i = size - 2; i > pos; i--)
         {
             elements[i] = std::move(elements[i - 1]); // Shift elements right starting from the end
         }
     }
 
-    template <typename Data>
-    void SetVec<Data>::ShiftLeft(ulong pos)
+    template <typename Data, typename Compare>
+    void SetVec<Data, Compare>::ShiftLeft(ulong pos)
     {
         for (ulong i = pos; i < size - 1; i++)
         {
             elements[i] = std::move(elements[i + 1]); // Shift elements left to overwrite removed element
         }
         Vector<Data>::Resize(size - 1); // Resize to remove last element
+        indexed = false;
+    }
+
+    template <typename Data, typename Compare>
+    void SetVec<Data, Compare>::Sort()
+    {
+        PdqSort(elements, elements + size, compare); // Shared sorting engine (O(n log n))
     }
 
-    template <typename Data>
-    void SetVec<Data>::Sort()
+    template <typename Data, typename Compare>
+    void SetVec<Data, Compare>::SortUnique(const bool sorted)
     {
-        // Insertion sort algorithm
-        for (ulong i = 1; i < size; i++)
+        if (!sorted)
         {
-            Data key = std::move(elements[i]); // Element to be inserted in sorted position
-            long j = i - 1;
+            Sort();
+        }
+        else if (!IsSorted(elements, elements + size, compare))
+        {
+            Vector<Data>::Clear(); // Leave an empty, valid set behind
+            throw std::invalid_argument("SetVec: Input not sorted");
+        }
+
+        Vector<Data>::Resize(Unique(elements, elements + size, compare) - elements); // Destroy the moved-from duplicates at the tail
+        indexed = false;
+    }
 
-            // Shift elements greater than key to the right
-            while (j >= 0 && elements[j] > key)
+    template <typename Data, typename Compare>
+    ulong SetVec<Data, Compare>::MergeInsert(Vector<Data> &batch)
+    {
+        PdqSort(batch.begin(), batch.end(), compare);
+        Data *keys = batch.begin();
+        ulong count = Unique(batch.begin(), batch.end(), compare) - keys;
+
+        // Keep only the keys missing from the set, still in ascending order (O(m log n))
+        ulong added = 0;
+        for (ulong j = 0; j < count; j++)
+        {
+            if (!Holds(BinarySearch(keys[j]), keys[j]))
+            {
+                if (added != j)
+                {
+                    keys[added] = std::move(keys[j]);
+                }
+                added++;
+            }
+        }
+        if (added == 0)
+        {
+            return 0;
+        }
+
+        // Merge from the back: every element moves at most once, straight to its final slot.
+        // Room grows geometrically, as with PushBack, so small batches do not relocate the set each time
+        if (size + added > Vector<Data>::Capacity())
+        {
+            Vector<Data>::Reserve(Vector<Data>::GrowthCapacity(size + added));
+        }
+        ulong i = size;
+        ulong target = size + added;
+        for (ulong j = added; j > 0;)
+        {
+            --target;
+            Data &source = (i > 0 && compare(keys[j - 1], elements[i - 1])) ? elements[--i] : keys[--j];
+            if (target >= size)
             {
-                elements[j + 1] = std::move(elements[j]);
-                j--;
+                new (elements + target) Data(std::move(source)); // The top added slots are raw storage
             }
+            else
+            {
+                elements[target] = std::move(source);
+            }
+        }
+        size += added; // Elements below the smallest new key never moved
+        indexed = false;
+        return added;
+    }
+
+    template <typename Data, typename Compare>
+    ulong SetVec<Data, Compare>::MergeRemove(Vector<Data> &batch)
+    {
+        PdqSort(batch.begin(), batch.end(), compare);
+        const Data *keys = batch.begin();
+        ulong count = Unique(batch.begin(), batch.end(), compare) - keys;
+        if (count == 0 || size == 0)
+        {
+            return 0;
+        }
 
-            elements[j + 1] = std::move(key); // Insert key at correct position
+        // Compact from the first position the batch can touch
+        ulong write = BinarySearch(keys[0]);
+        ulong removed = 0;
+        ulong j = 0;
+        for (ulong read = write; read < size; read++)
+        {
+            while (j < count && compare(keys[j], elements[read]))
+            {
+                j++; // Batch key absent from the set
+            }
+            if (j < count && !compare(elements[read], keys[j]))
+            {
+                j++;
+                removed++; // Dropped: its slot is overwritten by the next kept element
+            }
+            else
+            {
+                if (write != read)
+                {
+                    elements[write] = std::move(elements[read]);
+                }
+                write++;
+            }
         }
+        Vector<Data>::Resize(write); // Destroy the moved-from tail
+        indexed = false;
+        return removed;
     }
 
     /* ************************************************************************** */
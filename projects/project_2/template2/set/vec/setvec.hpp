@@ -3,6 +3,10 @@
 
 /* ************************************************************************** */
 
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
 #include "../set.hpp"
 #include "../../vector/vector.hpp"
 
@@ -13,12 +17,23 @@ namespace lasd
 
   /* ************************************************************************** */
 
-  template <typename Data>
+  // Search engine behind the const lookups of a SetVec (Exists, Predecessor, Successor)
+  enum class SearchLayout
+  {
+    Sorted,   // Binary search on the sorted elements (branchless for arithmetic types)
+    Eytzinger // Shadow copy in BFS order, rebuilt on the first lookup after an update
+  };
+
+  /* ************************************************************************** */
+
+  template <typename Data, typename Compare = std::less<Data>>
   class SetVec : virtual public Set<Data>,
                  virtual protected Vector<Data>
   {
     // Must extend Set<Data>,
     //             Vector<Data>
+    // Compare: strict weak ordering of the elements (ascending by default);
+    // elements neither before nor after each other are the same element
 
   private:
     // ...
@@ -27,7 +42,20 @@ namespace lasd
     using Vector<Data>::elements; // Access to the array of elements from Vector
     using Container::size;        // Access to size member from Container
 
-    // ...
+    [[no_unique_address]] Compare compare = Compare(); // Takes no space when stateless
+
+    // Nodes of the shadow index per cache line: node k * IndexStride holds the
+    // descendants of k a few levels down, prefetched while k is compared
+    static constexpr ulong IndexStride = (sizeof(Data) < 64) ? 64 / sizeof(Data) : 1;
+
+    SearchLayout layout = SearchLayout::Sorted;
+
+    // Eytzinger shadow index: node k has children 2k and 2k + 1, the root is 1;
+    // a lookup walks down from the root reading one node per level, and the
+    // top levels share a few cache lines
+    mutable Vector<Data> shadow; // Nodes from shadowBase + 1, with slack to align node 0 to a cache line
+    mutable ulong shadowBase = 0;
+    mutable bool indexed = false; // The shadow matches the elements
 
   public:
     // Default constructor
@@ -35,9 +63,17 @@ namespace lasd
 
     /* ************************************************************************ */
 
-    // Specific constructors
-    SetVec(const TraversableContainer<Data> &);  // A set obtained from a TraversableContainer
-    SetVec(MappableContainer<Data> &&) noexcept; // A set obtained from a MappableContainer
+    // Specific constructors (one copy, one sort, one deduplicating pass: O(n log n))
+    explicit SetVec(const Compare &);                                        // An empty set ordered by the given comparator
+    SetVec(const TraversableContainer<Data> &, const Compare & = Compare()); // A set obtained from a TraversableContainer
+    SetVec(MappableContainer<Data> &&, const Compare & = Compare());         // A set obtained from a MappableContainer
+
+    /* ************************************************************************ */
+
+    // Specific factories (input in Compare order, duplicates allowed: O(n), no sort;
+    // must throw std::invalid_argument when the input is not sorted)
+    static SetVec FromSorted(const TraversableContainer<Data> &, const Compare & = Compare()); // A set copied from sorted input
+    static SetVec FromSorted(MappableContainer<Data> &&, const Compare & = Compare());         // A set moved from sorted input
 
     /* ************************************************************************ */
 
@@ -94,6 +130,17 @@ namespace lasd
     bool Insert(Data &&) override;      // Add an element if not already present (move)
     bool Remove(const Data &) override; // Remove an element if present
 
+    // Batched operations: the batch is staged, sorted and deduplicated once, then merged
+    // with the set in one linear pass, O(n + m log m); results as with one call per element
+
+    bool InsertAll(const TraversableContainer<Data> &) override; // True if every element was inserted (copy)
+    bool InsertAll(MappableContainer<Data> &&) override;         // True if every element was inserted (move)
+    bool RemoveAll(const TraversableContainer<Data> &) override; // True if every element was removed
+
+    bool InsertSome(const TraversableContainer<Data> &) override; // True if some element was inserted (copy)
+    bool InsertSome(MappableContainer<Data> &&) override;         // True if some element was inserted (move)
+    bool RemoveSome(const TraversableContainer<Data> &) override; // True if some element was removed
+
     /* ************************************************************************ */
 
     // Specific member functions (inherited from LinearContainer)
@@ -102,6 +149,39 @@ namespace lasd
     using Vector<Data>::Front;      // Access first element
     using Vector<Data>::Back;       // Access last element
 
+    using Vector<Data>::TraverseWhile; // Early-exit traversal (ascending order)
+
+    using Vector<Data>::ForEach; // Template traversal fast path (ascending order)
+    using Vector<Data>::Reduce;  // Template fold fast path (ascending order)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (read-only contiguous iterators, ascending order)
+
+    using ConstIterator = typename Vector<Data>::ConstIterator;
+
+    ConstIterator begin() const noexcept; // Smallest element
+    ConstIterator end() const noexcept;   // Past the largest element
+
+    using Vector<Data>::cbegin;
+    using Vector<Data>::cend;
+
+    /* ************************************************************************ */
+
+    // Specific member functions (ordering)
+
+    Compare Comparator() const; // The ordering of the elements (Min is the first in it)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (lookup engine)
+
+    // The Eytzinger layout trades one more copy of the elements for lookups
+    // that touch fewer cache lines; the copy is built by the first lookup after
+    // an update, so concurrent readers must not be the first ones after a write
+    void Layout(SearchLayout) noexcept; // Select the engine (back to Sorted releases the shadow)
+    SearchLayout Layout() const noexcept;
+
     /* ************************************************************************** */
 
     // Specific member function (inherited from TestableContainer)
@@ -118,7 +198,14 @@ namespace lasd
     // Auxiliary functions
 
     // Binary search function for finding an element or its insertion point
-    ulong BinarySearch(const Data &) const; // Efficiently locate elements in sorted array
+    ulong BinarySearch(const Data &) const;         // Efficiently locate elements in sorted array (first position not below the value)
+    bool Holds(ulong, const Data &) const noexcept; // Whether the position found by BinarySearch holds an element equivalent to the value
+
+    // Eytzinger shadow index
+    bool IndexReady() const noexcept;              // Build the shadow if stale (false when it cannot be allocated)
+    ulong FillIndex(Data *, ulong, ulong) const;   // Copy elements from a position into the subtree of a node, in order; returns the next position
+    template <bool Upper>
+    ulong Descend(const Data &) const noexcept;    // Walk down to a leaf (turning right on nodes below the value, or not above it when Upper): the path is in the bits
 
     // Find the position of the predecessor to a given data value
     long FindPredecessorPos(const Data &) const; // Find index of predecessor element
@@ -134,6 +221,13 @@ namespace lasd
 
     // Sorts the vector to maintain order when needed
     void Sort(); // Ensure elements remain in sorted order
+
+    // Turns the bulk-loaded elements into a set: sort unless already sorted, then drop duplicates
+    void SortUnique(const bool); // Argument: elements are claimed sorted (checked, not sorted again)
+
+    // Batched operations on a staged copy of the batch (the batch is sorted and consumed)
+    ulong MergeInsert(Vector<Data> &); // Insert the batch in one backward merge, returns how many were new
+    ulong MergeRemove(Vector<Data> &); // Remove the batch in one compaction pass, returns how many were present
   };
 
   /* ************************************************************************** */
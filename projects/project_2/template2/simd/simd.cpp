@@ -0,0 +1,430 @@
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Auxiliary routines (not part of the public interface)
+
+  namespace detail
+  {
+
+    // Upper bound on the level, lowered by SimdLimit (one for the whole program)
+    inline std::atomic<SimdLevel> SimdCap{SimdLevel::Avx512};
+
+    // Register of Bytes / sizeof(Data) lanes (GCC and Clang vector extensions)
+    template <typename Data, ulong Bytes>
+    struct SimdRegister
+    {
+      typedef Data Type __attribute__((vector_size(Bytes)));
+    };
+
+    template <typename Data, ulong Bytes>
+    using SimdVector = typename SimdRegister<Data, Bytes>::Type;
+
+    // Unaligned load and store: memcpy compiles to a single vector move.
+    // Registers never travel by value, as the calling convention for wide
+    // vectors depends on the instruction set of the caller.
+    template <typename Vec, typename Data>
+    [[gnu::always_inline]] inline void SimdLoad(Vec &value, const Data *source) noexcept
+    {
+      std::memcpy(&value, source, sizeof(Vec));
+    }
+
+    template <typename Vec, typename Data>
+    [[gnu::always_inline]] inline void SimdStore(Data *destination, const Vec &value) noexcept
+    {
+      std::memcpy(destination, &value, sizeof(Vec));
+    }
+
+    // Whether some lane of a mask is not zero
+    template <typename Mask>
+    [[gnu::always_inline]] inline bool SimdAny(const Mask &mask) noexcept
+    {
+      ulong words[sizeof(Mask) / sizeof(ulong)];
+      std::memcpy(words, &mask, sizeof(Mask));
+      ulong any = 0;
+      for (ulong word : words)
+      {
+        any |= word;
+      }
+      return any != 0;
+    }
+
+    /* ************************************************************************ */
+
+    // Kernels: Run<Bytes> is the loop for one register width, inlined into the
+    // entry point compiled for the matching instruction set. The main loops
+    // keep four registers in flight so the latency of each step is hidden.
+
+    template <typename Data>
+    struct SumKernel
+    {
+      template <ulong Bytes>
+      [[gnu::always_inline]] static inline Data Run(const Data *begin, const Data *end) noexcept
+      {
+        using Vec = SimdVector<Data, Bytes>;
+        constexpr std::ptrdiff_t Lanes = Bytes / sizeof(Data);
+
+        Vec first{}, second{}, third{}, fourth{}, loaded;
+        for (; end - begin >= 4 * Lanes; begin += 4 * Lanes)
+        {
+          SimdLoad(loaded, begin);
+          first += loaded;
+          SimdLoad(loaded, begin + Lanes);
+          second += loaded;
+          SimdLoad(loaded, begin + 2 * Lanes);
+          third += loaded;
+          SimdLoad(loaded, begin + 3 * Lanes);
+          fourth += loaded;
+        }
+        first = (first + second) + (third + fourth);
+
+        Data sum = 0;
+        for (std::ptrdiff_t lane = 0; lane < Lanes; lane++)
+        {
+          sum += first[lane];
+        }
+        for (; begin < end; ++begin)
+        {
+          sum += *begin;
+        }
+        return sum;
+      }
+    };
+
+    // Minimum (Largest false) or maximum (Largest true) of a non-empty range
+    template <typename Data, bool Largest>
+    struct ExtremeKernel
+    {
+      // Keep the better of two values, lane by lane on registers
+      template <typename Value>
+      [[gnu::always_inline]] static inline void Pick(Value &current, const Value &candidate) noexcept
+      {
+        if constexpr (Largest)
+        {
+          current = (current < candidate) ? candidate : current;
+        }
+        else
+        {
+          current = (candidate < current) ? candidate : current;
+        }
+      }
+
+      template <ulong Bytes>
+      [[gnu::always_inline]] static inline Data Run(const Data *begin, const Data *end) noexcept
+      {
+        using Vec = SimdVector<Data, Bytes>;
+        constexpr std::ptrdiff_t Lanes = Bytes / sizeof(Data);
+
+        Data best = *begin;
+        if (end - begin >= 4 * Lanes)
+        {
+          Vec first, second, third, fourth, loaded;
+          SimdLoad(first, begin);
+          SimdLoad(second, begin + Lanes);
+          SimdLoad(third, begin + 2 * Lanes);
+          SimdLoad(fourth, begin + 3 * Lanes);
+          for (begin += 4 * Lanes; end - begin >= 4 * Lanes; begin += 4 * Lanes)
+          {
+            SimdLoad(loaded, begin);
+            Pick(first, loaded);
+            SimdLoad(loaded, begin + Lanes);
+            Pick(second, loaded);
+            SimdLoad(loaded, begin + 2 * Lanes);
+            Pick(third, loaded);
+            SimdLoad(loaded, begin + 3 * Lanes);
+            Pick(fourth, loaded);
+          }
+          Pick(first, second);
+          Pick(third, fourth);
+          Pick(first, third);
+          for (std::ptrdiff_t lane = 0; lane < Lanes; lane++)
+          {
+            Pick(best, static_cast<Data>(first[lane]));
+          }
+        }
+        for (; begin < end; ++begin)
+        {
+          Pick(best, *begin);
+        }
+        return best;
+      }
+    };
+
+    template <typename Data>
+    struct CountKernel
+    {
+      template <ulong Bytes>
+      [[gnu::always_inline]] static inline ulong Run(const Data *begin, const Data *end, Data value) noexcept
+      {
+        using Vec = SimdVector<Data, Bytes>;
+        constexpr std::ptrdiff_t Lanes = Bytes / sizeof(Data);
+
+        const Vec key = Vec{} + value;
+        Vec loaded;
+        decltype(key == key) first{}, second{}; // Equal lanes are -1: subtracting the mask counts them
+        for (; end - begin >= 4 * Lanes; begin += 4 * Lanes)
+        {
+          SimdLoad(loaded, begin);
+          first -= (loaded == key);
+          SimdLoad(loaded, begin + Lanes);
+          second -= (loaded == key);
+          SimdLoad(loaded, begin + 2 * Lanes);
+          first -= (loaded == key);
+          SimdLoad(loaded, begin + 3 * Lanes);
+          second -= (loaded == key);
+        }
+        first += second;
+
+        ulong count = 0;
+        for (std::ptrdiff_t lane = 0; lane < Lanes; lane++)
+        {
+          count += static_cast<ulong>(first[lane]);
+        }
+        for (; begin < end; ++begin)
+        {
+          count += (*begin == value);
+        }
+        return count;
+      }
+    };
+
+    template <typename Data>
+    struct FindKernel
+    {
+      template <ulong Bytes>
+      [[gnu::always_inline]] static inline bool Run(const Data *begin, const Data *end, Data value) noexcept
+      {
+        using Vec = SimdVector<Data, Bytes>;
+        constexpr std::ptrdiff_t Lanes = Bytes / sizeof(Data);
+
+        const Vec key = Vec{} + value;
+        Vec loaded;
+        for (; end - begin >= 4 * Lanes; begin += 4 * Lanes)
+        {
+          // Matches counted as in CountKernel: GCC keeps a sum of masks in
+          // registers on every level, while an or of 64-byte masks goes scalar
+          decltype(key == key) matches{};
+          SimdLoad(loaded, begin);
+          matches -= (loaded == key);
+          SimdLoad(loaded, begin + Lanes);
+          matches -= (loaded == key);
+          SimdLoad(loaded, begin + 2 * Lanes);
+          matches -= (loaded == key);
+          SimdLoad(loaded, begin + 3 * Lanes);
+          matches -= (loaded == key);
+          if (SimdAny(matches))
+          {
+            return true;
+          }
+        }
+        for (; begin < end; ++begin)
+        {
+          if (*begin == value)
+          {
+            return true;
+          }
+        }
+        return false;
+      }
+    };
+
+    // Elementwise update by an operation applied in place to a register or to a single element
+    template <typename Data, typename Operation>
+    struct MapKernel
+    {
+      template <ulong Bytes>
+      [[gnu::always_inline]] static inline void Run(Data *begin, Data *end, Operation operation) noexcept
+      {
+        using Vec = SimdVector<Data, Bytes>;
+        constexpr std::ptrdiff_t Lanes = Bytes / sizeof(Data);
+
+        Vec first, second, third, fourth;
+        for (; end - begin >= 4 * Lanes; begin += 4 * Lanes)
+        {
+          SimdLoad(first, begin);
+          SimdLoad(second, begin + Lanes);
+          SimdLoad(third, begin + 2 * Lanes);
+          SimdLoad(fourth, begin + 3 * Lanes);
+          operation(first);
+          operation(second);
+          operation(third);
+          operation(fourth);
+          SimdStore(begin, first);
+          SimdStore(begin + Lanes, second);
+          SimdStore(begin + 2 * Lanes, third);
+          SimdStore(begin + 3 * Lanes, fourth);
+        }
+        for (; begin < end; ++begin)
+        {
+          operation(*begin);
+        }
+      }
+    };
+
+    // Operations for MapKernel: Value{} + x is x on a single element and x in every lane on a register
+
+    template <typename Data>
+    struct ScaleOperation
+    {
+      Data factor;
+
+      template <typename Value>
+      [[gnu::always_inline]] void operator()(Value &value) const noexcept { value *= Value{} + factor; }
+    };
+
+    template <typename Data>
+    struct AddOperation
+    {
+      Data addend;
+
+      template <typename Value>
+      [[gnu::always_inline]] void operator()(Value &value) const noexcept { value += Value{} + addend; }
+    };
+
+    template <typename Data>
+    struct ClampOperation
+    {
+      Data low;
+      Data high;
+
+      template <typename Value>
+      [[gnu::always_inline]] void operator()(Value &value) const noexcept
+      {
+        const Value lower = Value{} + low;
+        const Value upper = Value{} + high;
+        value = (value < lower) ? lower : value;
+        value = (upper < value) ? upper : value;
+      }
+    };
+
+    /* ************************************************************************ */
+
+#if defined(__x86_64__) || defined(__i386__)
+
+    // Entry points compiled for the wider instruction sets
+    template <typename Kernel, typename... Arguments>
+    [[gnu::target("avx512f,avx512dq")]] auto SimdRunAvx512(Arguments... arguments) noexcept
+    {
+      return Kernel::template Run<64>(arguments...);
+    }
+
+    template <typename Kernel, typename... Arguments>
+    [[gnu::target("avx2")]] auto SimdRunAvx2(Arguments... arguments) noexcept
+    {
+      return Kernel::template Run<32>(arguments...);
+    }
+
+#endif
+
+    // Run the kernel on the active level
+    template <typename Kernel, typename... Arguments>
+    auto SimdDispatch(Arguments... arguments) noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+      switch (SimdActive())
+      {
+      case SimdLevel::Avx512:
+        return SimdRunAvx512<Kernel>(arguments...);
+      case SimdLevel::Avx2:
+        return SimdRunAvx2<Kernel>(arguments...);
+      default:
+        break;
+      }
+#endif
+      return Kernel::template Run<16>(arguments...);
+    }
+
+  }
+
+
+  /* ************************************************************************** */
+
+  inline SimdLevel SimdSupported() noexcept
+  {
+    static const SimdLevel supported = []() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+      if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+      {
+        return SimdLevel::Avx512;
+      }
+      if (__builtin_cpu_supports("avx2"))
+      {
+        return SimdLevel::Avx2;
+      }
+#endif
+      return SimdLevel::Baseline;
+    }();
+    return supported;
+  }
+
+  inline SimdLevel SimdActive() noexcept
+  {
+    SimdLevel cap = detail::SimdCap.load(std::memory_order_relaxed);
+    SimdLevel supported = SimdSupported();
+    return (cap < supported) ? cap : supported;
+  }
+
+  inline void SimdLimit(SimdLevel level) noexcept
+  {
+    detail::SimdCap.store(level, std::memory_order_relaxed);
+  }
+
+  /* ************************************************************************** */
+
+  template <SimdArithmetic Data>
+  Data SimdSum(const Data *begin, const Data *end) noexcept
+  {
+    return detail::SimdDispatch<detail::SumKernel<Data>>(begin, end);
+  }
+
+  template <SimdArithmetic Data>
+  Data SimdMinimum(const Data *begin, const Data *end) noexcept
+  {
+    return detail::SimdDispatch<detail::ExtremeKernel<Data, false>>(begin, end);
+  }
+
+  template <SimdArithmetic Data>
+  Data SimdMaximum(const Data *begin, const Data *end) noexcept
+  {
+    return detail::SimdDispatch<detail::ExtremeKernel<Data, true>>(begin, end);
+  }
+
+  template <SimdArithmetic Data>
+  ulong SimdCount(const Data *begin, const Data *end, const Data &value) noexcept
+  {
+    return detail::SimdDispatch<detail::CountKernel<Data>>(begin, end, value);
+  }
+
+  template <SimdArithmetic Data>
+  bool SimdFind(const Data *begin, const Data *end, const Data &value) noexcept
+  {
+    return detail::SimdDispatch<detail::FindKernel<Data>>(begin, end, value);
+  }
+
+  template <SimdArithmetic Data>
+  void SimdScale(Data *begin, Data *end, const Data &factor) noexcept
+  {
+    detail::SimdDispatch<detail::MapKernel<Data, detail::ScaleOperation<Data>>>(begin, end, detail::ScaleOperation<Data>{factor});
+  }
+
+  template <SimdArithmetic Data>
+  void SimdAdd(Data *begin, Data *end, const Data &addend) noexcept
+  {
+    detail::SimdDispatch<detail::MapKernel<Data, detail::AddOperation<Data>>>(begin, end, detail::AddOperation<Data>{addend});
+  }
+
+  template <SimdArithmetic Data>
+  void SimdClamp(Data *begin, Data *end, const Data &low, const Data &high) noexcept
+  {
+    detail::SimdDispatch<detail::MapKernel<Data, detail::ClampOperation<Data>>>(begin, end, detail::ClampOperation<Data>{low, high});
+  }
+
+  /* ************************************************************************** */
+
+}
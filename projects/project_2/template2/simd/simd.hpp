@@ -0,0 +1,76 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+/* ************************************************************************** */
+
+#include <type_traits>
+
+#include "sys/types.h"
+
+/* ************************************************************************** */
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Vectorized kernels shared by the array-backed containers of numbers.
+  // Every routine works on the half-open range [begin, end), four vector
+  // registers at a time, and runs on the widest instruction set the CPU
+  // supports, checked at call time: AVX-512 or AVX2 on x86-64, the baseline
+  // 16-byte vectors (SSE2, NEON) otherwise. A scalar loop does the tail.
+
+  // Element types the kernels handle: arithmetic types of 4 or 8 bytes
+  template <typename Data>
+  concept SimdArithmetic = std::is_arithmetic_v<Data> && (sizeof(Data) == 4 || sizeof(Data) == 8);
+
+  // Instruction sets the kernels are compiled for, narrowest first
+  enum class SimdLevel
+  {
+    Baseline, // 16-byte vectors
+    Avx2,     // 32-byte vectors
+    Avx512    // 64-byte vectors (AVX-512 F and DQ)
+  };
+
+  inline SimdLevel SimdSupported() noexcept; // Widest level this CPU runs
+  inline SimdLevel SimdActive() noexcept;    // Level the kernels use: the supported one, capped by SimdLimit
+  inline void SimdLimit(SimdLevel) noexcept; // Cap the level for every thread (to compare or test the narrower ones)
+
+  // Sum of the elements, 0 on an empty range. The partial sums run lane by
+  // lane, so a floating point sum may round differently from a front-to-back loop
+  template <SimdArithmetic Data>
+  Data SimdSum(const Data *, const Data *) noexcept;
+
+  // Smallest and largest element of a non-empty range (unspecified if it holds a NaN)
+  template <SimdArithmetic Data>
+  Data SimdMinimum(const Data *, const Data *) noexcept;
+
+  template <SimdArithmetic Data>
+  Data SimdMaximum(const Data *, const Data *) noexcept;
+
+  // Number of elements equal (==) to the value
+  template <SimdArithmetic Data>
+  ulong SimdCount(const Data *, const Data *, const Data &) noexcept;
+
+  // Whether some element is equal (==) to the value (stops at the first block holding one)
+  template <SimdArithmetic Data>
+  bool SimdFind(const Data *, const Data *, const Data &) noexcept;
+
+  // Elementwise updates in place: multiply by the value, add the value,
+  // clamp to [low, high] (low must not be greater than high)
+  template <SimdArithmetic Data>
+  void SimdScale(Data *, Data *, const Data &) noexcept;
+
+  template <SimdArithmetic Data>
+  void SimdAdd(Data *, Data *, const Data &) noexcept;
+
+  template <SimdArithmetic Data>
+  void SimdClamp(Data *, Data *, const Data &, const Data &) noexcept;
+
+  /* ************************************************************************** */
+
+}
+
+#include "simd.cpp" // Include implementation file
+
+#endif
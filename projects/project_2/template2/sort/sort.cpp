@@ -0,0 +1,726 @@
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Auxiliary routines (not part of the public interface)
+
+  namespace detail
+  {
+
+    constexpr std::ptrdiff_t InsertionSortThreshold = 24; // Below this size insertion sort wins
+    constexpr std::ptrdiff_t NintherThreshold = 128;      // Above this size the pivot is a median of medians
+    constexpr std::ptrdiff_t PartialInsertionLimit = 8;   // Moves tolerated when betting on a nearly sorted range
+    constexpr std::ptrdiff_t MergeSortRunLength = 32;     // Runs sorted by insertion sort before merging
+
+    // Floor of the base-2 logarithm (used for the depth budget)
+    inline int FloorLog2(std::ptrdiff_t length) noexcept
+    {
+      int log = 0;
+      while (length >>= 1)
+      {
+        log++;
+      }
+      return log;
+    }
+
+    // Sort three elements in place
+    template <typename Data, typename Compare>
+    inline void SortThree(Data *first, Data *second, Data *third, Compare &compare)
+    {
+      if (compare(*second, *first))
+      {
+        std::swap(*first, *second);
+      }
+      if (compare(*third, *second))
+      {
+        std::swap(*second, *third);
+        if (compare(*second, *first))
+        {
+          std::swap(*first, *second);
+        }
+      }
+    }
+
+    // Insertion sort that relies on *(begin - 1) being no greater than any element in the range
+    template <typename Data, typename Compare>
+    void UnguardedInsertionSort(Data *begin, Data *end, Compare &compare)
+    {
+      if (begin == end)
+      {
+        return;
+      }
+
+      for (Data *current = begin + 1; current < end; ++current)
+      {
+        Data *hole = current;
+        if (compare(*hole, *(hole - 1)))
+        {
+          Data value = std::move(*hole); // Lift the element out once and shift the others into the hole
+          do
+          {
+            *hole = std::move(*(hole - 1));
+            --hole;
+          } while (compare(value, *(hole - 1)));
+          *hole = std::move(value);
+        }
+      }
+    }
+
+    // Insertion sort that gives up after PartialInsertionLimit moves (returns true if the range ended up sorted)
+    template <typename Data, typename Compare>
+    bool PartialInsertionSort(Data *begin, Data *end, Compare &compare)
+    {
+      if (begin == end)
+      {
+        return true;
+      }
+
+      std::ptrdiff_t moves = 0;
+      for (Data *current = begin + 1; current < end; ++current)
+      {
+        Data *hole = current;
+        if (compare(*hole, *(hole - 1)))
+        {
+          Data value = std::move(*hole);
+          do
+          {
+            *hole = std::move(*(hole - 1));
+            --hole;
+          } while (hole != begin && compare(value, *(hole - 1)));
+          *hole = std::move(value);
+          moves += current - hole;
+        }
+        if (moves > PartialInsertionLimit)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // Restore the heap property below index inside a max-heap of the given length
+    template <typename Data, typename Compare>
+    void SiftDown(Data *heap, std::ptrdiff_t index, std::ptrdiff_t length, Compare &compare)
+    {
+      Data value = std::move(heap[index]);
+      std::ptrdiff_t child = 2 * index + 1;
+      while (child < length)
+      {
+        if (child + 1 < length && compare(heap[child], heap[child + 1]))
+        {
+          child++; // Pick the larger child
+        }
+        if (!compare(value, heap[child]))
+        {
+          break;
+        }
+        heap[index] = std::move(heap[child]); // Move the child up into the hole
+        index = child;
+        child = 2 * index + 1;
+      }
+      heap[index] = std::move(value);
+    }
+
+    // Partition around *begin, putting elements equal to the pivot on the right.
+    // Returns the final pivot position and whether the range was already partitioned.
+    template <typename Data, typename Compare>
+    std::pair<Data *, bool> PartitionRight(Data *begin, Data *end, Compare &compare)
+    {
+      Data pivot = std::move(*begin);
+      Data *first = begin;
+      Data *last = end;
+
+      // The median-of-three guarantees an element >= pivot exists on the right
+      while (compare(*++first, pivot))
+      {
+      }
+
+      // Guard the left scan only if nothing smaller was skipped
+      if (first - 1 == begin)
+      {
+        while (first < last && !compare(*--last, pivot))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(*--last, pivot))
+        {
+        }
+      }
+
+      bool alreadyPartitioned = first >= last;
+
+      while (first < last)
+      {
+        std::swap(*first, *last);
+        while (compare(*++first, pivot))
+        {
+        }
+        while (!compare(*--last, pivot))
+        {
+        }
+      }
+
+      Data *pivotPosition = first - 1;
+      *begin = std::move(*pivotPosition);
+      *pivotPosition = std::move(pivot);
+
+      return std::make_pair(pivotPosition, alreadyPartitioned);
+    }
+
+    // Partition around *begin, putting elements equal to the pivot on the left.
+    // Used when the pivot equals the element before the range: the equal block is then final.
+    template <typename Data, typename Compare>
+    Data *PartitionLeft(Data *begin, Data *end, Compare &compare)
+    {
+      Data pivot = std::move(*begin);
+      Data *first = begin;
+      Data *last = end;
+
+      while (compare(pivot, *--last))
+      {
+      }
+
+      if (last + 1 == end)
+      {
+        while (first < last && !compare(pivot, *++first))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(pivot, *++first))
+        {
+        }
+      }
+
+      while (first < last)
+      {
+        std::swap(*first, *last);
+        while (compare(pivot, *--last))
+        {
+        }
+        while (!compare(pivot, *++first))
+        {
+        }
+      }
+
+      Data *pivotPosition = last;
+      *begin = std::move(*pivotPosition);
+      *pivotPosition = std::move(pivot);
+
+      return pivotPosition;
+    }
+
+    // Main pdqsort loop (recurses on the left part, iterates on the right one)
+    template <typename Data, typename Compare>
+    void PdqSortLoop(Data *begin, Data *end, Compare &compare, int badAllowed, bool leftmost)
+    {
+      while (true)
+      {
+        std::ptrdiff_t length = end - begin;
+
+        if (length < InsertionSortThreshold)
+        {
+          if (leftmost)
+          {
+            InsertionSort(begin, end, compare);
+          }
+          else
+          {
+            UnguardedInsertionSort(begin, end, compare);
+          }
+          return;
+        }
+
+        // Choose the pivot as median of 3 (or pseudo median of 9) and move it to *begin
+        std::ptrdiff_t half = length / 2;
+        if (length > NintherThreshold)
+        {
+          SortThree(begin, begin + half, end - 1, compare);
+          SortThree(begin + 1, begin + (half - 1), end - 2, compare);
+          SortThree(begin + 2, begin + (half + 1), end - 3, compare);
+          SortThree(begin + (half - 1), begin + half, begin + (half + 1), compare);
+          std::swap(*begin, *(begin + half));
+        }
+        else
+        {
+          SortThree(begin + half, begin, end - 1, compare);
+        }
+
+        // The pivot equals the element before this range: everything equal to it is already in place
+        if (!leftmost && !compare(*(begin - 1), *begin))
+        {
+          begin = PartitionLeft(begin, end, compare) + 1;
+          continue;
+        }
+
+        std::pair<Data *, bool> partition = PartitionRight(begin, end, compare);
+        Data *pivotPosition = partition.first;
+        bool alreadyPartitioned = partition.second;
+
+        std::ptrdiff_t leftLength = pivotPosition - begin;
+        std::ptrdiff_t rightLength = end - (pivotPosition + 1);
+        bool highlyUnbalanced = leftLength < length / 8 || rightLength < length / 8;
+
+        if (highlyUnbalanced)
+        {
+          // Too many bad pivots: fall back to heapsort to keep O(n log n)
+          if (--badAllowed == 0)
+          {
+            HeapSort(begin, end, compare);
+            return;
+          }
+
+          // Break the pattern that produced the bad pivot
+          if (leftLength >= InsertionSortThreshold)
+          {
+            std::swap(*begin, *(begin + leftLength / 4));
+            std::swap(*(pivotPosition - 1), *(pivotPosition - leftLength / 4));
+            if (leftLength > NintherThreshold)
+            {
+              std::swap(*(begin + 1), *(begin + (leftLength / 4 + 1)));
+              std::swap(*(begin + 2), *(begin + (leftLength / 4 + 2)));
+              std::swap(*(pivotPosition - 2), *(pivotPosition - (leftLength / 4 + 1)));
+              std::swap(*(pivotPosition - 3), *(pivotPosition - (leftLength / 4 + 2)));
+            }
+          }
+
+          if (rightLength >= InsertionSortThreshold)
+          {
+            std::swap(*(pivotPosition + 1), *(pivotPosition + (1 + rightLength / 4)));
+            std::swap(*(end - 1), *(end - rightLength / 4));
+            if (rightLength > NintherThreshold)
+            {
+              std::swap(*(pivotPosition + 2), *(pivotPosition + (2 + rightLength / 4)));
+              std::swap(*(pivotPosition + 3), *(pivotPosition + (3 + rightLength / 4)));
+              std::swap(*(end - 2), *(end - (1 + rightLength / 4)));
+              std::swap(*(end - 3), *(end - (2 + rightLength / 4)));
+            }
+          }
+        }
+        else if (alreadyPartitioned &&
+                 PartialInsertionSort(begin, pivotPosition, compare) &&
+                 PartialInsertionSort(pivotPosition + 1, end, compare))
+        {
+          return; // Balanced and already partitioned: bet on a sorted input and won
+        }
+
+        // Recurse on the left part, loop on the right one
+        PdqSortLoop(begin, pivotPosition, compare, badAllowed, leftmost);
+        begin = pivotPosition + 1;
+        leftmost = false;
+      }
+    }
+
+    // Merge [begin, middle) and [middle, end) moving the left run through raw buffer storage
+    template <typename Data, typename Compare>
+    void MergeWithBuffer(Data *begin, Data *middle, Data *end, Data *buffer, Compare &compare)
+    {
+      if (begin == middle || middle == end || !compare(*middle, *(middle - 1)))
+      {
+        return; // Runs already in order
+      }
+
+      Data *bufferEnd = std::uninitialized_move(begin, middle, buffer);
+      Data *left = buffer;
+      Data *right = middle;
+      Data *destination = begin;
+
+      while (left < bufferEnd && right < end)
+      {
+        if (compare(*right, *left))
+        {
+          *destination++ = std::move(*right++); // Strictly smaller: right first
+        }
+        else
+        {
+          *destination++ = std::move(*left++); // Ties keep the left element first (stability)
+        }
+      }
+      std::move(left, bufferEnd, destination); // Any right leftovers are already in place
+
+      std::destroy(buffer, bufferEnd);
+    }
+
+    // Top-down merge sort over a buffer able to hold half of the range
+    template <typename Data, typename Compare>
+    void MergeSortWithBuffer(Data *begin, Data *end, Data *buffer, Compare &compare)
+    {
+      std::ptrdiff_t length = end - begin;
+      if (length <= MergeSortRunLength)
+      {
+        InsertionSort(begin, end, compare);
+        return;
+      }
+
+      Data *middle = begin + length / 2;
+      MergeSortWithBuffer(begin, middle, buffer, compare);
+      MergeSortWithBuffer(middle, end, buffer, compare);
+      MergeWithBuffer(begin, middle, end, buffer, compare);
+    }
+
+    // Raw storage for temporary buffers (nothing constructed)
+    template <typename Data>
+    Data *AllocateBuffer(std::ptrdiff_t count)
+    {
+      return static_cast<Data *>(::operator new(count * sizeof(Data), std::align_val_t(alignof(Data))));
+    }
+
+    template <typename Data>
+    void DeallocateBuffer(Data *buffer) noexcept
+    {
+      ::operator delete(buffer, std::align_val_t(alignof(Data)));
+    }
+
+    // Number of elements taken from [a, a + aLength) among the first k outputs
+    // of the stable merge with [b, b + bLength) (merge path co-ranking)
+    template <typename Data, typename Compare>
+    std::ptrdiff_t CoRank(std::ptrdiff_t k, const Data *a, std::ptrdiff_t aLength, const Data *b, std::ptrdiff_t bLength, Compare &compare)
+    {
+      std::ptrdiff_t low = (k > bLength) ? k - bLength : 0;
+      std::ptrdiff_t high = (k < aLength) ? k : aLength;
+
+      while (low < high)
+      {
+        std::ptrdiff_t i = low + (high - low) / 2;
+        std::ptrdiff_t j = k - i;
+        if (j > 0 && !compare(b[j - 1], a[i]))
+        {
+          low = i + 1; // a[i] precedes b[j - 1] in the output: take more from a
+        }
+        else
+        {
+          high = i;
+        }
+      }
+      return low;
+    }
+
+    // Stable merge of two sorted ranges into an already constructed destination
+    template <typename Data, typename Compare>
+    void MergeInto(Data *a, Data *aEnd, Data *b, Data *bEnd, Data *destination, Compare &compare)
+    {
+      while (a < aEnd && b < bEnd)
+      {
+        if (compare(*b, *a))
+        {
+          *destination++ = std::move(*b++);
+        }
+        else
+        {
+          *destination++ = std::move(*a++);
+        }
+      }
+      destination = std::move(a, aEnd, destination);
+      std::move(b, bEnd, destination);
+    }
+
+  }
+
+  /* ************************************************************************** */
+
+  // Public sorting routines
+
+  template <typename Data, typename Compare>
+  void PdqSort(Data *begin, Data *end, Compare compare)
+  {
+    if (end - begin > 1)
+    {
+      detail::PdqSortLoop(begin, end, compare, detail::FloorLog2(end - begin), true);
+    }
+  }
+
+  template <typename Data, typename Compare>
+  void MergeSort(Data *begin, Data *end, Compare compare)
+  {
+    std::ptrdiff_t length = end - begin;
+    if (length <= detail::MergeSortRunLength)
+    {
+      InsertionSort(begin, end, compare); // Small ranges need no buffer
+      return;
+    }
+
+    Data *buffer = detail::AllocateBuffer<Data>((length + 1) / 2);
+    detail::MergeSortWithBuffer(begin, end, buffer, compare);
+    detail::DeallocateBuffer(buffer);
+  }
+
+  template <typename Data, typename Compare>
+  void HeapSort(Data *begin, Data *end, Compare compare)
+  {
+    std::ptrdiff_t length = end - begin;
+    if (length < 2)
+    {
+      return;
+    }
+
+    for (std::ptrdiff_t i = length / 2; i > 0; --i)
+    {
+      detail::SiftDown(begin, i - 1, length, compare); // Build a max-heap bottom-up
+    }
+
+    for (std::ptrdiff_t last = length - 1; last > 0; --last)
+    {
+      std::swap(begin[0], begin[last]); // Move the current maximum to its final place
+      detail::SiftDown(begin, 0, last, compare);
+    }
+  }
+
+  template <typename Data, typename Compare>
+  void InsertionSort(Data *begin, Data *end, Compare compare)
+  {
+    if (end - begin < 2)
+    {
+      return;
+    }
+
+    for (Data *current = begin + 1; current < end; ++current)
+    {
+      Data *hole = current;
+      if (compare(*hole, *(hole - 1)))
+      {
+        Data value = std::move(*hole); // Element to be inserted in the right position
+        do
+        {
+          *hole = std::move(*(hole - 1)); // Shift greater elements to the right
+          --hole;
+        } while (hole != begin && compare(value, *(hole - 1)));
+        *hole = std::move(value);
+      }
+    }
+  }
+
+  template <typename Data, typename Compare>
+  bool IsSorted(const Data *begin, const Data *end, Compare compare)
+  {
+    for (const Data *current = begin + 1; current < end; ++current)
+    {
+      if (compare(*current, *(current - 1)))
+      {
+        return false; // Found a descent
+      }
+    }
+    return true;
+  }
+
+  template <typename Data>
+  Data *Unique(Data *begin, Data *end)
+  {
+    if (begin == end)
+    {
+      return end;
+    }
+
+    Data *last = begin; // Last kept element
+    for (Data *current = begin + 1; current < end; ++current)
+    {
+      if (!(*current == *last))
+      {
+        ++last;
+        if (last != current)
+        {
+          *last = std::move(*current); // Close the gap left by the skipped duplicates
+        }
+      }
+    }
+    return last + 1;
+  }
+
+  template <typename Data, typename Compare>
+  Data *Unique(Data *begin, Data *end, Compare compare)
+  {
+    if constexpr (NaturalOrder<Data, Compare>)
+    {
+      return Unique(begin, end);
+    }
+    else
+    {
+      if (begin == end)
+      {
+        return end;
+      }
+
+      Data *last = begin; // Last kept element
+      for (Data *current = begin + 1; current < end; ++current)
+      {
+        if (compare(*last, *current)) // Sorted: an element not after the kept one is equivalent to it
+        {
+          ++last;
+          if (last != current)
+          {
+            *last = std::move(*current);
+          }
+        }
+      }
+      return last + 1;
+    }
+  }
+
+  template <typename Data, typename Compare>
+  bool Equivalent(const Data &first, const Data &second, const Compare &compare)
+  {
+    if constexpr (NaturalOrder<Data, Compare>)
+    {
+      return first == second;
+    }
+    else
+    {
+      return !compare(first, second) && !compare(second, first);
+    }
+  }
+
+  template <typename Data, typename Compare>
+  void MergeRuns(Data *begin, Data *middle, Data *end, Compare compare)
+  {
+    if (begin == middle || middle == end || !compare(*middle, *(middle - 1)))
+    {
+      return; // Nothing to merge
+    }
+
+    Data *buffer = detail::AllocateBuffer<Data>(middle - begin);
+    detail::MergeWithBuffer(begin, middle, end, buffer, compare);
+    detail::DeallocateBuffer(buffer);
+  }
+
+  template <typename Data, typename Compare>
+  void ParallelSort(Data *begin, Data *end, ulong threads, Compare compare, ulong threshold)
+  {
+    std::ptrdiff_t length = end - begin;
+    if (threads == 0)
+    {
+      threads = std::thread::hardware_concurrency();
+    }
+
+    if (threads < 2 || length < 2 || static_cast<ulong>(length) < threshold)
+    {
+      PdqSort(begin, end, compare); // Not worth the threads
+      return;
+    }
+
+    std::ptrdiff_t runs = (threads < static_cast<ulong>(length)) ? static_cast<std::ptrdiff_t>(threads) : length; // At most one run per element
+
+    std::unique_ptr<std::ptrdiff_t[]> bounds = std::make_unique<std::ptrdiff_t[]>(runs + 1);
+    for (std::ptrdiff_t r = 0; r <= runs; r++)
+    {
+      bounds[r] = length * r / runs; // Run r covers [bounds[r], bounds[r + 1])
+    }
+
+    std::unique_ptr<bool[]> moved = std::make_unique<bool[]>(runs); // Per run: constructed in the buffer (all false)
+    ThreadPool pool(threads);
+    Data *buffer = detail::AllocateBuffer<Data>(length);
+
+    try
+    {
+      // Sort one run per thread, then move it into the buffer (constructing the buffer in parallel)
+      for (std::ptrdiff_t r = 0; r < runs; r++)
+      {
+        Data *runBegin = begin + bounds[r];
+        Data *runEnd = begin + bounds[r + 1];
+        Data *runBuffer = buffer + bounds[r];
+        pool.Submit([runBegin, runEnd, runBuffer, compare, &moved, r]()
+                    {
+                      PdqSort(runBegin, runEnd, compare);
+                      std::uninitialized_move(runBegin, runEnd, runBuffer); // Destroys its part on failure
+                      moved[r] = true; });
+      }
+      pool.Wait();
+
+      // Merge rounds ping-pong between the buffer and the array
+      Data *source = buffer;
+      Data *destination = begin;
+      for (std::ptrdiff_t width = 1; width < runs; width *= 2)
+      {
+        std::ptrdiff_t pairs = (runs + 2 * width - 1) / (2 * width);
+        std::ptrdiff_t piecesPerPair = static_cast<std::ptrdiff_t>(threads) / pairs;
+        if (piecesPerPair < 1)
+        {
+          piecesPerPair = 1;
+        }
+
+        // Split points of one pair, reused by the next: the pieces take theirs by value
+        std::unique_ptr<std::ptrdiff_t[]> splits = std::make_unique<std::ptrdiff_t[]>(piecesPerPair + 1);
+
+        for (std::ptrdiff_t first = 0; first < runs; first += 2 * width)
+        {
+          std::ptrdiff_t low = bounds[first];
+          std::ptrdiff_t middle = bounds[(first + width < runs) ? first + width : runs];
+          std::ptrdiff_t high = bounds[(first + 2 * width < runs) ? first + 2 * width : runs];
+
+          // Split the output of this merge into equal pieces; co-ranking finds where each piece
+          // starts in the first run. Every split of the pair is taken before any of its pieces is
+          // submitted: a running piece moves elements out of both runs
+          Data *a = source + low;
+          Data *b = source + middle;
+          for (std::ptrdiff_t piece = 0; piece <= piecesPerPair; piece++)
+          {
+            splits[piece] = detail::CoRank((high - low) * piece / piecesPerPair, a, middle - low, b, high - middle, compare);
+          }
+
+          for (std::ptrdiff_t piece = 0; piece < piecesPerPair; piece++)
+          {
+            std::ptrdiff_t outBegin = (high - low) * piece / piecesPerPair;
+            std::ptrdiff_t outEnd = (high - low) * (piece + 1) / piecesPerPair;
+            std::ptrdiff_t aBegin = splits[piece];
+            std::ptrdiff_t aEnd = splits[piece + 1];
+            pool.Submit([a, b, destination, low, outBegin, outEnd, aBegin, aEnd, compare]() mutable
+                        { detail::MergeInto(a + aBegin, a + aEnd, b + (outBegin - aBegin), b + (outEnd - aEnd), destination + low + outBegin, compare); });
+          }
+        }
+        pool.Wait();
+        std::swap(source, destination);
+      }
+
+      // The sorted data ends up wherever the last round wrote it
+      if (source == buffer)
+      {
+        for (std::ptrdiff_t r = 0; r < runs; r++)
+        {
+          Data *from = buffer + bounds[r];
+          Data *fromEnd = buffer + bounds[r + 1];
+          Data *to = begin + bounds[r];
+          pool.Submit([from, fromEnd, to]()
+                      { std::move(from, fromEnd, to); });
+        }
+        pool.Wait();
+      }
+    }
+    catch (...)
+    {
+      // A comparison, a move or a Submit threw: let the tasks already queued finish
+      // (Wait reports only the first failure), then destroy what the first phase
+      // built in the buffer. After that phase every buffer slot is alive, and the
+      // array always keeps all its slots alive, some of them moved-from
+      try
+      {
+        pool.Wait();
+      }
+      catch (...)
+      {
+        // Superseded by the exception being handled
+      }
+      for (std::ptrdiff_t r = 0; r < runs; r++)
+      {
+        if (moved[r])
+        {
+          std::destroy(buffer + bounds[r], buffer + bounds[r + 1]);
+        }
+      }
+      detail::DeallocateBuffer(buffer);
+      throw;
+    }
+
+    std::destroy_n(buffer, length);
+    detail::DeallocateBuffer(buffer);
+  }
+
+  /* ************************************************************************** */
+
+}
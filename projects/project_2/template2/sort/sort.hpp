@@ -0,0 +1,104 @@
+#ifndef SORT_HPP
+#define SORT_HPP
+
+/* ************************************************************************** */
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+#include "sys/types.h"
+
+#include "../thread/threadpool.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Sorting engine shared by the array-backed containers.
+  // Every routine works on the half-open range [begin, end) and orders it by
+  // the strict weak ordering given by compare (std::less<Data> by default).
+
+  // Pattern-defeating quicksort: O(n log n) worst case, linear on sorted,
+  // reversed and all-equal inputs, not stable
+  template <typename Data, typename Compare = std::less<Data>>
+  void PdqSort(Data *, Data *, Compare = Compare());
+
+  // Merge sort: O(n log n) and stable, needs a buffer of n/2 elements
+  template <typename Data, typename Compare = std::less<Data>>
+  void MergeSort(Data *, Data *, Compare = Compare());
+
+  // Heapsort: O(n log n) worst case with no extra memory, not stable
+  template <typename Data, typename Compare = std::less<Data>>
+  void HeapSort(Data *, Data *, Compare = Compare());
+
+  // Insertion sort: O(n^2), stable, fastest on tiny or nearly sorted ranges
+  template <typename Data, typename Compare = std::less<Data>>
+  void InsertionSort(Data *, Data *, Compare = Compare());
+
+  // Merge the sorted ranges [begin, middle) and [middle, end) in place using
+  // raw storage for the left run (stable)
+  template <typename Data, typename Compare = std::less<Data>>
+  void MergeRuns(Data *, Data *, Data *, Compare = Compare());
+
+  // Whether [begin, end) is in non-descending order by compare
+  template <typename Data, typename Compare = std::less<Data>>
+  bool IsSorted(const Data *, const Data *, Compare = Compare());
+
+  // Keep the first of every run of equal (==) adjacent elements, moving the
+  // kept ones to the front; returns the new end, the slots after it are left
+  // moved-from (one linear pass: sorting first removes every duplicate)
+  template <typename Data>
+  Data *Unique(Data *, Data *);
+
+  // Same, keeping the first of every run of equivalent adjacent elements
+  template <typename Data, typename Compare>
+  Data *Unique(Data *, Data *, Compare);
+
+  // Whether compare is std::less or std::greater on Data: equivalence is
+  // then plain ==, one comparison instead of two
+  template <typename Data, typename Compare>
+  constexpr bool NaturalOrder = std::equality_comparable<Data> &&
+                                (std::is_same_v<Compare, std::less<Data>> || std::is_same_v<Compare, std::less<>> ||
+                                 std::is_same_v<Compare, std::greater<Data>> || std::is_same_v<Compare, std::greater<>>);
+
+  // Equivalence under the strict weak ordering: neither element comes first
+  template <typename Data, typename Compare>
+  bool Equivalent(const Data &, const Data &, const Compare &);
+
+  // Ordering by a key extracted from the elements (a member pointer or any
+  // callable), so records are ordered by one field without comparing them
+  // whole. Empty projections and comparators take no space.
+  template <typename Projection, typename Compare = std::less<>>
+  struct ProjectedOrder
+  {
+    [[no_unique_address]] Projection projection;
+    [[no_unique_address]] Compare compare = Compare();
+
+    template <typename Data>
+    bool operator()(const Data &first, const Data &second) const
+    {
+      return compare(std::invoke(projection, first), std::invoke(projection, second));
+    }
+  };
+
+  // Input size below which ParallelSort does not pay for its threads
+  constexpr ulong ParallelSortThreshold = 1UL << 16;
+
+  // Parallel merge sort: one pdqsort run per thread, then merge rounds split
+  // by merge path so every thread has work until the end (not stable).
+  // Arguments: range, thread count (0 means one per hardware thread),
+  // comparator, size below which the sequential PdqSort is used instead.
+  template <typename Data, typename Compare = std::less<Data>>
+  void ParallelSort(Data *, Data *, ulong, Compare = Compare(), ulong = ParallelSortThreshold);
+
+  /* ************************************************************************** */
+
+}
+
+#include "sort.cpp" // Include implementation file
+
+#endif
@@ -0,0 +1,120 @@
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  // Specific constructor
+
+  inline ThreadPool::ThreadPool(const ulong threads)
+  {
+    workerCount = threads;
+    if (workerCount == 0)
+    {
+      workerCount = std::thread::hardware_concurrency();
+      if (workerCount == 0)
+      {
+        workerCount = 1; // Hardware concurrency is unknown on this platform
+      }
+    }
+
+    workers = std::make_unique<std::thread[]>(workerCount);
+    for (ulong i = 0; i < workerCount; i++)
+    {
+      workers[i] = std::thread([this]()
+                               { WorkerLoop(); });
+    }
+  }
+
+  // Destructor
+
+  inline ThreadPool::~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    taskAvailable.notify_all();
+
+    for (ulong i = 0; i < workerCount; i++)
+    {
+      workers[i].join();
+    }
+  }
+
+  // Specific member functions
+
+  inline void ThreadPool::Submit(std::function<void()> task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      tasks.push(std::move(task));
+      pending++;
+    }
+    taskAvailable.notify_one();
+  }
+
+  inline void ThreadPool::Wait()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    allDone.wait(lock, [this]()
+                 { return pending == 0; });
+
+    if (failure)
+    {
+      std::exception_ptr toRethrow = failure;
+      failure = nullptr; // The pool stays usable after reporting the error
+      std::rethrow_exception(toRethrow);
+    }
+  }
+
+  inline ulong ThreadPool::Workers() const noexcept
+  {
+    return workerCount;
+  }
+
+  // Auxiliary functions
+
+  inline void ThreadPool::WorkerLoop()
+  {
+    while (true)
+    {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        taskAvailable.wait(lock, [this]()
+                           { return stopping || !tasks.empty(); });
+        if (tasks.empty())
+        {
+          return; // Stopping and nothing left to run
+        }
+        task = std::move(tasks.front());
+        tasks.pop();
+      }
+
+      std::exception_ptr error;
+      try
+      {
+        task(); // Run outside the lock
+      }
+      catch (...)
+      {
+        error = std::current_exception(); // A throwing task must not kill the worker
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (error && !failure)
+        {
+          failure = error;
+        }
+        if (--pending == 0)
+        {
+          allDone.notify_all();
+        }
+      }
+    }
+  }
+
+  /* ************************************************************************** */
+
+}
@@ -0,0 +1,91 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+/* ************************************************************************** */
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "sys/types.h"
+
+/* ************************************************************************** */
+
+namespace lasd
+{
+
+  /* ************************************************************************** */
+
+  class ThreadPool
+  {
+    // Fixed set of worker threads running submitted tasks in FIFO order
+    // (internal support for the parallel algorithms)
+
+  private:
+    // ...
+
+  protected:
+    std::unique_ptr<std::thread[]> workers; // Worker threads
+    ulong workerCount = 0;
+
+    std::queue<std::function<void()>> tasks; // Tasks not yet started
+    ulong pending = 0;                       // Tasks submitted and not yet finished
+    bool stopping = false;                   // Set by the destructor to release the workers
+    std::exception_ptr failure;              // First exception thrown by a task (rethrown by Wait)
+
+    std::mutex mutex;
+    std::condition_variable taskAvailable; // Signalled when a task is queued or the pool stops
+    std::condition_variable allDone;       // Signalled when pending drops to zero
+
+  public:
+    // Specific constructor
+    ThreadPool(const ulong); // A pool with the given number of workers (0 means one per hardware thread)
+
+    /* ************************************************************************ */
+
+    // Copy constructor
+    ThreadPool(const ThreadPool &) = delete;
+
+    // Move constructor
+    ThreadPool(ThreadPool &&) = delete;
+
+    /* ************************************************************************ */
+
+    // Destructor
+    ~ThreadPool(); // Finishes the queued tasks, then joins the workers
+
+    /* ************************************************************************ */
+
+    // Copy assignment
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Move assignment
+    ThreadPool &operator=(ThreadPool &&) = delete;
+
+    /* ************************************************************************ */
+
+    // Specific member functions
+
+    void Submit(std::function<void()>); // Queue a task for the workers
+
+    void Wait(); // Block until every submitted task has finished (rethrows the first task exception)
+
+    inline ulong Workers() const noexcept; // Number of worker threads
+
+  protected:
+    // Auxiliary functions
+
+    void WorkerLoop(); // Body run by each worker thread
+  };
+
+  /* ************************************************************************** */
+
+}
+
+#include "threadpool.cpp" // Include implementation file
+
+#endif
@@ -1,4 +1,8 @@
+#include <cstring>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 
 namespace lasd
 {
@@ -10,28 +14,58 @@ namespace lasd
     template <typename Data>
     Vector<Data>::Vector(const ulong newSize)
     {
+        elements = Allocate(newSize);
+        try
+        {
+            std::uninitialized_value_construct_n(elements, newSize); // Construct default-initialized elements
+        }
+        catch (...)
+        {
+            Deallocate(elements);
+            throw;
+        }
         size = newSize;
-        elements = new Data[newSize](); // Allocate array with default-initialized elements
+        capacity = newSize;
     }
 
     template <typename Data>
-    Vector<Data>::Vector(const TraversableContainer<Data> &traversableC) : Vector(traversableC.Size())
+    Vector<Data>::Vector(const TraversableContainer<Data> &traversableC)
     {
-        ulong i = 0;
-        traversableC.Traverse([this, &i](const Data &data)
-                              {
-            elements[i] = data;  // Copy each element from the traversable container
-            i++; });
+        elements = Allocate(traversableC.Size());
+        capacity = traversableC.Size();
+        try
+        {
+            traversableC.Traverse([this](const Data &data)
+                                  {
+                new (elements + size) Data(data);  // Copy-construct each element in place
+                size++; }); // Size only counts constructed elements
+        }
+        catch (...)
+        {
+            std::destroy_n(elements, size); // No destructor runs for a constructor that throws
+            Deallocate(elements);
+            throw;
+        }
     }
 
     template <typename Data>
-    Vector<Data>::Vector(MappableContainer<Data> &&mappableC) noexcept : Vector(mappableC.Size())
+    Vector<Data>::Vector(MappableContainer<Data> &&mappableC)
     {
-        ulong i = 0;
-        mappableC.Map([this, &i](Data &data)
-                      {
-            elements[i] = std::move(data);  // Move each element from the mappable container
-            i++; });
+        elements = Allocate(mappableC.Size());
+        capacity = mappableC.Size();
+        try
+        {
+            mappableC.Map([this](Data &data)
+                          {
+                new (elements + size) Data(std::move(data));  // Move-construct each element in place
+                size++; }); // Size only counts constructed elements
+        }
+        catch (...)
+        {
+            std::destroy_n(elements, size); // No destructor runs for a constructor that throws
+            Deallocate(elements);
+            throw;
+        }
     }
 
     // Vector copy & move constructors
@@ -39,18 +73,25 @@ namespace lasd
     template <typename Data>
     Vector<Data>::Vector(const Vector<Data> &vectorToCopy)
     {
-        size = vectorToCopy.size;
-        elements = new Data[size]; // Allocate new array
-        for (ulong i = 0; i < size; i++)
+        elements = Allocate(vectorToCopy.size); // A copy does not inherit the spare capacity of the original
+        try
+        {
+            std::uninitialized_copy_n(vectorToCopy.elements, vectorToCopy.size, elements); // memmove for trivially copyable data
+        }
+        catch (...)
         {
-            elements[i] = vectorToCopy.elements[i]; // Copy each element
+            Deallocate(elements);
+            throw;
         }
+        size = vectorToCopy.size;
+        capacity = size;
     }
 
     template <typename Data>
     Vector<Data>::Vector(Vector<Data> &&vectorToMove) noexcept
     {
         std::swap(size, vectorToMove.size); // Take ownership of other vector's resources
+        std::swap(capacity, vectorToMove.capacity);
         std::swap(elements, vectorToMove.elements);
     }
 
@@ -59,7 +100,8 @@ namespace lasd
     template <typename Data>
     Vector<Data>::~Vector()
     {
-        delete[] elements; // Free the allocated array
+        std::destroy_n(elements, size); // Destroy the live elements only
+        Deallocate(elements);           // Free the raw storage
     }
 
     // Vector copy & move assignments
@@ -69,14 +111,10 @@ namespace lasd
     {
         if (this != &vectorToAssign)
         {
-            size = vectorToAssign.size;
-            Data *newElements = new Data[size]; // Create new array
-            for (ulong i = 0; i < size; i++)
-            {
-                newElements[i] = vectorToAssign.elements[i]; // Copy elements
-            }
-            delete[] elements;      // Free old array
-            elements = newElements; // Point to new array
+            Vector<Data> copy(vectorToAssign); // Build the copy first so a throwing element leaves this vector intact
+            std::swap(size, copy.size);
+            std::swap(capacity, copy.capacity);
+            std::swap(elements, copy.elements); // Old storage is released by the temporary
         }
         return *this;
     }
@@ -85,6 +123,7 @@ namespace lasd
     Vector<Data> &Vector<Data>::operator=(Vector<Data> &&vectorToAssign) noexcept
     {
         std::swap(size, vectorToAssign.size); // Exchange resources with other vector
+        std::swap(capacity, vectorToAssign.capacity);
         std::swap(elements, vectorToAssign.elements);
         return *this;
     }
@@ -180,6 +219,207 @@ namespace lasd
         return elements[size - 1]; // Return mutable reference to last element
     }
 
+    // Vector testable method
+
+    template <typename Data>
+    bool Vector<Data>::Exists(const Data &data) const noexcept
+    {
+        if constexpr (SimdArithmetic<Data>)
+        {
+            return SimdFind<Data>(elements, elements + size, data);
+        }
+        else
+        {
+            for (ulong i = 0; i < size; i++)
+            {
+                if (elements[i] == data)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    // Vector traversal and mapping methods
+
+    template <typename Data>
+    void Vector<Data>::PreOrderTraverse(TraverseFun fun) const
+    {
+        for (ulong i = 0; i < size; i++)
+        {
+            fun(elements[i]); // Front to back
+        }
+    }
+
+    template <typename Data>
+    void Vector<Data>::PostOrderTraverse(TraverseFun fun) const
+    {
+        for (ulong i = size; i > 0; i--)
+        {
+            fun(elements[i - 1]); // Back to front
+        }
+    }
+
+    template <typename Data>
+    bool Vector<Data>::TraverseWhile(TraverseWhileFun fun) const
+    {
+        for (ulong i = 0; i < size; i++)
+        {
+            if (!fun(elements[i]))
+            {
+                return false; // Stopped: the remaining elements are never touched
+            }
+        }
+        return true;
+    }
+
+    template <typename Data>
+    void Vector<Data>::PreOrderMap(MapFun fun)
+    {
+        for (ulong i = 0; i < size; i++)
+        {
+            fun(elements[i]); // Front to back
+        }
+    }
+
+    template <typename Data>
+    void Vector<Data>::PostOrderMap(MapFun fun)
+    {
+        for (ulong i = size; i > 0; i--)
+        {
+            fun(elements[i - 1]); // Back to front
+        }
+    }
+
+    template <typename Data>
+    template <typename Fun>
+    void Vector<Data>::ForEach(Fun &&fun) const
+    {
+        const Data *data = elements;
+        for (ulong i = 0, count = size; i < count; i++)
+        {
+            fun(data[i]); // Plain loop: the callable inlines and the loop can vectorize
+        }
+    }
+
+    template <typename Data>
+    template <typename Accumulator, typename Fun>
+    Accumulator Vector<Data>::Reduce(Fun &&fun, Accumulator accumulator) const
+    {
+        const Data *data = elements;
+        for (ulong i = 0, count = size; i < count; i++)
+        {
+            accumulator = fun(data[i], accumulator);
+        }
+        return accumulator;
+    }
+
+    template <typename Data>
+    template <typename Fun>
+    void Vector<Data>::MapInPlace(Fun &&fun)
+    {
+        Data *data = elements;
+        for (ulong i = 0, count = size; i < count; i++)
+        {
+            fun(data[i]);
+        }
+    }
+
+    // Vector vectorized kernels
+
+    template <typename Data>
+    Data Vector<Data>::Sum() const noexcept requires SimdArithmetic<Data>
+    {
+        return SimdSum<Data>(elements, elements + size);
+    }
+
+    template <typename Data>
+    Data Vector<Data>::Minimum() const requires SimdArithmetic<Data>
+    {
+        if (size == 0)
+        {
+            throw std::length_error("Vector: Empty container");
+        }
+        return SimdMinimum<Data>(elements, elements + size);
+    }
+
+    template <typename Data>
+    Data Vector<Data>::Maximum() const requires SimdArithmetic<Data>
+    {
+        if (size == 0)
+        {
+            throw std::length_error("Vector: Empty container");
+        }
+        return SimdMaximum<Data>(elements, elements + size);
+    }
+
+    template <typename Data>
+    ulong Vector<Data>::Count(const Data &data) const noexcept requires SimdArithmetic<Data>
+    {
+        return SimdCount<Data>(elements, elements + size, data);
+    }
+
+    template <typename Data>
+    void Vector<Data>::Scale(const Data &factor) noexcept requires SimdArithmetic<Data>
+    {
+        SimdScale<Data>(elements, elements + size, factor);
+    }
+
+    template <typename Data>
+    void Vector<Data>::Add(const Data &addend) noexcept requires SimdArithmetic<Data>
+    {
+        SimdAdd<Data>(elements, elements + size, addend);
+    }
+
+    template <typename Data>
+    void Vector<Data>::Clamp(const Data &low, const Data &high) requires SimdArithmetic<Data>
+    {
+        if (high < low)
+        {
+            throw std::invalid_argument("Vector: Invalid clamp bounds");
+        }
+        SimdClamp<Data>(elements, elements + size, low, high);
+    }
+
+    // Vector iterators
+
+    template <typename Data>
+    typename Vector<Data>::Iterator Vector<Data>::begin() noexcept
+    {
+        return elements;
+    }
+
+    template <typename Data>
+    typename Vector<Data>::Iterator Vector<Data>::end() noexcept
+    {
+        return elements + size; // nullptr + 0 on an empty vector, still a valid empty range
+    }
+
+    template <typename Data>
+    typename Vector<Data>::ConstIterator Vector<Data>::begin() const noexcept
+    {
+        return elements;
+    }
+
+    template <typename Data>
+    typename Vector<Data>::ConstIterator Vector<Data>::end() const noexcept
+    {
+        return elements + size;
+    }
+
+    template <typename Data>
+    typename Vector<Data>::ConstIterator Vector<Data>::cbegin() const noexcept
+    {
+        return elements;
+    }
+
+    template <typename Data>
+    typename Vector<Data>::ConstIterator Vector<Data>::cend() const noexcept
+    {
+        return elements + size;
+    }
+
     // Vector resizable methods
 
     template <typename Data>
@@ -189,19 +429,31 @@ namespace lasd
         {
             Clear(); // Special case: resize to 0 means clear
         }
-        else if (size != newSize)
+        else if (newSize > size)
         {
-            Data *newElements = new Data[newSize]();           // Allocate new array
-            ulong minSize = (size < newSize) ? size : newSize; // Determine how many elements to copy
-
-            for (ulong i = 0; i < minSize; i++)
+            if constexpr (std::is_default_constructible_v<Data>)
+            {
+                if (newSize > capacity)
+                {
+                    Reallocate(GrowthCapacity(newSize)); // Grow geometrically so repeated growth is amortized
+                }
+                std::uninitialized_value_construct(elements + size, elements + newSize); // Only the new slots are constructed
+                size = newSize;
+            }
+            else
             {
-                newElements[i] = std::move(elements[i]); // Move existing elements to new array
+                throw std::logic_error("Vector: Growing requires a default constructible type");
             }
+        }
+        else if (newSize < size)
+        {
+            std::destroy(elements + newSize, elements + size); // Dropped slots go back to raw storage
+            size = newSize;
 
-            delete[] elements;      // Free old array
-            elements = newElements; // Point to new array
-            size = newSize;         // Update size
+            if (newSize <= capacity / 4)
+            {
+                Reallocate(2 * newSize); // Give memory back once the vector is mostly empty
+            }
         }
     }
 
@@ -210,76 +462,233 @@ namespace lasd
     template <typename Data>
     void Vector<Data>::Clear()
     {
-        delete[] elements; // Free array
+        std::destroy_n(elements, size); // Destroy the live elements
+        Deallocate(elements);           // Free the raw storage
         elements = nullptr;
         size = 0;
+        capacity = 0;
     }
 
-    /* ************************************************************************** */
-
-    // SortableVector specific constructors
+    // Vector capacity methods
 
     template <typename Data>
-    SortableVector<Data>::SortableVector(const ulong newSize) : Vector<Data>(newSize) {}
+    inline ulong Vector<Data>::Capacity() const noexcept
+    {
+        return capacity;
+    }
 
     template <typename Data>
-    SortableVector<Data>::SortableVector(const TraversableContainer<Data> &traversableC) : Vector<Data>(traversableC) {}
+    void Vector<Data>::Reserve(const ulong newCapacity)
+    {
+        if (newCapacity > capacity)
+        {
+            Reallocate(newCapacity); // Never shrinks: Reserve only guarantees room
+        }
+    }
 
     template <typename Data>
-    SortableVector<Data>::SortableVector(MappableContainer<Data> &&mappableC) noexcept : Vector<Data>(std::move(mappableC)) {}
-
-    // SortableVector copy & move constructors
+    void Vector<Data>::ShrinkToFit()
+    {
+        if (size == 0)
+        {
+            Clear(); // Nothing to keep
+        }
+        else if (capacity > size)
+        {
+            Reallocate(size);
+        }
+    }
 
     template <typename Data>
-    SortableVector<Data>::SortableVector(const SortableVector<Data> &vectorToCopy) : Vector<Data>(vectorToCopy) {}
+    void Vector<Data>::PushBack(const Data &data)
+    {
+        if (size == capacity)
+        {
+            Data copy(data); // The argument may live in the storage about to be relocated
+            Reallocate(GrowthCapacity(size + 1));
+            new (elements + size) Data(std::move(copy));
+        }
+        else
+        {
+            new (elements + size) Data(data); // Construct directly in the spare slot
+        }
+        size++;
+    }
 
     template <typename Data>
-    SortableVector<Data>::SortableVector(SortableVector<Data> &&vectorToMove) noexcept : Vector<Data>(std::move(vectorToMove)) {}
+    void Vector<Data>::PushBack(Data &&data)
+    {
+        if (size == capacity)
+        {
+            Data moved(std::move(data)); // The argument may live in the storage about to be relocated
+            Reallocate(GrowthCapacity(size + 1));
+            new (elements + size) Data(std::move(moved));
+        }
+        else
+        {
+            new (elements + size) Data(std::move(data)); // Construct directly in the spare slot
+        }
+        size++;
+    }
 
-    // SortableVector copy & move assignments
+    // Vector auxiliary methods
 
     template <typename Data>
-    SortableVector<Data> &SortableVector<Data>::operator=(const SortableVector<Data> &vectorToAssign)
+    ulong Vector<Data>::GrowthCapacity(const ulong required) const noexcept
     {
-        Vector<Data>::operator=(vectorToAssign); // Delegate to base class assignment
-        return *this;
+        ulong doubled = 2 * capacity;
+        return (doubled > required) ? doubled : required; // Double, unless a larger size was explicitly asked for
     }
 
     template <typename Data>
-    SortableVector<Data> &SortableVector<Data>::operator=(SortableVector<Data> &&vectorToAssign) noexcept
+    void Vector<Data>::Reallocate(const ulong newCapacity)
     {
-        Vector<Data>::operator=(std::move(vectorToAssign)); // Delegate to base class move assignment
-        return *this;
+        Data *newElements = Allocate(newCapacity); // Raw storage: nothing is constructed yet
+        try
+        {
+            Relocate(elements, size, newElements); // Caller guarantees size <= newCapacity
+        }
+        catch (...)
+        {
+            Deallocate(newElements); // A failed copy leaves nothing constructed there and the vector as it was
+            throw;
+        }
+        Deallocate(elements);
+        elements = newElements;
+        capacity = newCapacity;
     }
 
-    // SortableVector sorting methods
-
     template <typename Data>
-    void SortableVector<Data>::Sort()
+    Data *Vector<Data>::Allocate(const ulong count)
     {
-        if (size > 1)
+        if (count == 0)
         {
-            InsertionSort(this->elements, size); // Use insertion sort algorithm
+            return nullptr;
         }
+        return static_cast<Data *>(::operator new(count * sizeof(Data), std::align_val_t(alignof(Data))));
     }
 
     template <typename Data>
-    void SortableVector<Data>::InsertionSort(Data *array, ulong length)
+    void Vector<Data>::Deallocate(Data *storage) noexcept
     {
-        for (ulong i = 1; i < length; i++)
+        if (storage != nullptr)
         {
-            Data key = array[i]; // Element to be inserted in the right position
-            ulong j = i;
+            ::operator delete(storage, std::align_val_t(alignof(Data)));
+        }
+    }
 
-            // Shift elements greater than key to the right
-            while (j > 0 && array[j - 1] > key)
+    template <typename Data>
+    void Vector<Data>::Relocate(Data *source, const ulong count, Data *destination)
+    {
+        if constexpr (std::is_trivially_copyable_v<Data>)
+        {
+            if (count > 0)
             {
-                array[j] = array[j - 1];
-                j--;
+                std::memcpy(static_cast<void *>(destination), static_cast<const void *>(source), count * sizeof(Data)); // Bitwise relocation
             }
-
-            array[j] = key; // Insert key at the correct position
         }
+        else
+        {
+            if constexpr (std::is_nothrow_move_constructible_v<Data> || !std::is_copy_constructible_v<Data>)
+            {
+                std::uninitialized_move_n(source, count, destination);
+            }
+            else
+            {
+                std::uninitialized_copy_n(source, count, destination); // Keep the source intact if a copy throws
+            }
+            std::destroy_n(source, count);
+        }
+    }
+
+    /* ************************************************************************** */
+
+    // SortableVector specific constructors
+
+    template <typename Data, typename Compare>
+    SortableVector<Data, Compare>::SortableVector(const Compare &order) : compare(order) {}
+
+    template <typename Data, typename Compare>
+    SortableVector<Data, Compare>::SortableVector(const ulong newSize, const Compare &order) : Vector<Data>(newSize), compare(order) {}
+
+    template <typename Data, typename Compare>
+    SortableVector<Data, Compare>::SortableVector(const TraversableContainer<Data> &traversableC, const Compare &order) : Vector<Data>(traversableC), compare(order) {}
+
+    template <typename Data, typename Compare>
+    SortableVector<Data, Compare>::SortableVector(MappableContainer<Data> &&mappableC, const Compare &order) : Vector<Data>(std::move(mappableC)), compare(order) {}
+
+    // SortableVector copy & move constructors
+
+    template <typename Data, typename Compare>
+    SortableVector<Data, Compare>::SortableVector(const SortableVector<Data, Compare> &vectorToCopy) : Vector<Data>(vectorToCopy), compare(vectorToCopy.compare) {}
+
+    template <typename Data, typename Compare>
+    SortableVector<Data, Compare>::SortableVector(SortableVector<Data, Compare> &&vectorToMove) noexcept : Vector<Data>(std::move(vectorToMove)), compare(vectorToMove.compare) {}
+
+    // SortableVector copy & move assignments
+
+    template <typename Data, typename Compare>
+    SortableVector<Data, Compare> &SortableVector<Data, Compare>::operator=(const SortableVector<Data, Compare> &vectorToAssign)
+    {
+        Vector<Data>::operator=(vectorToAssign); // Delegate to base class assignment
+        compare = vectorToAssign.compare;
+        return *this;
+    }
+
+    template <typename Data, typename Compare>
+    SortableVector<Data, Compare> &SortableVector<Data, Compare>::operator=(SortableVector<Data, Compare> &&vectorToAssign) noexcept
+    {
+        Vector<Data>::operator=(std::move(vectorToAssign)); // Delegate to base class move assignment
+        compare = vectorToAssign.compare; // Copied: the other vector stays usable
+        return *this;
+    }
+
+    // SortableVector sorting methods
+
+    template <typename Data, typename Compare>
+    Compare SortableVector<Data, Compare>::Comparator() const
+    {
+        return compare;
+    }
+
+    template <typename Data, typename Compare>
+    void SortableVector<Data, Compare>::Sort()
+    {
+        PdqSort(this->elements, this->elements + size, compare); // O(n log n), linear on already sorted data
+    }
+
+    template <typename Data, typename Compare>
+    template <typename Order>
+    void SortableVector<Data, Compare>::Sort(Order order)
+    {
+        PdqSort(this->elements, this->elements + size, order);
+    }
+
+    template <typename Data, typename Compare>
+    void SortableVector<Data, Compare>::StableSort()
+    {
+        MergeSort(this->elements, this->elements + size, compare);
+    }
+
+    template <typename Data, typename Compare>
+    template <typename Order>
+    void SortableVector<Data, Compare>::StableSort(Order order)
+    {
+        MergeSort(this->elements, this->elements + size, order);
+    }
+
+    template <typename Data, typename Compare>
+    void SortableVector<Data, Compare>::ParallelSort(const ulong threads, const ulong threshold)
+    {
+        lasd::ParallelSort(this->elements, this->elements + size, threads, compare, threshold);
+    }
+
+    template <typename Data, typename Compare>
+    template <typename Order>
+        requires std::is_invocable_r_v<bool, Order &, const Data &, const Data &>
+    void SortableVector<Data, Compare>::ParallelSort(const ulong threads, Order order, const ulong threshold)
+    {
+        lasd::ParallelSort(this->elements, this->elements + size, threads, order, threshold);
     }
 
     /* ************************************************************************** */
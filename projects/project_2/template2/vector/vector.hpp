@@ -3,7 +3,13 @@
 
 /* ************************************************************************** */
 
+#include <type_traits>
+
+/* ************************************************************************** */
+
 #include "../container/linear.hpp"
+#include "../sort/sort.hpp"
+#include "../simd/simd.hpp"
 
 /* ************************************************************************** */
 
@@ -24,9 +30,9 @@ namespace lasd
   protected:
     using Container::size; // Inherit size member from Container base class
 
-    Data *elements = nullptr; // Pointer to the dynamically allocated array of elements
+    Data *elements = nullptr; // Raw storage: only the first size slots hold constructed elements
 
-    // ...
+    ulong capacity = 0; // Number of allocated slots (always >= size)
 
   public:
     // Default constructor
@@ -35,9 +41,9 @@ namespace lasd
     /* ************************************************************************ */
 
     // Specific constructors
-    Vector(const ulong);                         // A vector with a given initial dimension
-    Vector(const TraversableContainer<Data> &);  // A vector obtained from a TraversableContainer
-    Vector(MappableContainer<Data> &&) noexcept; // A vector obtained from a MappableContainer
+    Vector(const ulong);                        // A vector with a given initial dimension
+    Vector(const TraversableContainer<Data> &); // A vector obtained from a TraversableContainer
+    Vector(MappableContainer<Data> &&);         // A vector obtained from a MappableContainer (a move may throw)
 
     /* ************************************************************************ */
 
@@ -88,9 +94,73 @@ namespace lasd
 
     /* ************************************************************************ */
 
+    // Specific member function (inherited from TestableContainer)
+
+    bool Exists(const Data &) const noexcept override; // Scan the array (vectorized for SimdArithmetic Data)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (inherited from PreOrder/PostOrder Traversable/Mappable containers)
+
+    using typename TraversableContainer<Data>::TraverseFun;
+    using typename MappableContainer<Data>::MapFun;
+
+    void PreOrderTraverse(TraverseFun) const override; // Loop over the array, no per-element virtual access
+    void PostOrderTraverse(TraverseFun) const override;
+    void PreOrderMap(MapFun) override;
+    void PostOrderMap(MapFun) override;
+
+    using typename TraversableContainer<Data>::TraverseWhileFun;
+
+    bool TraverseWhile(TraverseWhileFun) const override; // Loop over the array until the function returns false
+
+    /* ************************************************************************ */
+
+    // Specific member functions (template fast paths, hiding the type-erased ones)
+
+    template <typename Fun>
+    void ForEach(Fun &&) const; // Apply callable to each element, front to back
+
+    template <typename Accumulator, typename Fun>
+    Accumulator Reduce(Fun &&, Accumulator) const; // Fold with any callable, front to back
+
+    template <typename Fun>
+    void MapInPlace(Fun &&); // Apply callable to each element (mutable), front to back
+
+    /* ************************************************************************ */
+
+    // Specific member functions (vectorized kernels for numbers of 4 or 8 bytes, see simd/simd.hpp)
+
+    Data Sum() const noexcept requires SimdArithmetic<Data>;             // Sum of the elements (0 when empty; lane-wise, so float sums may round differently from Fold)
+    Data Minimum() const requires SimdArithmetic<Data>;                  // Smallest element (must throw std::length_error when empty)
+    Data Maximum() const requires SimdArithmetic<Data>;                  // Largest element (must throw std::length_error when empty)
+    ulong Count(const Data &) const noexcept requires SimdArithmetic<Data>; // Number of elements equal to the value
+
+    void Scale(const Data &) noexcept requires SimdArithmetic<Data>; // Multiply every element by the value
+    void Add(const Data &) noexcept requires SimdArithmetic<Data>;   // Add the value to every element
+    void Clamp(const Data &, const Data &) requires SimdArithmetic<Data>; // Limit every element to [low, high] (must throw std::invalid_argument if low > high)
+
+    /* ************************************************************************ */
+
+    // Specific member functions (iterators: the element pointers themselves, contiguous)
+
+    using Iterator = Data *;
+    using ConstIterator = const Data *;
+
+    Iterator begin() noexcept; // First element
+    Iterator end() noexcept;   // One past the last element
+
+    ConstIterator begin() const noexcept; // First element (read-only)
+    ConstIterator end() const noexcept;   // One past the last element (read-only)
+
+    ConstIterator cbegin() const noexcept; // First element (read-only, also on a mutable vector)
+    ConstIterator cend() const noexcept;   // One past the last element (read-only, also on a mutable vector)
+
+    /* ************************************************************************ */
+
     // Specific member function (inherited from ResizableContainer)
 
-    void Resize(const ulong) override; // Change the capacity of the vector
+    void Resize(const ulong) override; // Change the number of elements (storage grows geometrically)
 
     /* ************************************************************************ */
 
@@ -98,18 +168,38 @@ namespace lasd
 
     void Clear() override; // Remove all elements from the vector
 
+    /* ************************************************************************ */
+
+    // Specific member functions
+
+    inline ulong Capacity() const noexcept; // Number of elements the vector can hold without reallocating
+
+    void Reserve(const ulong); // Grow the capacity to at least the given number of elements
+    void ShrinkToFit();        // Release the capacity not used by the current elements
+
+    void PushBack(const Data &); // Append a copy of the value (amortized constant time)
+    void PushBack(Data &&);      // Append the moved value (amortized constant time)
+
   protected:
     // Auxiliary functions, if necessary!
+
+    ulong GrowthCapacity(const ulong) const noexcept; // Capacity to allocate when at least the given size is needed
+    void Reallocate(const ulong);                     // Move the elements into a new array of the given capacity
+
+    static Data *Allocate(const ulong);                // Raw storage for the given number of elements (nothing constructed)
+    static void Deallocate(Data *) noexcept;           // Release storage obtained from Allocate
+    static void Relocate(Data *, const ulong, Data *); // Move-construct elements into raw storage and destroy the originals
   };
 
   /* ************************************************************************** */
 
-  template <typename Data>
+  template <typename Data, typename Compare = std::less<Data>>
   class SortableVector : virtual public Vector<Data>, virtual public SortableLinearContainer<Data>
   {
     // Must extend Vector<Data>,
     //             SortableLinearContainer<Data>
-    // Extends Vector with sorting capabilities
+    // Extends Vector with sorting capabilities: Sort, StableSort and
+    // ParallelSort without a comparator order by Compare (ascending by default)
 
   private:
     // ...
@@ -117,7 +207,7 @@ namespace lasd
   protected:
     using Container::size; // Inherit size member from Container base class
 
-    // ...
+    [[no_unique_address]] Compare compare = Compare(); // Takes no space when stateless
 
   public:
     // Default constructor
@@ -126,9 +216,10 @@ namespace lasd
     /* ************************************************************************ */
 
     // Specific constructors
-    SortableVector(const ulong);                         // A vector with a given initial dimension
-    SortableVector(const TraversableContainer<Data> &);  // A vector obtained from a TraversableContainer
-    SortableVector(MappableContainer<Data> &&) noexcept; // A vector obtained from a MappableContainer
+    explicit SortableVector(const Compare &);                                        // An empty vector ordered by the given comparator
+    SortableVector(const ulong, const Compare & = Compare());                        // A vector with a given initial dimension
+    SortableVector(const TraversableContainer<Data> &, const Compare & = Compare()); // A vector obtained from a TraversableContainer
+    SortableVector(MappableContainer<Data> &&, const Compare & = Compare());         // A vector obtained from a MappableContainer
 
     /* ************************************************************************ */
 
@@ -155,11 +246,30 @@ namespace lasd
 
     // Specific member function (inherited from SortableLinearContainer)
 
-    void Sort() override; // Sort elements in the vector
+    void Sort() override; // Sort elements by Compare (pattern-defeating quicksort, not stable)
+
+    /* ************************************************************************ */
+
+    // Specific member functions
+
+    Compare Comparator() const; // The ordering of Sort, StableSort and ParallelSort
+
+    template <typename Order>
+    void Sort(Order); // Sort elements by the given strict weak ordering (not stable)
+
+    void StableSort(); // Sort elements by Compare keeping equivalent elements in their original order
+
+    template <typename Order>
+    void StableSort(Order); // Stable sort by the given strict weak ordering
+
+    void ParallelSort(const ulong, const ulong = ParallelSortThreshold); // Sort on the given number of threads (0 = all), sequential below the threshold
+
+    template <typename Order>
+      requires std::is_invocable_r_v<bool, Order &, const Data &, const Data &>
+    void ParallelSort(const ulong, Order, const ulong = ParallelSortThreshold); // Parallel sort by the given strict weak ordering
 
   protected:
-    // Auxiliary functions for Sort
-    void InsertionSort(Data *, ulong); // Helper method implementing insertion sort algorithm
+    // Auxiliary functions, if necessary!
   };
 
   /* ************************************************************************** */
@@ -0,0 +1,36 @@
+#include "bench.hpp"
+
+/* ************************************************************************** */
+
+#include <iostream>
+
+/* ************************************************************************** */
+
+#include "./sort/sort.hpp"
+#include "./list/list.hpp"
+#include "./container/container.hpp"
+#include "./set/set.hpp"
+#include "./pq/pq.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+void mylasdbench()
+{
+  cout << endl
+       << "~*~#~*~ My LASD Benchmark Suite ~*~#~*~ " << endl;
+
+  mybenchSort();
+  mybenchList();
+  mybenchContainer();
+  mybenchSet();
+  mybenchPQ();
+
+  cout << endl
+       << "End of benchmarks" << endl;
+}
+
+/* ************************************************************************** */
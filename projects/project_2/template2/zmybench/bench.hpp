@@ -0,0 +1,11 @@
+#ifndef MYZLASDBENCH_HPP
+#define MYZLASDBENCH_HPP
+
+/* ************************************************************************** */
+
+// Overall benchmark function
+void mylasdbench();
+
+/* ************************************************************************** */
+
+#endif
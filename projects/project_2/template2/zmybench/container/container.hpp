@@ -0,0 +1,207 @@
+#ifndef MYCONTAINERBENCH_HPP
+#define MYCONTAINERBENCH_HPP
+
+#include <string>
+#include <utility>
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../list/unrolled/unrolledlist.hpp"
+#include "../timer.hpp"
+
+/* ************************************************************************** */
+
+// Container benchmarks: type-erased Traverse/Fold/Map against the template
+// ForEach/Reduce/MapInPlace fast paths and range-for over the iterators,
+// Exists with and without the TraverseWhile early exit, the vectorized Vector
+// kernels on every instruction set against the scalar engines
+
+// Vector holding 0, 1, ..., count - 1
+inline lasd::Vector<long> BenchSequence(ulong count)
+{
+  lasd::Vector<long> vec(count);
+  for (ulong i = 0; i < count; i++)
+  {
+    vec[i] = static_cast<long>(i);
+  }
+  return vec;
+}
+
+// Sum and increment every element through both engines
+template <typename Linear>
+void BenchTraversalEngines(const std::string &name, ulong count)
+{
+  Linear con(BenchSequence(count));
+
+  long sum = 0;
+  BenchRow(name + " Traverse (std::function)", count, BenchMillis([&con, &sum]()
+                                                                   { con.Traverse([&sum](const long &val)
+                                                                                  { sum += val; }); }));
+  BenchRow(name + " ForEach (template)", count, BenchMillis([&con, &sum]()
+                                                             { con.ForEach([&sum](const long &val)
+                                                                           { sum += val; }); }));
+  BenchRow(name + " range-for (iterators)", count, BenchMillis([&con, &sum]()
+                                                              {
+                                                                for (const long &val : std::as_const(con))
+                                                                {
+                                                                  sum += val;
+                                                                } }));
+  BenchRow(name + " Fold (std::function)", count, BenchMillis([&con, &sum]()
+                                                               { sum += con.template Fold<long>([](const long &val, const long &acc)
+                                                                                                { return acc + val; }, 0); }));
+  BenchRow(name + " Reduce (template)", count, BenchMillis([&con, &sum]()
+                                                            { sum += con.template Reduce<long>([](const long &val, const long &acc)
+                                                                                               { return acc + val; }, 0); }));
+  BenchRow(name + " Map (std::function)", count, BenchMillis([&con]()
+                                                              { con.Map([](long &val)
+                                                                        { val++; }); }));
+  BenchRow(name + " MapInPlace (template)", count, BenchMillis([&con]()
+                                                                { con.MapInPlace([](long &val)
+                                                                                 { val++; }); }));
+  BenchKeep(sum);
+}
+
+// Exists as it was before TraverseWhile: a flag set during a full Traverse
+template <typename Data>
+bool BenchFlagExists(const lasd::TraversableContainer<Data> &con, const Data &value)
+{
+  bool exists = false;
+  con.Traverse([&exists, &value](const Data &current)
+               {
+                 if (current == value)
+                 {
+                   exists = true;
+                 } });
+  return exists;
+}
+
+// Lookups of uniformly random present values: the early exit walks half the container on average
+template <typename Linear>
+void BenchExists(const std::string &name, ulong count, ulong lookups)
+{
+  Linear con(BenchSequence(count));
+  const lasd::TraversableContainer<long> &base = con;
+
+  ulong found = 0;
+  ulong state = 11;
+  BenchRow(name + " Exists x" + std::to_string(lookups) + ", full walk (previous)", count, BenchMillis([&]()
+                                                                                                    {
+                                                                                                      for (ulong i = 0; i < lookups; i++)
+                                                                                                      {
+                                                                                                        found += BenchFlagExists(base, static_cast<long>(BenchRandom(state) % count));
+                                                                                                      } }));
+  state = 11;
+  BenchRow(name + " Exists x" + std::to_string(lookups) + ", TraverseWhile", count, BenchMillis([&]()
+                                                                                              {
+                                                                                                for (ulong i = 0; i < lookups; i++)
+                                                                                                {
+                                                                                                  found += base.Exists(static_cast<long>(BenchRandom(state) % count));
+                                                                                                } }));
+  BenchKeep(found);
+}
+
+// Hand-written loop through the public indexed access
+inline void BenchVectorLoop(ulong count)
+{
+  lasd::Vector<long> vec(BenchSequence(count));
+
+  long sum = 0;
+  BenchRow("Vector operator[] loop (virtual, bounds checked)", count, BenchMillis([&vec, &sum]()
+                                                              {
+                                                                for (ulong i = 0; i < vec.Size(); i++)
+                                                                {
+                                                                  sum += vec[i];
+                                                                } }));
+  BenchKeep(sum);
+}
+
+// Label of an instruction set level
+inline std::string BenchSimdName(lasd::SimdLevel level)
+{
+  switch (level)
+  {
+  case lasd::SimdLevel::Avx512:
+    return "AVX-512";
+  case lasd::SimdLevel::Avx2:
+    return "AVX2";
+  default:
+    return "baseline";
+  }
+}
+
+// Folds, Exists of an absent value (the elements stay within +-999) and a sign flip: scalar engines, then the kernels on each level
+template <typename Data>
+void BenchVectorKernels(const std::string &type, ulong count)
+{
+  lasd::Vector<Data> vec(count);
+  for (ulong i = 0; i < count; i++)
+  {
+    vec[i] = static_cast<Data>(i % 1000);
+  }
+  const lasd::TraversableContainer<Data> &base = vec;
+  const std::string name = "Vector<" + type + ">";
+
+  Data sum = 0;
+  bool found = false;
+  BenchRow(name + " Fold sum (std::function, previous)", count, BenchMillis([&]()
+                                                                          { sum += vec.template Fold<Data>([](const Data &val, const Data &acc)
+                                                                                                           { return acc + val; }, 0); }));
+  BenchRow(name + " Reduce sum (template)", count, BenchMillis([&]()
+                                                              { sum += vec.template Reduce<Data>([](const Data &val, const Data &acc)
+                                                                                                 { return acc + val; }, 0); }));
+  BenchRow(name + " Exists (TraverseWhile, previous)", count, BenchMillis([&]()
+                                                                               { found |= !base.TraverseWhile([](const Data &val)
+                                                                                                              { return val != static_cast<Data>(1000); }); }));
+  BenchRow(name + " Map scale (std::function, previous)", count, BenchMillis([&]()
+                                                                           { vec.Map([](Data &val)
+                                                                                     { val *= -1; }); }));
+  BenchRow(name + " MapInPlace scale (template)", count, BenchMillis([&]()
+                                                                    { vec.MapInPlace([](Data &val)
+                                                                                     { val *= -1; }); }));
+
+  for (int level = 0; level <= static_cast<int>(lasd::SimdSupported()); level++)
+  {
+    lasd::SimdLimit(static_cast<lasd::SimdLevel>(level));
+    const std::string simd = ", " + BenchSimdName(lasd::SimdActive());
+    BenchRow(name + " Sum" + simd, count, BenchMillis([&]()
+                                                      { sum += vec.Sum(); }));
+    BenchRow(name + " Minimum" + simd, count, BenchMillis([&]()
+                                                          { sum += vec.Minimum(); }));
+    BenchRow(name + " Count" + simd, count, BenchMillis([&]()
+                                                        { sum += static_cast<Data>(vec.Count(7)); }));
+    BenchRow(name + " Exists" + simd, count, BenchMillis([&]()
+                                                                { found |= vec.Exists(1000); }));
+    BenchRow(name + " Scale" + simd, count, BenchMillis([&]()
+                                                        { vec.Scale(-1); }));
+  }
+  lasd::SimdLimit(lasd::SimdLevel::Avx512);
+
+  BenchKeep(sum);
+  BenchKeep(found);
+}
+
+void mybenchContainer()
+{
+  BenchTitle("Traversal engines on 10^7 longs");
+
+  BenchVectorLoop(10000000);
+  BenchTraversalEngines<lasd::Vector<long>>("Vector", 10000000);
+  BenchTraversalEngines<lasd::List<long>>("List", 10000000);
+  BenchTraversalEngines<lasd::UnrolledList<long>>("UnrolledList", 10000000);
+
+  BenchTitle("Exists on 10^5 longs, early exit against full walk");
+
+  BenchExists<lasd::Vector<long>>("Vector", 100000, 1000);
+  BenchExists<lasd::List<long>>("List", 100000, 1000);
+  BenchExists<lasd::UnrolledList<long>>("UnrolledList", 100000, 1000);
+
+  BenchTitle("Vector kernels on 10^8 numbers, scalar engines against SIMD levels");
+
+  BenchVectorKernels<int>("int", 100000000);
+  BenchVectorKernels<float>("float", 100000000);
+  BenchVectorKernels<double>("double", 100000000);
+}
+
+/* ************************************************************************** */
+
+#endif
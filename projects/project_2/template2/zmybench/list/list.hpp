@@ -0,0 +1,199 @@
+#ifndef MYLISTBENCH_HPP
+#define MYLISTBENCH_HPP
+
+#include <functional>
+#include <string>
+
+#include <malloc.h>
+
+#include "../../list/list.hpp"
+#include "../../list/unrolled/unrolledlist.hpp"
+#include "../../set/lst/setlst.hpp"
+#include "../timer.hpp"
+
+/* ************************************************************************** */
+
+// List benchmarks: backward post-order walk against the former recursive
+// std::function engine, pooled nodes against new/delete under churn, node
+// memory footprint, UnrolledList against List
+
+// Exposes the node chain to rebuild the former recursive post-order visit
+class BenchRecursiveList : public lasd::List<long>
+{
+public:
+  void RecursivePostOrderTraverse(TraverseFun fun) const
+  {
+    std::function<void(Node *)> recursiveTraverse = [&recursiveTraverse, &fun](Node *currentNode)
+    {
+      if (currentNode != nullptr)
+      {
+        recursiveTraverse(currentNode->next);
+        fun(currentNode->element);
+      }
+    };
+    recursiveTraverse(head);
+  }
+};
+
+inline void BenchListPostOrder(ulong count, bool withRecursive)
+{
+  BenchRecursiveList lst;
+  for (ulong i = 0; i < count; i++)
+  {
+    lst.InsertAtBack(static_cast<long>(i));
+  }
+
+  long sum = 0;
+  BenchRow("PreOrderTraverse (forward walk)", count, BenchMillis([&lst, &sum]()
+                                                                 { lst.PreOrderTraverse([&sum](const long &val)
+                                                                                        { sum += val; }); }));
+  BenchRow("PostOrderTraverse (backward walk)", count, BenchMillis([&lst, &sum]()
+                                                                   { lst.PostOrderTraverse([&sum](const long &val)
+                                                                                           { sum += val; }); }));
+  BenchRow("PostOrderMap (backward walk)", count, BenchMillis([&lst]()
+                                                              { lst.PostOrderMap([](long &val)
+                                                                                 { val++; }); }));
+  if (withRecursive)
+  {
+    BenchRow("recursive std::function post-order (previous)", count, BenchMillis([&lst, &sum]()
+                                                                                  { lst.RecursivePostOrderTraverse([&sum](const long &val)
+                                                                                                                   { sum += val; }); }));
+  }
+  BenchKeep(sum);
+}
+
+// Queue-like churn: push at the back, pop at the front, clear, repeat
+template <template <typename> class Allocator>
+double BenchListChurn(ulong count, ulong rounds)
+{
+  lasd::List<long, Allocator> lst;
+  long sum = 0;
+  double millis = BenchMillis([&]()
+                              {
+                                for (ulong round = 0; round < rounds; round++)
+                                {
+                                  for (ulong i = 0; i < count; i++)
+                                  {
+                                    lst.InsertAtBack(static_cast<long>(i));
+                                    if (i % 3 == 2)
+                                    {
+                                      sum += lst.FrontNRemove();
+                                    }
+                                  }
+                                  lst.Clear();
+                                } });
+  BenchKeep(sum);
+  return millis;
+}
+
+// Random inserts and removals on a small sorted set
+template <template <typename> class Allocator>
+double BenchSetLstChurn(ulong count, ulong operations)
+{
+  lasd::SetLst<long, Allocator> set;
+  ulong state = 7;
+  return BenchMillis([&]()
+                     {
+                       for (ulong i = 0; i < operations; i++)
+                       {
+                         long key = static_cast<long>(BenchRandom(state) % count);
+                         if (!set.Insert(key))
+                         {
+                           set.Remove(key);
+                         }
+                       } });
+}
+
+// Exposes the node type to measure it
+template <typename Data>
+class BenchListLayout : public lasd::List<Data>
+{
+public:
+  using typename lasd::List<Data>::Node;
+};
+
+// Node layout of the previous List, with a virtual destructor
+template <typename Data>
+struct BenchVirtualNode
+{
+  Data element;
+  BenchVirtualNode *next = nullptr;
+  BenchVirtualNode *prev = nullptr;
+  virtual ~BenchVirtualNode() = default;
+};
+
+// Bytes per node: in the object, in a malloc chunk (new/delete), in a pool slot
+template <typename Data>
+void BenchFootprint(const std::string &label)
+{
+  using Node = typename BenchListLayout<Data>::Node;
+
+  Node *node = new Node();
+  ulong heapBytes = malloc_usable_size(node) + sizeof(void *); // Usable size plus the chunk header
+  delete node;
+
+  ulong nodeBytes = sizeof(Node);
+  std::cout << "  " << std::left << std::setw(20) << label << std::right
+            << " node " << std::setw(3) << nodeBytes << " B (with vptr " << std::setw(3) << sizeof(BenchVirtualNode<Data>) << " B)"
+            << ", new/delete " << std::setw(3) << heapBytes << " B"
+            << ", pool " << std::setw(3) << nodeBytes << " B"
+            << ", nodes per 64 B line " << std::fixed << std::setprecision(2) << 64.0 / nodeBytes
+            << " (was " << 64.0 / sizeof(BenchVirtualNode<Data>) << ")" << std::endl;
+}
+
+// Fold, traversal and random indexing on the same contents
+template <typename Linear>
+void BenchLinearAccess(const std::string &name, ulong count, ulong lookups)
+{
+  Linear lst;
+  for (ulong i = 0; i < count; i++)
+  {
+    lst.InsertAtBack(static_cast<long>(i));
+  }
+
+  long sum = 0;
+  BenchRow(name + " Traverse", count, BenchMillis([&lst, &sum]()
+                                                  { lst.Traverse([&sum](const long &val)
+                                                                 { sum += val; }); }));
+  BenchRow(name + " Fold", count, BenchMillis([&lst, &sum]()
+                                              { sum += lst.template Fold<long>([](const long &val, const long &acc)
+                                                                               { return acc + val; }, 0); }));
+  ulong state = 3;
+  BenchRow(name + " operator[] x" + std::to_string(lookups), count, BenchMillis([&]()
+                                                                                 {
+                                                                                   for (ulong i = 0; i < lookups; i++)
+                                                                                   {
+                                                                                     sum += lst[BenchRandom(state) % count];
+                                                                                   } }));
+  BenchKeep(sum);
+}
+
+void mybenchList()
+{
+  BenchTitle("List<long> post-order traversal");
+
+  BenchListPostOrder(100000, true);    // The recursive engine needs one stack frame per node
+  BenchListPostOrder(10000000, false); // 10^7 nodes: only the backward walk survives
+
+  BenchTitle("List node memory footprint");
+
+  BenchFootprint<int>("List<int>");
+  BenchFootprint<double>("List<double>");
+  BenchFootprint<std::string>("List<std::string>");
+
+  BenchTitle("UnrolledList<long> against List<long>");
+
+  BenchLinearAccess<lasd::List<long>>("List", 1000000, 1000);
+  BenchLinearAccess<lasd::UnrolledList<long>>("UnrolledList", 1000000, 1000);
+
+  BenchTitle("List<long> node allocation churn");
+
+  BenchRow("List insert/remove churn, new/delete", 100 * 100000, BenchListChurn<lasd::HeapAllocator>(100000, 100));
+  BenchRow("List insert/remove churn, PoolAllocator", 100 * 100000, BenchListChurn<lasd::PoolAllocator>(100000, 100));
+  BenchRow("SetLst insert/remove on 256 keys, new/delete", 1000000, BenchSetLstChurn<lasd::HeapAllocator>(256, 1000000));
+  BenchRow("SetLst insert/remove on 256 keys, PoolAllocator", 1000000, BenchSetLstChurn<lasd::PoolAllocator>(256, 1000000));
+}
+
+/* ************************************************************************** */
+
+#endif
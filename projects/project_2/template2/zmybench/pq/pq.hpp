@@ -0,0 +1,426 @@
+#ifndef MYPQBENCH_HPP
+#define MYPQBENCH_HPP
+
+#include <string>
+#include <utility>
+
+#include "../../pq/heap/pqheap.hpp"
+#include "../../pq/indexed/pqindexed.hpp"
+#include "../timer.hpp"
+
+/* ************************************************************************** */
+
+// Priority queue benchmarks: binary against 4-ary and 8-ary heaps on
+// inserts, hold operations (TipNRemove then Insert) and removals; hole-based
+// and bottom-up sifting against the former swap chains, counted and timed;
+// lazy deletion against ChangeKey on PQIndexed for Dijkstra and timers
+
+// Fill with count random keys, then time the given number of hold operations and of removals
+template <ulong Arity>
+void BenchPQArity(ulong count, ulong operations)
+{
+  lasd::PQHeap<long, Arity> pq;
+  const std::string name = "PQHeap<long, " + std::to_string(Arity) + ">";
+
+  ulong state = 3;
+  BenchRow(name + " Insert x size", count, BenchMillis([&]()
+                                                       {
+                                                         for (ulong i = 0; i < count; i++)
+                                                         {
+                                                           pq.Insert(static_cast<long>(BenchRandom(state)));
+                                                         } }));
+
+  long sum = 0;
+  BenchRow(name + " hold x" + std::to_string(operations), count, BenchMillis([&]()
+                                                                             {
+                                                                               for (ulong i = 0; i < operations; i++)
+                                                                               {
+                                                                                 long tip = pq.TipNRemove();
+                                                                                 sum += tip;
+                                                                                 pq.Insert(tip - static_cast<long>(BenchRandom(state) % (1UL << 40)));
+                                                                               } }));
+
+  const ulong removals = (operations < count) ? operations : count;
+  BenchRow(name + " TipNRemove x" + std::to_string(removals), count, BenchMillis([&]()
+                                                                                 {
+                                                                                   for (ulong i = 0; i < removals; i++)
+                                                                                   {
+                                                                                     sum += pq.TipNRemove();
+                                                                                   } }));
+  BenchKeep(sum);
+}
+
+// Key counting its comparisons and its moves (copies count as moves)
+struct BenchCounted
+{
+  long key = 0;
+
+  static inline ulong comparisons = 0;
+  static inline ulong moves = 0;
+
+  BenchCounted() = default;
+  BenchCounted(long value) : key(value) {}
+  BenchCounted(const BenchCounted &other) : key(other.key) { moves++; }
+  BenchCounted(BenchCounted &&other) noexcept : key(other.key) { moves++; }
+
+  BenchCounted &operator=(const BenchCounted &other)
+  {
+    key = other.key;
+    moves++;
+    return *this;
+  }
+
+  BenchCounted &operator=(BenchCounted &&other) noexcept
+  {
+    key = other.key;
+    moves++;
+    return *this;
+  }
+
+  bool operator<(const BenchCounted &other) const noexcept { return comparisons++, key < other.key; }
+  bool operator>(const BenchCounted &other) const noexcept { return comparisons++, key > other.key; }
+  bool operator==(const BenchCounted &other) const noexcept { return comparisons++, key == other.key; }
+  bool operator!=(const BenchCounted &other) const noexcept { return comparisons++, key != other.key; }
+};
+
+// The binary heap sifting HeapVec used before: recursive, one std::swap per level
+template <typename Data>
+void BenchSwapHeapifyDown(Data *elements, ulong index, ulong heapSize)
+{
+  ulong largest = index;
+  ulong left = 2 * index + 1;
+  ulong right = 2 * index + 2;
+  if (left < heapSize && elements[left] > elements[largest])
+  {
+    largest = left;
+  }
+  if (right < heapSize && elements[right] > elements[largest])
+  {
+    largest = right;
+  }
+  if (largest != index)
+  {
+    std::swap(elements[index], elements[largest]);
+    BenchSwapHeapifyDown(elements, largest, heapSize);
+  }
+}
+
+template <typename Data>
+void BenchSwapHeapifyUp(Data *elements, ulong index)
+{
+  if (index > 0)
+  {
+    ulong parent = (index - 1) / 2;
+    if (elements[index] > elements[parent])
+    {
+      std::swap(elements[index], elements[parent]);
+      BenchSwapHeapifyUp(elements, parent);
+    }
+  }
+}
+
+// The former HeapVec::Sort on a copy of the keys
+template <typename Data>
+void BenchSwapHeapSort(const lasd::Vector<Data> &keys)
+{
+  lasd::Vector<Data> vec(keys);
+  for (ulong i = vec.Size() / 2; i > 0; --i)
+  {
+    BenchSwapHeapifyDown(vec.begin(), i - 1, vec.Size());
+  }
+  for (ulong heapSize = vec.Size(); heapSize > 1; --heapSize)
+  {
+    std::swap(vec[0], vec[heapSize - 1]);
+    BenchSwapHeapifyDown(vec.begin(), 0, heapSize - 1);
+  }
+  BenchKeep(vec[0]);
+}
+
+// HeapVec::Sort on a copy of the keys
+template <typename Data>
+void BenchHoleHeapSort(const lasd::Vector<Data> &keys)
+{
+  lasd::HeapVec<Data> heap(keys);
+  heap.Sort();
+  BenchKeep(heap[0]);
+}
+
+// The former PQHeap: PushBack and swap up; TipNRemove copied the tip, moved the last element to the root and swapped down
+template <typename Data>
+void BenchSwapQueue(const lasd::Vector<Data> &keys)
+{
+  lasd::Vector<Data> queue;
+  for (const Data &key : keys)
+  {
+    queue.PushBack(key);
+    BenchSwapHeapifyUp(queue.begin(), queue.Size() - 1);
+  }
+  while (queue.Size() > 0)
+  {
+    Data tip = queue[0];
+    queue[0] = std::move(queue[queue.Size() - 1]);
+    queue.Resize(queue.Size() - 1);
+    BenchSwapHeapifyDown(queue.begin(), 0, queue.Size());
+    BenchKeep(tip);
+  }
+}
+
+// PQHeap: Insert every key, then TipNRemove them all
+template <typename Data>
+void BenchHoleQueue(const lasd::Vector<Data> &keys)
+{
+  lasd::PQHeap<Data> queue;
+  for (const Data &key : keys)
+  {
+    queue.Insert(key);
+  }
+  while (!queue.Empty())
+  {
+    Data tip = queue.TipNRemove();
+    BenchKeep(tip);
+  }
+}
+
+// Comparisons and moves of both engines on the same random keys
+inline void BenchSiftCounts(ulong count)
+{
+  lasd::Vector<BenchCounted> keys(count);
+  ulong state = 5;
+  for (ulong i = 0; i < count; i++)
+  {
+    keys[i] = BenchCounted(static_cast<long>(BenchRandom(state)));
+  }
+
+  auto counted = [count](const std::string &label, auto &&run)
+  {
+    BenchCounted::comparisons = 0;
+    BenchCounted::moves = 0;
+    run();
+    BenchCountRow(label, count, BenchCounted::comparisons, BenchCounted::moves);
+  };
+  counted("Heap sort, swap chains (previous)", [&keys]()
+          { BenchSwapHeapSort(keys); });
+  counted("Heap sort, hole + bottom-up", [&keys]()
+          { BenchHoleHeapSort(keys); });
+  counted("PQ insert all + drain, swap chains (previous)", [&keys]()
+          { BenchSwapQueue(keys); });
+  counted("PQ insert all + drain, hole + bottom-up", [&keys]()
+          { BenchHoleQueue(keys); });
+}
+
+// Time of both engines on the given keys
+template <typename Data>
+void BenchSiftTimes(const std::string &type, const lasd::Vector<Data> &keys)
+{
+  BenchRow("Heap sort " + type + ", swap chains (previous)", keys.Size(), BenchMillis([&keys]()
+                                                                                    { BenchSwapHeapSort(keys); }));
+  BenchRow("Heap sort " + type + ", hole + bottom-up", keys.Size(), BenchMillis([&keys]()
+                                                                              { BenchHoleHeapSort(keys); }));
+  BenchRow("PQ " + type + " insert + drain, swap chains (previous)", keys.Size(), BenchMillis([&keys]()
+                                                                                           { BenchSwapQueue(keys); }));
+  BenchRow("PQ " + type + " insert + drain, hole + bottom-up", keys.Size(), BenchMillis([&keys]()
+                                                                                     { BenchHoleQueue(keys); }));
+}
+
+// Dijkstra on a random graph (degree edges per vertex): lazy deletion on PQHeap
+// (a shorter path pushes a duplicate, stale entries are skipped when popped)
+// against decrease-key on PQIndexed (one entry per vertex, moved in place)
+inline void BenchDijkstra(ulong vertices, ulong degree)
+{
+  using Item = std::pair<long, ulong>; // (distance, vertex), smallest distance first
+  lasd::Vector<ulong> targets(vertices * degree);
+  lasd::Vector<long> weights(vertices * degree);
+  ulong state = 17;
+  for (ulong i = 0; i < targets.Size(); i++)
+  {
+    targets[i] = BenchRandom(state) % vertices;
+    weights[i] = static_cast<long>(BenchRandom(state) % 1000) + 1;
+  }
+  const long unreached = -1;
+  lasd::Vector<long> distances(vertices);
+
+  ulong peak = 0;
+  double millis = BenchMillis([&]()
+                              {
+                                lasd::PQHeap<Item, 2, std::greater<Item>> heap;
+                                for (ulong v = 0; v < vertices; v++)
+                                {
+                                  distances[v] = unreached;
+                                }
+                                distances[0] = 0;
+                                heap.Insert(Item(0, 0));
+                                while (!heap.Empty())
+                                {
+                                  const Item item = heap.TipNRemove();
+                                  if (item.first != distances[item.second])
+                                  {
+                                    continue;
+                                  }
+                                  for (ulong e = item.second * degree; e < (item.second + 1) * degree; e++)
+                                  {
+                                    const long distance = item.first + weights[e];
+                                    if (distances[targets[e]] == unreached || distance < distances[targets[e]])
+                                    {
+                                      distances[targets[e]] = distance;
+                                      heap.Insert(Item(distance, targets[e]));
+                                    }
+                                  }
+                                  peak = (heap.Size() > peak) ? heap.Size() : peak;
+                                } });
+  BenchRow("Dijkstra, lazy deletion: peak " + std::to_string(peak), vertices, millis);
+  BenchKeep(distances[vertices - 1]);
+
+  peak = 0;
+  millis = BenchMillis([&]()
+                       {
+                         lasd::PQIndexed<Item, 2, std::greater<Item>> pq;
+                         lasd::Vector<ulong> handles(vertices);
+                         lasd::Vector<bool> settled(vertices);
+                         for (ulong v = 0; v < vertices; v++)
+                         {
+                           distances[v] = unreached;
+                           settled[v] = false;
+                         }
+                         distances[0] = 0;
+                         handles[0] = pq.Push(Item(0, 0));
+                         while (!pq.Empty())
+                         {
+                           const Item item = pq.TipNRemove();
+                           settled[item.second] = true;
+                           for (ulong e = item.second * degree; e < (item.second + 1) * degree; e++)
+                           {
+                             const ulong target = targets[e];
+                             const long distance = item.first + weights[e];
+                             if (settled[target])
+                             {
+                               continue;
+                             }
+                             if (distances[target] == unreached)
+                             {
+                               distances[target] = distance;
+                               handles[target] = pq.Push(Item(distance, target));
+                             }
+                             else if (distance < distances[target])
+                             {
+                               distances[target] = distance;
+                               pq.ChangeKey(handles[target], Item(distance, target));
+                             }
+                           }
+                           peak = (pq.Size() > peak) ? pq.Size() : peak;
+                         } });
+  BenchRow("Dijkstra, PQIndexed ChangeKey: peak " + std::to_string(peak), vertices, millis);
+  BenchKeep(distances[vertices - 1]);
+}
+
+// Timer wheel: count timers; each round reschedules a few random timers to a
+// later or earlier deadline, then fires the earliest one and rearms it.
+// Lazy deletion pushes a new entry per reschedule and skips outdated ones
+inline void BenchTimers(ulong count, ulong rounds)
+{
+  using Item = std::pair<long, ulong>; // (deadline, timer), earliest first
+  const ulong reschedules = 4;
+  lasd::Vector<long> deadlines(count);
+  long fired = 0;
+
+  ulong state = 23;
+  ulong peak = 0;
+  double millis = BenchMillis([&]()
+                              {
+                                lasd::PQHeap<Item, 2, std::greater<Item>> heap;
+                                for (ulong t = 0; t < count; t++)
+                                {
+                                  deadlines[t] = static_cast<long>(BenchRandom(state) % 1000000);
+                                  heap.Insert(Item(deadlines[t], t));
+                                }
+                                long now = 0;
+                                for (ulong round = 0; round < rounds; round++)
+                                {
+                                  for (ulong r = 0; r < reschedules; r++)
+                                  {
+                                    const ulong t = BenchRandom(state) % count;
+                                    deadlines[t] = now + static_cast<long>(BenchRandom(state) % 1000000);
+                                    heap.Insert(Item(deadlines[t], t));
+                                  }
+                                  peak = (heap.Size() > peak) ? heap.Size() : peak;
+                                  Item item = heap.TipNRemove();
+                                  while (item.first != deadlines[item.second])
+                                  {
+                                    item = heap.TipNRemove(); // Outdated entry
+                                  }
+                                  now = item.first;
+                                  fired += now;
+                                  deadlines[item.second] = now + static_cast<long>(BenchRandom(state) % 1000000);
+                                  heap.Insert(Item(deadlines[item.second], item.second));
+                                } });
+  BenchRow("Timers, lazy deletion: peak " + std::to_string(peak), count, millis);
+
+  state = 23;
+  millis = BenchMillis([&]()
+                       {
+                         lasd::PQIndexed<Item, 2, std::greater<Item>> pq;
+                         lasd::Vector<ulong> handles(count);
+                         pq.Reserve(count);
+                         for (ulong t = 0; t < count; t++)
+                         {
+                           deadlines[t] = static_cast<long>(BenchRandom(state) % 1000000);
+                           handles[t] = pq.Push(Item(deadlines[t], t));
+                         }
+                         long now = 0;
+                         for (ulong round = 0; round < rounds; round++)
+                         {
+                           for (ulong r = 0; r < reschedules; r++)
+                           {
+                             const ulong t = BenchRandom(state) % count;
+                             deadlines[t] = now + static_cast<long>(BenchRandom(state) % 1000000);
+                             pq.ChangeKey(handles[t], Item(deadlines[t], t));
+                           }
+                           const ulong t = pq.Tip().second;
+                           now = pq.Tip().first;
+                           fired += now;
+                           deadlines[t] = now + static_cast<long>(BenchRandom(state) % 1000000);
+                           pq.ChangeKey(handles[t], Item(deadlines[t], t)); // Rearm in place
+                         } });
+  BenchRow("Timers, PQIndexed ChangeKey: peak " + std::to_string(count), count, millis);
+  BenchKeep(fired);
+}
+
+void mybenchPQ()
+{
+  BenchTitle("PQHeap arity: Insert, hold (TipNRemove + Insert) and TipNRemove on random keys");
+
+  for (ulong count = 1000; count <= 100000000; count *= 10)
+  {
+    BenchPQArity<2>(count, 1000000);
+    BenchPQArity<4>(count, 1000000);
+    BenchPQArity<8>(count, 1000000);
+  }
+
+  BenchTitle("Heap sifting: element comparisons and moves (copies included), random keys");
+
+  BenchSiftCounts(1000000);
+
+  BenchTitle("Heap sifting: time on random longs and on 40-character strings");
+
+  lasd::Vector<long> longs(1000000);
+  lasd::Vector<std::string> strings(1000000);
+  ulong state = 9;
+  for (ulong i = 0; i < longs.Size(); i++)
+  {
+    longs[i] = static_cast<long>(BenchRandom(state));
+    strings[i] = std::to_string(longs[i]) + std::string(40 - std::to_string(longs[i]).size(), '.');
+  }
+  BenchSiftTimes<long>("long", longs);
+  BenchSiftTimes<std::string>("string", strings);
+
+  BenchTitle("Addressable queue: lazy deletion on PQHeap against ChangeKey on PQIndexed (peak = largest queue size)");
+
+  for (ulong count = 100000; count <= 1000000; count *= 10)
+  {
+    BenchDijkstra(count, 8);
+    BenchTimers(count, 1000000);
+  }
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,409 @@
+#ifndef MYSETBENCH_HPP
+#define MYSETBENCH_HPP
+
+#include <string>
+
+#include "../../vector/vector.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../set/lst/setlst.hpp"
+#include "../../set/skip/setskip.hpp"
+#include "../../set/avl/setavl.hpp"
+#include "../../set/btree/setbtree.hpp"
+#include "../../hashset/hashset.hpp"
+#include "../timer.hpp"
+
+/* ************************************************************************** */
+
+// Set benchmarks: bulk construction against one Insert per element, batched
+// InsertAll/RemoveAll merges against one call per element, single ordered
+// operations on the skip list, the AVL tree and the B+ tree against the sorted
+// list, lookup throughput of the B+ tree against binary search on SetVec,
+// unordered membership on HashSet against the ordered sets, SetVec lookup
+// engines against the branchy binary search they replaced
+
+// Random keys, about one in three repeated
+inline lasd::Vector<long> BenchSetKeys(ulong count)
+{
+  lasd::Vector<long> keys(count);
+  ulong state = 5;
+  for (ulong i = 0; i < count; i++)
+  {
+    keys[i] = static_cast<long>(BenchRandom(state) % (count - count / 3 + 1));
+  }
+  return keys;
+}
+
+template <typename SetType>
+void BenchSetBuild(const std::string &name, ulong count, bool withInsert)
+{
+  lasd::Vector<long> keys(BenchSetKeys(count));
+  ulong sizes = 0;
+
+  if (withInsert)
+  {
+    BenchRow(name + " one Insert per key (previous)", count, BenchMillis([&]()
+                                                                         {
+                                                                           SetType set;
+                                                                           for (ulong i = 0; i < count; i++)
+                                                                           {
+                                                                             set.Insert(keys[i]);
+                                                                           }
+                                                                           sizes += set.Size(); }));
+  }
+  BenchRow(name + " bulk constructor", count, BenchMillis([&]()
+                                                          {
+                                                            SetType set(keys);
+                                                            sizes += set.Size(); }));
+
+  lasd::SortableVector<long> sorted(keys);
+  sorted.Sort();
+  BenchRow(name + " FromSorted", count, BenchMillis([&]()
+                                                    {
+                                                      SetType set = SetType::FromSorted(sorted);
+                                                      sizes += set.Size(); }));
+  BenchKeep(sizes);
+}
+
+// Apply a delta (insert a batch, remove another) to a set of count even keys
+template <typename SetType>
+void BenchSetDelta(const std::string &name, ulong count, ulong delta, bool withSingle)
+{
+  lasd::Vector<long> keys(count);
+  for (ulong i = 0; i < count; i++)
+  {
+    keys[i] = static_cast<long>(2 * i);
+  }
+  const SetType base = SetType::FromSorted(keys);
+
+  lasd::Vector<long> additions(delta);
+  lasd::Vector<long> removals(delta);
+  ulong state = 9;
+  for (ulong i = 0; i < delta; i++)
+  {
+    additions[i] = static_cast<long>(BenchRandom(state) % (2 * count)); // About half are new (odd)
+    removals[i] = static_cast<long>(BenchRandom(state) % (2 * count));
+  }
+
+  ulong sizes = 0;
+  std::string label = name + " " + std::to_string(delta) + "-key delta";
+  if (withSingle)
+  {
+    SetType set(base);
+    BenchRow(label + ", per key (previous)", count, BenchMillis([&]()
+                                                                         {
+                                                                           set.lasd::template DictionaryContainer<long>::InsertSome(additions);
+                                                                           set.lasd::template DictionaryContainer<long>::RemoveSome(removals);
+                                                                           sizes += set.Size(); }));
+  }
+  SetType set(base);
+  BenchRow(label + ", sorted batch merge", count, BenchMillis([&]()
+                                                              {
+                                                                set.InsertSome(additions);
+                                                                set.RemoveSome(removals);
+                                                                sizes += set.Size(); }));
+  BenchKeep(sizes);
+}
+
+// Append keys one at a time past the largest: one-key InsertSome batches against plain Insert
+template <typename SetType>
+void BenchSetSmallBatches(const std::string &name, ulong count, ulong batches)
+{
+  lasd::Vector<long> keys(count);
+  for (ulong i = 0; i < count; i++)
+  {
+    keys[i] = static_cast<long>(2 * i);
+  }
+  const SetType base = SetType::FromSorted(keys);
+
+  ulong sizes = 0;
+  std::string label = name + " " + std::to_string(batches) + " ascending keys";
+  SetType single(base);
+  BenchRow(label + ", Insert", count, BenchMillis([&]()
+                                                  {
+                                                    for (ulong b = 0; b < batches; b++)
+                                                    {
+                                                      single.Insert(static_cast<long>(2 * (count + b)));
+                                                    }
+                                                    sizes += single.Size(); }));
+  SetType batched(base);
+  lasd::Vector<long> batch(1);
+  BenchRow(label + ", one-key InsertSome", count, BenchMillis([&]()
+                                                              {
+                                                                for (ulong b = 0; b < batches; b++)
+                                                                {
+                                                                  batch[0] = static_cast<long>(2 * (count + b));
+                                                                  batched.InsertSome(batch);
+                                                                }
+                                                                sizes += batched.Size(); }));
+  BenchKeep(sizes);
+}
+
+// Random single operations on a set of count even keys: about half the inserted keys are new
+template <typename SetType>
+void BenchSetOperations(const std::string &name, ulong count, ulong operations)
+{
+  lasd::Vector<long> keys(count);
+  for (ulong i = 0; i < count; i++)
+  {
+    keys[i] = static_cast<long>(2 * i);
+  }
+  SetType set = SetType::FromSorted(keys);
+
+  lasd::Vector<long> probes(operations);
+  ulong state = 17;
+  for (ulong i = 0; i < operations; i++)
+  {
+    probes[i] = static_cast<long>(BenchRandom(state) % (2 * count)) + 1; // Never below the minimum
+  }
+
+  ulong hits = 0;
+  std::string label = name + " x" + std::to_string(operations);
+  BenchRow(label + " Insert", count, BenchMillis([&]()
+                                                {
+                                                  for (ulong i = 0; i < operations; i++)
+                                                  {
+                                                    hits += set.Insert(probes[i]);
+                                                  } }));
+  BenchRow(label + " Exists", count, BenchMillis([&]()
+                                                {
+                                                  for (ulong i = 0; i < operations; i++)
+                                                  {
+                                                    hits += set.Exists(probes[i]);
+                                                  } }));
+  BenchRow(label + " Predecessor", count, BenchMillis([&]()
+                                                     {
+                                                       for (ulong i = 0; i < operations; i++)
+                                                       {
+                                                         hits += set.Predecessor(probes[i]);
+                                                       } }));
+  BenchRow(label + " Remove", count, BenchMillis([&]()
+                                                {
+                                                  for (ulong i = 0; i < operations; i++)
+                                                  {
+                                                    hits += set.Remove(probes[i]);
+                                                  } }));
+  BenchKeep(hits);
+}
+
+// Many Exists calls on a set of count even keys: about half the probes are present
+template <typename SetType>
+void BenchSetLookups(const std::string &name, ulong count, ulong lookups)
+{
+  lasd::Vector<long> keys(count);
+  for (ulong i = 0; i < count; i++)
+  {
+    keys[i] = static_cast<long>(2 * i);
+  }
+  const SetType set = SetType::FromSorted(keys);
+
+  lasd::Vector<long> probes(lookups);
+  ulong state = 23;
+  for (ulong i = 0; i < lookups; i++)
+  {
+    probes[i] = static_cast<long>(BenchRandom(state) % (2 * count));
+  }
+
+  ulong hits = 0;
+  BenchRow(name + " x" + std::to_string(lookups) + " Exists", count, BenchMillis([&]()
+                                                                                 {
+                                                                                   for (ulong i = 0; i < lookups; i++)
+                                                                                   {
+                                                                                     hits += set.Exists(probes[i]);
+                                                                                   } }));
+  BenchKeep(hits);
+}
+
+// Insert count random keys one by one, look each of them up and one absent
+// key per element, then remove them all; prepare runs on the empty set first
+template <typename SetType, typename Prepare>
+void BenchSetMembership(const std::string &name, ulong count, Prepare &&prepare)
+{
+  lasd::Vector<long> keys(count);
+  ulong state = 29;
+  for (ulong i = 0; i < count; i++)
+  {
+    keys[i] = static_cast<long>(BenchRandom(state) % (4 * count)) * 2; // Even: odd keys are never present
+  }
+
+  SetType set;
+  prepare(set);
+  ulong hits = 0;
+  BenchRow(name + " Insert", count, BenchMillis([&]()
+                                                {
+                                                  for (ulong i = 0; i < count; i++)
+                                                  {
+                                                    hits += set.Insert(keys[i]);
+                                                  } }));
+  BenchRow(name + " Exists (present and absent)", count, BenchMillis([&]()
+                                                                     {
+                                                                       for (ulong i = 0; i < count; i++)
+                                                                       {
+                                                                         hits += set.Exists(keys[i]);
+                                                                         hits += set.Exists(keys[i] + 1);
+                                                                       } }));
+  BenchRow(name + " Remove", count, BenchMillis([&]()
+                                                {
+                                                  for (ulong i = 0; i < count; i++)
+                                                  {
+                                                    hits += set.Remove(keys[i]);
+                                                  } }));
+  BenchKeep(hits);
+}
+
+// The binary search SetVec used before the lookup engines: one branch per level
+template <typename Data>
+bool BenchBranchyExists(const Data *elements, ulong size, const Data &data)
+{
+  long left = 0;
+  long right = size - 1;
+  while (left <= right)
+  {
+    long mid = left + (right - left) / 2;
+    if (elements[mid] == data)
+    {
+      return true;
+    }
+    else if (elements[mid] < data)
+    {
+      left = mid + 1;
+    }
+    else
+    {
+      right = mid - 1;
+    }
+  }
+  return false;
+}
+
+// Exists and Successor on count even keys through each engine; probes never reach the maximum
+template <typename Data>
+void BenchSetVecEngines(const std::string &type, ulong count, ulong lookups)
+{
+  lasd::SetVec<Data> set;
+  {
+    lasd::Vector<Data> keys(count);
+    for (ulong i = 0; i < count; i++)
+    {
+      keys[i] = static_cast<Data>(2 * i);
+    }
+    set = lasd::SetVec<Data>::FromSorted(std::move(keys));
+  }
+
+  lasd::Vector<Data> probes(lookups);
+  ulong state = 31;
+  for (ulong i = 0; i < lookups; i++)
+  {
+    probes[i] = static_cast<Data>(BenchRandom(state) % (2 * count - 2));
+  }
+
+  ulong hits = 0;
+  Data sum = 0;
+  std::string label = "SetVec<" + type + "> x" + std::to_string(lookups);
+  BenchRow(label + " Exists, branchy (previous)", count, BenchMillis([&]()
+                                                                    {
+                                                                      for (ulong i = 0; i < lookups; i++)
+                                                                      {
+                                                                        hits += BenchBranchyExists(set.begin(), set.Size(), probes[i]);
+                                                                      } }));
+  BenchRow(label + " Exists, branchless", count, BenchMillis([&]()
+                                                             {
+                                                               for (ulong i = 0; i < lookups; i++)
+                                                               {
+                                                                 hits += set.Exists(probes[i]);
+                                                               } }));
+  BenchRow(label + " Successor, branchless", count, BenchMillis([&]()
+                                                                {
+                                                                  for (ulong i = 0; i < lookups; i++)
+                                                                  {
+                                                                    sum += set.Successor(probes[i]);
+                                                                  } }));
+
+  set.Layout(lasd::SearchLayout::Eytzinger);
+  BenchRow("SetVec<" + type + "> Eytzinger index build", count, BenchMillis([&]()
+                                                                            { hits += set.Exists(probes[0]); }));
+  BenchRow(label + " Exists, Eytzinger", count, BenchMillis([&]()
+                                                            {
+                                                              for (ulong i = 0; i < lookups; i++)
+                                                              {
+                                                                hits += set.Exists(probes[i]);
+                                                              } }));
+  BenchRow(label + " Successor, Eytzinger", count, BenchMillis([&]()
+                                                               {
+                                                                 for (ulong i = 0; i < lookups; i++)
+                                                                 {
+                                                                   sum += set.Successor(probes[i]);
+                                                                 } }));
+  BenchKeep(hits);
+  BenchKeep(sum);
+}
+
+void mybenchSet()
+{
+  BenchTitle("Set construction from unsorted keys with duplicates");
+
+  BenchSetBuild<lasd::SetVec<long>>("SetVec", 50000, true);
+  BenchSetBuild<lasd::SetVec<long>>("SetVec", 5000000, false); // One Insert per key takes minutes here
+  BenchSetBuild<lasd::SetLst<long>>("SetLst", 20000, true);
+  BenchSetBuild<lasd::SetLst<long, lasd::PoolAllocator>>("SetLst (pool)", 5000000, false);
+
+  BenchTitle("Set delta application");
+
+  BenchSetDelta<lasd::SetVec<long>>("SetVec", 1000000, 10000, true);
+  BenchSetDelta<lasd::SetVec<long>>("SetVec", 10000000, 100000, false);
+  BenchSetDelta<lasd::SetLst<long, lasd::PoolAllocator>>("SetLst (pool)", 100000, 2000, true);
+  BenchSetDelta<lasd::SetLst<long, lasd::PoolAllocator>>("SetLst (pool)", 10000000, 100000, false);
+  BenchSetSmallBatches<lasd::SetVec<long>>("SetVec", 1000000, 3000);
+
+  BenchTitle("Ordered set operations on random keys");
+
+  for (ulong count = 10000; count <= 10000000; count *= 10)
+  {
+    if (count <= 1000000)
+    {
+      // Every operation walks the list: 1000 of them on 10^6 keys take a minute, on 10^7 ten
+      BenchSetOperations<lasd::SetLst<long, lasd::PoolAllocator>>("SetLst (pool)", count, (count < 1000000) ? 1000 : 100);
+    }
+    BenchSetOperations<lasd::SetSkip<long>>("SetSkip", count, 1000);
+    BenchSetOperations<lasd::SetAvl<long>>("SetAvl", count, 1000);
+    BenchSetOperations<lasd::SetAvl<long, lasd::PoolAllocator>>("SetAvl (pool)", count, 1000);
+    BenchSetOperations<lasd::SetBTree<long>>("SetBTree", count, 1000);
+  }
+
+  BenchTitle("Set lookup throughput, in and out of cache");
+
+  for (ulong count = 10000; count <= 10000000; count *= 10)
+  {
+    BenchSetLookups<lasd::SetVec<long>>("SetVec", count, 1000000);
+    BenchSetLookups<lasd::SetBTree<long, 16>>("SetBTree<long, 16>", count, 1000000);
+    BenchSetLookups<lasd::SetBTree<long>>("SetBTree (default, 32 keys)", count, 1000000);
+    BenchSetLookups<lasd::SetBTree<long, 64>>("SetBTree<long, 64>", count, 1000000);
+  }
+
+  BenchTitle("SetVec lookup engines (10^6 random lookups per row: ms = ns per lookup)");
+
+  for (ulong count = 1000; count <= 100000000; count *= 10)
+  {
+    BenchSetVecEngines<int>("int", count, 1000000);
+    BenchSetVecEngines<double>("double", count, 1000000);
+  }
+
+  BenchTitle("Unordered membership: Insert, Exists, Remove on random keys");
+
+  auto nothing = [](auto &) {};
+  for (ulong count = 100000; count <= 10000000; count *= 10)
+  {
+    if (count <= 1000000)
+    {
+      // Every call walks a tree of cold nodes: 10^7 of each take tens of seconds
+      BenchSetMembership<lasd::SetAvl<long, lasd::PoolAllocator>>("SetAvl (pool)", count, nothing);
+      BenchSetMembership<lasd::SetBTree<long>>("SetBTree", count, nothing);
+    }
+    BenchSetMembership<lasd::HashSet<long>>("HashSet", count, nothing);
+    BenchSetMembership<lasd::HashSet<long>>("HashSet, reserved", count, [count](lasd::HashSet<long> &set)
+                                            { set.Reserve(count); });
+  }
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef MYSORTBENCH_HPP
+#define MYSORTBENCH_HPP
+
+#include <algorithm>
+
+#include "../../vector/vector.hpp"
+#include "../timer.hpp"
+
+/* ************************************************************************** */
+
+// Sorting benchmarks: SortableVector::Sort/StableSort against insertion sort and std::sort,
+// ParallelSort against the sequential Sort
+
+// Fill a vector with one of the benchmark input shapes
+inline void FillSortInput(lasd::SortableVector<int> &vec, int shape)
+{
+  ulong state = 42;
+  ulong count = vec.Size();
+  for (ulong i = 0; i < count; i++)
+  {
+    switch (shape)
+    {
+    case 0:
+      vec[i] = static_cast<int>(BenchRandom(state)); // Random
+      break;
+    case 1:
+      vec[i] = static_cast<int>(i); // Sorted
+      break;
+    case 2:
+      vec[i] = static_cast<int>(count - i); // Reversed
+      break;
+    default:
+      vec[i] = static_cast<int>(BenchRandom(state) % 16); // Many duplicates
+      break;
+    }
+  }
+}
+
+inline void BenchSortShapes(ulong count, bool withInsertionSort)
+{
+  const char *shapes[] = {"random", "sorted", "reversed", "many duplicates"};
+
+  for (int shape = 0; shape < 4; shape++)
+  {
+    lasd::SortableVector<int> input(count);
+    FillSortInput(input, shape);
+
+    lasd::SortableVector<int> vec(input);
+    BenchRow(std::string("Sort (pdqsort), ") + shapes[shape], count, BenchMillis([&vec]()
+                                                                                { vec.Sort(); }));
+
+    vec = input;
+    BenchRow(std::string("StableSort (merge sort), ") + shapes[shape], count, BenchMillis([&vec]()
+                                                                                          { vec.StableSort(); }));
+
+    vec = input;
+    int *data = &vec[0];
+    BenchRow(std::string("std::sort, ") + shapes[shape], count, BenchMillis([data, count]()
+                                                                           { std::sort(data, data + count); }));
+
+    if (withInsertionSort)
+    {
+      vec = input;
+      data = &vec[0];
+      BenchRow(std::string("insertion sort (previous Sort), ") + shapes[shape], count, BenchMillis([data, count]()
+                                                                                                  { lasd::InsertionSort(data, data + count); }));
+    }
+  }
+}
+
+// ParallelSort scaling against the sequential Sort on the same input
+inline void BenchParallelSort(ulong count)
+{
+  lasd::SortableVector<int> input(count);
+  FillSortInput(input, 0);
+
+  lasd::SortableVector<int> vec(input);
+  double sequential = BenchMillis([&vec]()
+                                  { vec.Sort(); });
+  BenchRow("Sort (sequential), random", count, sequential);
+
+  for (ulong threads = 1; threads <= 32; threads *= 2)
+  {
+    vec = input;
+    double parallel = BenchMillis([&vec, threads]()
+                                  { vec.ParallelSort(threads); });
+    BenchRow("ParallelSort, " + std::to_string(threads) + " threads", count, parallel);
+    std::cout << "    speedup " << std::fixed << std::setprecision(2) << sequential / parallel << "x" << std::endl;
+  }
+}
+
+void mybenchSort()
+{
+  BenchTitle("Sorting SortableVector<int>");
+
+  BenchSortShapes(20000, true);    // Insertion sort is only feasible on small inputs
+  BenchSortShapes(1000000, false); // 10^6 elements: pdqsort against std::sort
+
+  BenchTitle("ParallelSort scaling, SortableVector<int>");
+
+  BenchParallelSort(4000000);
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef MYBENCHTIMER_HPP
+#define MYBENCHTIMER_HPP
+
+/* ************************************************************************** */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "sys/types.h"
+
+/* ************************************************************************** */
+
+// Shared benchmark helpers
+
+// Deterministic pseudo-random generator (same sequence on every run)
+inline ulong BenchRandom(ulong &state)
+{
+  state = state * 6364136223846793005UL + 1442695040888963407UL;
+  return state >> 17;
+}
+
+// Milliseconds taken by one call of fun
+template <typename Fun>
+double BenchMillis(Fun &&fun)
+{
+  auto start = std::chrono::steady_clock::now();
+  fun();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+// Keep the optimizer from discarding a computed value
+template <typename Data>
+void BenchKeep(const Data &value)
+{
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+// Print a table title
+inline void BenchTitle(const std::string &title)
+{
+  std::cout << std::endl
+            << title << std::endl;
+}
+
+// Print one labelled measurement
+inline void BenchRow(const std::string &label, ulong count, double millis)
+{
+  std::cout << "  " << std::left << std::setw(52) << label
+            << std::right << std::setw(11) << count << " elements "
+            << std::setw(12) << std::fixed << std::setprecision(3) << millis << " ms" << std::endl;
+}
+
+// Print one labelled operation count (comparisons and element moves)
+inline void BenchCountRow(const std::string &label, ulong count, ulong comparisons, ulong moves)
+{
+  std::cout << "  " << std::left << std::setw(52) << label
+            << std::right << std::setw(11) << count << " elements "
+            << std::setw(12) << comparisons << " cmp " << std::setw(12) << moves << " moves" << std::endl;
+}
+
+/* ************************************************************************** */
+
+#endif
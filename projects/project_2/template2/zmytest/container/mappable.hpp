@@ -1,6 +1,9 @@
 #ifndef MYMAPPABLETEST_HPP
 #define MYMAPPABLETEST_HPP
 
+#include <algorithm>
+#include <ranges>
+
 #include "../../container/mappable.hpp"
 #include "../../vector/vector.hpp"
 #include "../../list/list.hpp"
@@ -396,6 +399,93 @@ void PrePostOrderDifference(uint &testnum, uint &testerr,
   std::cout << (sameResults ? "Final states are identical (linear container)" : "Final states differ (non-linear container)") << std::endl;
 }
 
+// Test the template MapInPlace fast path against Map, both on the concrete
+// container and through a MappableContainer reference
+template <typename Data, typename Container>
+void MapInPlaceConsistency(uint &testnum, uint &testerr, Container &con, const Data &increment)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") MapInPlace fast path matches Map: ";
+
+    lasd::MappableContainer<Data> &base = con;
+
+    Container expected(con);
+    expected.Map([&increment](Data &val)
+                 { val += increment; });
+
+    con.MapInPlace([&increment](Data &val)
+                   { val += increment; });
+    tst = (con == expected);
+
+    expected.Map([&increment](Data &val)
+                 { val += increment; });
+    base.MapInPlace([&increment](Data &val)
+                    { val += increment; });
+    tst = tst && (con == expected);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Test writing through iterators against Map, and std::ranges algorithms on the container
+template <typename Data, typename Container>
+void IteratorMapConsistency(uint &testnum, uint &testerr, Container &con, const Data &increment)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") Writing through iterators matches Map: ";
+
+    Container expected(con);
+    expected.Map([&increment](Data &val)
+                 { val += increment; });
+
+    for (Data &val : con)
+    {
+      val += increment;
+    }
+    tst = (con == expected);
+
+    std::ranges::for_each(con, [&increment](Data &val)
+                          { val += increment; });
+    std::ranges::for_each(expected, [&increment](Data &val)
+                          { val += increment; });
+    tst = tst && (con == expected);
+
+    // Reverse in place through bidirectional iterators, twice restores the order
+    std::ranges::reverse(con);
+    tst = tst && (con.Empty() || con.Front() == expected.Back());
+    std::ranges::reverse(con);
+    tst = tst && (con == expected);
+
+    // Constant iterators convert from mutable ones
+    typename Container::ConstIterator first = con.begin();
+    tst = tst && (first == con.cbegin());
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
 /* ************************************************************************** */
 
-#endif
\ No newline at end of file
+#endif
@@ -1,8 +1,12 @@
 #ifndef MYTRAVERSABLETEST_HPP
 #define MYTRAVERSABLETEST_HPP
 
+#include <algorithm>
+#include <ranges>
+
 #include "../../container/traversable.hpp"
 #include "../../list/list.hpp"
+#include "../../vector/vector.hpp"
 
 /* ************************************************************************** */
 
@@ -272,6 +276,177 @@ void OrderDifference(uint &testnum, uint &testerr,
   // Do not increment error count as this is informational
 }
 
+// Test the template ForEach/Reduce fast paths against Traverse/Fold, both on
+// the concrete container and through a TraversableContainer reference
+template <typename Data, typename Container>
+void ForEachReduceConsistency(uint &testnum, uint &testerr, const Container &con)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") ForEach/Reduce fast paths match Traverse/Fold: ";
+
+    const lasd::TraversableContainer<Data> &base = con;
+
+    lasd::List<Data> traversed;
+    base.Traverse([&traversed](const Data &val)
+                  { traversed.InsertAtBack(val); });
+
+    lasd::List<Data> direct;
+    con.ForEach([&direct](const Data &val)
+                { direct.InsertAtBack(val); });
+
+    lasd::List<Data> fallback;
+    base.ForEach([&fallback](const Data &val)
+                 { fallback.InsertAtBack(val); });
+
+    tst = (direct == traversed) && (fallback == traversed);
+
+    // Counting fold: same result through every entry point
+    auto count = [](const Data &, const ulong &acc)
+    { return acc + 1; };
+    ulong folded = base.template Fold<ulong>(count, 0);
+    ulong reduced = con.Reduce(count, 0UL);
+    ulong reducedBase = base.Reduce(count, 0UL);
+    tst = tst && (folded == con.Size()) && (reduced == folded) && (reducedBase == folded);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Test that TraverseWhile stops right after the element that ends it, and the queries built on it
+template <typename Data, typename Container>
+void TraverseWhileEarlyExit(uint &testnum, uint &testerr, const Container &con)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") TraverseWhile early exit and Any/All/None/FindFirst: ";
+
+    const lasd::TraversableContainer<Data> &base = con;
+
+    lasd::Vector<Data> traversed(con.Size());
+    ulong count = 0;
+    base.Traverse([&traversed, &count](const Data &val)
+                  { traversed[count++] = val; });
+
+    // A full run visits everything and reports completion
+    ulong visits = 0;
+    tst = con.TraverseWhile([&visits](const Data &)
+                            { visits++; return true; }) && (visits == count);
+
+    // Stopping at each position visits exactly the elements up to it, in Traverse order
+    for (ulong stop = 0; stop < count && tst; stop++)
+    {
+      visits = 0;
+      bool inOrder = true;
+      bool completed = base.TraverseWhile([&](const Data &val)
+                                          {
+                                            inOrder = inOrder && (val == traversed[visits]);
+                                            return visits++ != stop; });
+      tst = !completed && inOrder && (visits == stop + 1);
+
+      // The type-erased default walks on but must not call the function again
+      visits = 0;
+      completed = base.lasd::TraversableContainer<Data>::TraverseWhile([&visits, stop](const Data &)
+                                                                       { return visits++ != stop; });
+      tst = tst && !completed && (visits == stop + 1);
+    }
+
+    // Queries against the collected elements
+    for (ulong i = 0; i < count && tst; i++)
+    {
+      const Data &target = traversed[i];
+      ulong first = 0;
+      while (!(traversed[first] == target))
+      {
+        first++;
+      }
+      auto isTarget = [&target](const Data &val)
+      { return val == target; };
+      tst = con.Exists(target) && base.Any(isTarget) && !base.None(isTarget) && (base.FindFirst(isTarget) == first);
+      bool allTarget = true;
+      for (ulong j = 0; j < count; j++)
+      {
+        allTarget = allTarget && (traversed[j] == target);
+      }
+      tst = tst && (base.All(isTarget) == allTarget);
+    }
+
+    auto never = [](const Data &)
+    { return false; };
+    tst = tst && !base.Any(never) && base.None(never) && (base.All(never) == (count == 0)) && (base.FindFirst(never) == count);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Test that iterators visit the same elements as Traverse, and backwards as PostOrderTraverse
+template <typename Data, typename Container>
+void IteratorTraverseConsistency(uint &testnum, uint &testerr, const Container &con)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") Iterators match Traverse/PostOrderTraverse: ";
+
+    const lasd::LinearContainer<Data> &base = con;
+
+    lasd::List<Data> traversed;
+    base.Traverse([&traversed](const Data &val)
+                  { traversed.InsertAtBack(val); });
+
+    lasd::List<Data> iterated;
+    for (const Data &val : con)
+    {
+      iterated.InsertAtBack(val);
+    }
+
+    lasd::List<Data> postTraversed;
+    base.PostOrderTraverse([&postTraversed](const Data &val)
+                           { postTraversed.InsertAtBack(val); });
+
+    lasd::List<Data> reversed;
+    for (const Data &val : std::views::reverse(con))
+    {
+      reversed.InsertAtBack(val);
+    }
+
+    tst = (iterated == traversed) && (reversed == postTraversed);
+    tst = tst && (static_cast<ulong>(std::ranges::distance(con)) == con.Size());
+    tst = tst && std::ranges::equal(con, traversed) && std::ranges::equal(con.cbegin(), con.cend(), traversed.begin(), traversed.end());
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
 /* ************************************************************************** */
 
-#endif
\ No newline at end of file
+#endif
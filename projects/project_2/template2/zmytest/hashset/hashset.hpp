@@ -0,0 +1,138 @@
+#ifndef MYHASHSETTEST_HPP
+#define MYHASHSETTEST_HPP
+
+#include "../../hashset/hashset.hpp"
+#include "../../set/vec/setvec.hpp"
+#include <stdexcept>
+#include <string>
+
+/* ************************************************************************** */
+
+// Extended HashSet test functions
+
+// Hash sending every block of 16 consecutive keys to the same value: long
+// collision runs, displacements and backward shifts on every operation
+struct HashSetBlockHash
+{
+  ulong operator()(const long &data) const noexcept { return static_cast<ulong>(data) / 16; }
+};
+
+// Random Insert/Remove/Exists mix checked step by step against SetVec, then
+// the whole content through the iterators, a copy, a rebuild and self batches
+template <typename Hash>
+void HashSetAgainstSetVec(uint &testnum, uint &testerr, const std::string &name, ulong universe, ulong operations)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") " << name << " against SetVec, " << operations << " random operations on " << universe << " keys: ";
+
+    lasd::HashSet<long, Hash> set;
+    lasd::SetVec<long> vec;
+    ulong seed = 24680;
+
+    for (ulong i = 0; i < operations && tst; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      const long key = static_cast<long>((seed >> 33) % universe);
+
+      switch ((seed >> 20) % 3)
+      {
+      case 0:
+        tst = (set.Insert(key) == vec.Insert(key));
+        break;
+      case 1:
+        tst = (set.Remove(key) == vec.Remove(key));
+        break;
+      default:
+        tst = (set.Exists(key) == vec.Exists(key));
+        break;
+      }
+      tst = tst && (set.Size() == vec.Size()) && (set.LoadFactor() <= set.MaxLoadFactor());
+    }
+
+    ulong visited = 0;
+    for (const long &val : set)
+    {
+      tst = tst && vec.Exists(val);
+      visited++;
+    }
+    tst = tst && (visited == vec.Size());
+
+    lasd::HashSet<long, Hash> copy(set);
+    lasd::HashSet<long, Hash> rebuilt(vec);
+    tst = tst && (copy == set) && (rebuilt == set);
+
+    // The batch may be the set itself
+    tst = tst && (copy.InsertAll(copy) == copy.Empty()) && (copy == set);
+    tst = tst && copy.RemoveAll(copy) && copy.Empty();
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Reserve makes room once, the load factor bounds the size, lowering it below the load grows the table
+inline void HashSetCapacity(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") HashSet Reserve and load factor with " << count << " keys: ";
+
+    lasd::HashSet<long> set;
+    tst = (set.Capacity() == 0) && (set.LoadFactor() == 0.0) && !set.Exists(0);
+
+    set.Reserve(count);
+    const ulong reserved = set.Capacity();
+    for (ulong i = 0; i < count; i++)
+    {
+      set.Insert(static_cast<long>(i * 7));
+    }
+    tst = tst && (set.Size() == count) && (set.Capacity() == reserved) && (set.LoadFactor() <= set.MaxLoadFactor());
+
+    set.MaxLoadFactor(0.25);
+    tst = tst && ((set.Capacity() > reserved) == (count > static_cast<ulong>(0.25 * reserved))) && (set.LoadFactor() <= 0.25);
+    for (ulong i = 0; i < count && tst; i++)
+    {
+      tst = set.Exists(static_cast<long>(i * 7)) && !set.Exists(static_cast<long>(i * 7 + 1));
+    }
+
+    bool thrown = false;
+    try
+    {
+      set.MaxLoadFactor(1.0);
+    }
+    catch (std::invalid_argument &)
+    {
+      thrown = true;
+    }
+    tst = tst && thrown && (set.MaxLoadFactor() == 0.25);
+
+    set.Clear();
+    tst = tst && set.Empty() && (set.Capacity() == 0) && set.Insert(1) && set.Exists(1);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+/* ************************************************************************** */
+
+#endif
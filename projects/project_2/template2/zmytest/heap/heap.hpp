@@ -2,6 +2,7 @@
 #define MYHEAPTEST_HPP
 
 #include "../../heap/heap.hpp"
+#include "../container/traversable.hpp"
 
 /* ************************************************************************** */
 
@@ -427,6 +428,78 @@ void HeapMoveConstructor(uint &testnum, uint &testerr, const lasd::Vector<Data>
   testerr += (1 - (uint)tst);
 }
 
+template <typename Data>
+void HeapParallelSort(uint &testnum, uint &testerr, const lasd::Vector<Data> &data, ulong threads)
+{
+  bool tst;
+  testnum++;
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") Heap ParallelSort on " << threads << " threads matches Sort: ";
+    lasd::HeapVec<Data> sequential(data);
+    lasd::HeapVec<Data> parallel(data);
+    sequential.Sort();
+    parallel.ParallelSort(threads, 0);
+    std::cout << ((tst = (parallel == sequential)) ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "\"" << exc.what() << "\": " << "Error!" << std::endl;
+  }
+  testerr += (1 - (uint)tst);
+}
+
+template <ulong Arity>
+void HeapArityRandom(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst;
+  testnum++;
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") HeapVec<long, " << Arity << "> Heapify, IsHeap and Sort on " << count << " random elements: ";
+    lasd::SortableVector<long> data(count);
+    ulong seed = 97531;
+    for (ulong i = 0; i < count; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      data[i] = static_cast<long>((seed >> 33) % (count + 1));
+    }
+
+    lasd::HeapVec<long, Arity> heap(data);
+    tst = heap.IsHeap();
+    for (ulong i = 1; i < heap.Size() && tst; i++)
+    {
+      tst = !(heap[(i - 1) / Arity] < heap[i]); // Parent not smaller than child
+    }
+
+    // Breaking one parent-child pair must be noticed
+    if (count > Arity + 1)
+    {
+      lasd::HeapVec<long, Arity> broken(heap);
+      broken[Arity] = heap[0] + 1;
+      tst = tst && !broken.IsHeap();
+      broken.Heapify();
+      tst = tst && broken.IsHeap() && (broken[0] == heap[0] + 1);
+    }
+
+    heap.Sort();
+    data.Sort();
+    tst = tst && (heap.Size() == data.Size());
+    for (ulong i = 0; i < data.Size() && tst; i++)
+    {
+      tst = (heap[i] == data[i]);
+    }
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "\"" << exc.what() << "\": " << "Error!" << std::endl;
+  }
+  testerr += (1 - (uint)tst);
+}
+
 /* ************************************************************************** */
 
 // Complete test functions for different data types
@@ -487,9 +560,20 @@ void mytestHeapInt(uint &testnum, uint &testerr)
     HeapPropertyAfterHeapify<int>(loctestnum, loctesterr, consistencyHeap);
     HeapPropertyLostAfterSort<int>(loctestnum, loctesterr, consistencyHeap);
     HeapPropertyAfterHeapify<int>(loctestnum, loctesterr, consistencyHeap);
+    ForEachReduceConsistency<int>(loctestnum, loctesterr, consistencyHeap);
+    IteratorTraverseConsistency<int>(loctestnum, loctesterr, consistencyHeap);
+    TraverseWhileEarlyExit<int>(loctestnum, loctesterr, consistencyHeap);
 
     // Test sort preserves elements
     HeapSortPreservesElements<int>(loctestnum, loctesterr, mixedData);
+    HeapParallelSort<int>(loctestnum, loctesterr, mixedData, 3);
+
+    // Test wider nodes
+    HeapArityRandom<2>(loctestnum, loctesterr, 10000);
+    HeapArityRandom<3>(loctestnum, loctesterr, 1000);
+    HeapArityRandom<4>(loctestnum, loctesterr, 10000);
+    HeapArityRandom<8>(loctestnum, loctesterr, 10000);
+    HeapArityRandom<8>(loctestnum, loctesterr, 5);
 
     // Test copy and move constructors
     HeapCopyConstructor<int>(loctestnum, loctesterr, mixedData);
@@ -571,6 +655,7 @@ void mytestHeapString(uint &testnum, uint &testerr)
 
     // Test sort preserves elements
     HeapSortPreservesElements<std::string>(loctestnum, loctesterr, mixedStrData);
+    HeapParallelSort<std::string>(loctestnum, loctesterr, mixedStrData, 2);
 
     // Test copy and move constructors
     HeapCopyConstructor<std::string>(loctestnum, loctesterr, mixedStrData);
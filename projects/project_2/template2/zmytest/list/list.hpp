@@ -522,6 +522,267 @@ void ListTraversalOrders(uint &testnum, uint &testerr, lasd::List<Data> &lst)
   testerr += (1 - (uint)tst);
 }
 
+// Use the list as a deque: back removals must be O(1) and keep both links consistent
+inline void ListDequeTest(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") List as a deque with " << count << " elements: ";
+
+    lasd::List<long> lst;
+    for (ulong i = 0; i < count; i++)
+    {
+      if (i % 2 == 0)
+      {
+        lst.InsertAtBack(static_cast<long>(i)); // Even values grow the back
+      }
+      else
+      {
+        lst.InsertAtFront(-static_cast<long>(i)); // Odd values grow the front
+      }
+    }
+
+    // Backward walk must visit the exact reverse of the forward walk
+    long expected = lst.Back();
+    bool first = true;
+    ulong visited = 0;
+    lst.PostOrderTraverse([&](const long &val)
+                          {
+                            if (first)
+                            {
+                              tst = tst && (val == expected);
+                              first = false;
+                            }
+                            visited++; });
+    tst = tst && (visited == count);
+
+    // Drain from the back: even values come out in decreasing order, then odd ones
+    long last = static_cast<long>(count);
+    while (!lst.Empty() && lst.Back() >= 0)
+    {
+      long val = lst.BackNRemove();
+      tst = tst && (val < last);
+      last = val;
+    }
+    while (!lst.Empty())
+    {
+      lst.RemoveFromBack();
+      if (!lst.Empty())
+      {
+        tst = tst && (lst.Back() < 0) && (lst.Front() < 0);
+      }
+    }
+    tst = tst && lst.Empty() && (lst.Size() == 0);
+
+    // The list must still be usable after being drained from the back
+    lst.InsertAtBack(1L);
+    lst.InsertAtFront(0L);
+    lst.InsertAtBack(2L);
+    tst = tst && (lst[0] == 0) && (lst[1] == 1) && (lst[2] == 2) && (lst.BackNRemove() == 2) && (lst.Back() == 1);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Post-order visits of a list far deeper than any recursion could handle
+inline void ListDeepPostOrderTest(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") List post-order on " << count << " nodes: ";
+
+    lasd::List<ulong> lst;
+    for (ulong i = 0; i < count; i++)
+    {
+      lst.InsertAtBack(i);
+    }
+
+    // PostOrderMap visits back to front: store each element's rank in the visit
+    ulong rank = 0;
+    lst.PostOrderMap([&rank](ulong &val)
+                     { val = rank++; });
+
+    // PostOrderTraverse follows the same backward order: ranks come back in sequence
+    ulong visited = 0;
+    lst.PostOrderTraverse([&tst, &visited](const ulong &val)
+                          { tst = tst && (val == visited++); });
+    tst = tst && (visited == count) && (lst.Front() == count - 1) && (lst.Back() == 0);
+
+    ulong folded = lst.PostOrderFold<ulong>([](const ulong &val, const ulong &acc)
+                                            { return acc + val; }, 0);
+    tst = tst && (folded == count * (count - 1) / 2);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Copies of long lists must not recurse, splicing must only relink nodes
+inline void ListCopySpliceTest(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") List copy and splice with " << count << " elements: ";
+
+    lasd::List<ulong> lst;
+    for (ulong i = 0; i < count; i++)
+    {
+      lst.InsertAtBack(i);
+    }
+
+    // Copy construction and copy assignment growing a shorter list
+    lasd::List<ulong> copy(lst);
+    lasd::List<ulong> grown;
+    grown.InsertAtBack(7UL);
+    grown = lst;
+    tst = tst && (copy == lst) && (grown == lst) && (copy.Back() == count - 1) && (grown.BackNRemove() == count - 1);
+
+    // Append moves the nodes of copy after the ones of lst
+    const ulong *firstCopied = &copy.Front();
+    lst.Append(std::move(copy));
+    tst = tst && copy.Empty() && (lst.Size() == 2 * count) && (&lst[count] == firstCopied) && (lst.Back() == count - 1);
+
+    // Splice at the front, in the middle and at the end
+    lasd::List<ulong> front;
+    front.InsertAtBack(100UL);
+    front.InsertAtBack(101UL);
+    lasd::List<ulong> middle;
+    middle.InsertAtBack(200UL);
+    lasd::List<ulong> back;
+    back.InsertAtBack(300UL);
+    lasd::List<ulong> empty;
+
+    lst.Splice(0, std::move(front));
+    lst.Splice(count + 2, std::move(middle));
+    lst.Splice(lst.Size(), std::move(back));
+    lst.Splice(1, std::move(empty));
+    tst = tst && front.Empty() && middle.Empty() && back.Empty();
+    tst = tst && (lst.Size() == 2 * count + 4) && (lst[0] == 100) && (lst[1] == 101) && (lst[2] == 0);
+    tst = tst && (lst[count + 1] == count - 1) && (lst[count + 2] == 200) && (lst[count + 3] == 0) && (lst.Back() == 300);
+
+    // Backward links must agree with the forward ones after every splice
+    lasd::List<ulong> reversed;
+    lst.PreOrderTraverse([&reversed](const ulong &val)
+                         { reversed.InsertAtFront(val); });
+    lasd::List<ulong> backward;
+    lst.PostOrderTraverse([&backward](const ulong &val)
+                          { backward.InsertAtBack(val); });
+    tst = tst && (backward == reversed);
+
+    try
+    {
+      lst.Splice(lst.Size() + 1, std::move(empty));
+      tst = false; // Splicing past the end must throw
+    }
+    catch (std::out_of_range &)
+    {
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Lists whose nodes come from a PoolAllocator: churn, copies, moves and splices
+template <typename Data>
+void ListPoolAllocatorTest(uint &testnum, uint &testerr, ulong count, const Data &val)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") List with pooled nodes, churn on " << count << " elements: ";
+
+    lasd::List<Data, lasd::PoolAllocator> pooled;
+    lasd::List<Data> reference;
+    for (ulong round = 0; round < 3; round++)
+    {
+      // Grow at both ends, then shrink from both ends: released slots get reused
+      for (ulong i = 0; i < count; i++)
+      {
+        pooled.InsertAtBack(val);
+        reference.InsertAtBack(val);
+        pooled.InsertAtFront(Data());
+        reference.InsertAtFront(Data());
+      }
+      for (ulong i = 0; i < count / 2; i++)
+      {
+        pooled.RemoveFromFront();
+        reference.RemoveFromFront();
+        tst = tst && (pooled.BackNRemove() == reference.BackNRemove());
+      }
+    }
+    tst = tst && (pooled.Size() == reference.Size());
+    for (ulong i = 0; i < pooled.Size(); i += count / 4 + 1)
+    {
+      tst = tst && (pooled[i] == reference[i]);
+    }
+
+    // Copies own their storage, moves carry it along
+    lasd::List<Data, lasd::PoolAllocator> copy(pooled);
+    lasd::List<Data, lasd::PoolAllocator> assigned;
+    assigned.InsertAtBack(val);
+    assigned = copy;
+    lasd::List<Data, lasd::PoolAllocator> moved(std::move(copy));
+    tst = tst && copy.Empty() && (moved == pooled) && (assigned == pooled);
+
+    // Splicing adopts the blocks of the source list, which can then go away
+    {
+      lasd::List<Data, lasd::PoolAllocator> source;
+      source.InsertAtBack(val);
+      source.InsertAtBack(Data());
+      moved.Append(std::move(source));
+    }
+    tst = tst && (moved.Size() == pooled.Size() + 2) && (moved.Back() == Data());
+    moved.RemoveFromBack();
+    tst = tst && (moved.Back() == val);
+
+    // Clear drops every block, the list stays usable
+    pooled.Clear();
+    tst = tst && pooled.Empty();
+    pooled.InsertAtBack(val);
+    tst = tst && (pooled.Size() == 1) && (pooled.Front() == val);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
 /* ************************************************************************** */
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,248 @@
+#ifndef MYUNROLLEDLISTTEST_HPP
+#define MYUNROLLEDLISTTEST_HPP
+
+#include <vector>
+
+#include "../../../list/unrolled/unrolledlist.hpp"
+#include "../../../set/lst/setlst.hpp"
+
+/* ************************************************************************** */
+
+// Extended UnrolledList test functions
+
+// Random mix of end and positional operations mirrored on a std::vector
+template <ulong NodeCapacity>
+void UnrolledListRandomOperations(uint &testnum, uint &testerr, ulong operations)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") UnrolledList with " << NodeCapacity << " elements per node, "
+              << operations << " random operations: ";
+
+    lasd::UnrolledList<long, NodeCapacity> lst;
+    std::vector<long> mirror;
+    ulong seed = 12345;
+
+    for (ulong i = 0; i < operations && tst; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      ulong choice = (seed >> 33) % 8;
+      long value = static_cast<long>(i);
+      ulong index = mirror.empty() ? 0 : (seed >> 13) % (mirror.size() + 1);
+
+      if (choice == 0)
+      {
+        lst.InsertAtFront(value);
+        mirror.insert(mirror.begin(), value);
+      }
+      else if (choice <= 2)
+      {
+        lst.InsertAtBack(value);
+        mirror.push_back(value);
+      }
+      else if (choice <= 4)
+      {
+        lst.InsertAt(index, value);
+        mirror.insert(mirror.begin() + index, value);
+      }
+      else if (!mirror.empty())
+      {
+        if (choice == 5)
+        {
+          tst = (lst.FrontNRemove() == mirror.front());
+          mirror.erase(mirror.begin());
+        }
+        else if (choice == 6)
+        {
+          tst = (lst.BackNRemove() == mirror.back());
+          mirror.pop_back();
+        }
+        else
+        {
+          index = index % mirror.size();
+          lst.RemoveAt(index);
+          mirror.erase(mirror.begin() + index);
+        }
+      }
+
+      if (i % 64 == 0 && !mirror.empty())
+      {
+        ulong probe = (seed >> 7) % mirror.size();
+        tst = tst && (lst.Size() == mirror.size()) && (lst[probe] == mirror[probe]) &&
+              (lst.Front() == mirror.front()) && (lst.Back() == mirror.back());
+      }
+    }
+
+    // Full forward and backward comparison
+    ulong position = 0;
+    lst.PreOrderTraverse([&](const long &val)
+                         { tst = tst && (position < mirror.size()) && (val == mirror[position++]); });
+    lst.PostOrderTraverse([&](const long &val)
+                          { tst = tst && (position > 0) && (val == mirror[--position]); });
+    tst = tst && (lst.Size() == mirror.size()) && (position == 0);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Copies, moves, equality across different node layouts, self-referencing inserts
+template <typename Data>
+void UnrolledListValueSemantics(uint &testnum, uint &testerr, const Data &first, const Data &second, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") UnrolledList copy, move and equality: ";
+
+    lasd::UnrolledList<Data> lst;
+    for (ulong i = 0; i < count; i++)
+    {
+      lst.InsertAtBack((i % 2 == 0) ? first : second);
+    }
+
+    // Same sequence built from the front: different node boundaries, equal lists
+    lasd::UnrolledList<Data> reversed;
+    lst.PostOrderTraverse([&reversed](const Data &val)
+                          { reversed.InsertAtFront(val); });
+    tst = tst && (reversed == lst);
+
+    lasd::UnrolledList<Data> copy(lst);
+    lasd::UnrolledList<Data> assigned;
+    assigned.InsertAtBack(second);
+    assigned = lst;
+    lasd::UnrolledList<Data> moved(std::move(copy));
+    tst = tst && copy.Empty() && (moved == lst) && (assigned == lst);
+
+    // Inserting an element of the list itself, including when a split moves it
+    lst.InsertAt(count / 2, lst.Back());
+    lst.InsertAtFront(lst[count / 2]);
+    lst.InsertAtBack(lst.Front());
+    tst = tst && (lst.Size() == count + 3) && (lst.Front() == lst.Back()) && (lst != moved);
+
+    // Built from another container
+    lasd::UnrolledList<Data> fromTraversable(moved);
+    lasd::List<Data> asList(moved);
+    lasd::UnrolledList<Data> fromList(asList);
+    lasd::UnrolledList<Data> fromMappable(std::move(asList));
+    tst = tst && (fromList == moved) && (fromMappable == moved) && (fromTraversable == moved);
+
+    moved.Clear();
+    tst = tst && moved.Empty() && (moved.Size() == 0);
+
+    // Errors on empty containers and out-of-range positions
+    ulong thrown = 0;
+    try
+    {
+      moved.RemoveFromBack();
+    }
+    catch (std::length_error &)
+    {
+      thrown++;
+    }
+    try
+    {
+      lst.InsertAt(lst.Size() + 1, first);
+    }
+    catch (std::out_of_range &)
+    {
+      thrown++;
+    }
+    try
+    {
+      lst.RemoveAt(lst.Size());
+    }
+    catch (std::out_of_range &)
+    {
+      thrown++;
+    }
+    tst = tst && (thrown == 3);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// A sorted set kept in an UnrolledList (binary search + InsertAt/RemoveAt) matches SetLst
+inline void UnrolledListSortedSet(uint &testnum, uint &testerr, ulong operations)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") UnrolledList as a sorted set against SetLst: ";
+
+    lasd::UnrolledList<int> sorted;
+    lasd::SetLst<int> set;
+    ulong seed = 99;
+
+    for (ulong i = 0; i < operations; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      int key = static_cast<int>((seed >> 33) % 500);
+
+      // Lower bound: first position whose element is not smaller than key
+      ulong left = 0;
+      ulong right = sorted.Size();
+      while (left < right)
+      {
+        ulong mid = left + (right - left) / 2;
+        if (sorted[mid] < key)
+        {
+          left = mid + 1;
+        }
+        else
+        {
+          right = mid;
+        }
+      }
+
+      if (left < sorted.Size() && sorted[left] == key)
+      {
+        sorted.RemoveAt(left);
+        tst = tst && set.Remove(key);
+      }
+      else
+      {
+        sorted.InsertAt(left, key);
+        tst = tst && set.Insert(key);
+      }
+    }
+
+    tst = tst && (set.Size() == sorted.Size());
+    ulong position = 0;
+    sorted.Traverse([&](const int &val)
+                    { tst = tst && (val == set[position++]); });
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+/* ************************************************************************** */
+
+#endif
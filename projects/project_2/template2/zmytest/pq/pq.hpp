@@ -1,7 +1,11 @@
 #ifndef MYPQTEST_HPP
 #define MYPQTEST_HPP
 
+#include <string>
+#include <utility>
+
 #include "../../pq/pq.hpp"
+#include "../container/traversable.hpp"
 
 /* ************************************************************************** */
 
@@ -608,6 +612,594 @@ void PQMoveConstructor(uint &testnum, uint &testerr, const lasd::Vector<Data> &d
   testerr += (1 - (uint)tst);
 }
 
+template <ulong Arity>
+void PQArityAgainstBinary(uint &testnum, uint &testerr, ulong operations)
+{
+  bool tst = true;
+  testnum++;
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") PQHeap<long, " << Arity << "> against the binary PQHeap on " << operations << " random operations: ";
+    lasd::PQHeap<long, Arity> pq;
+    lasd::PQHeap<long> binary;
+    ulong seed = 86420;
+    for (ulong i = 0; i < operations && tst; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      const long key = static_cast<long>((seed >> 33) % 1000);
+      if ((seed >> 20) % 3 != 0 || binary.Empty())
+      {
+        pq.Insert(key);
+        binary.Insert(key);
+      }
+      else
+      {
+        tst = (pq.TipNRemove() == binary.TipNRemove());
+      }
+      tst = tst && (pq.Size() == binary.Size()) && (pq.Empty() || pq.Tip() == binary.Tip());
+    }
+
+    // Change anywhere, then the queue must still drain in non-increasing order
+    for (ulong i = 0; i < operations / 10 && !pq.Empty(); i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      pq.Change((seed >> 33) % pq.Size(), static_cast<long>((seed >> 13) % 1000));
+    }
+    const ulong count = pq.Size();
+    long previous = 1000;
+    ulong drained = 0;
+    while (!pq.Empty() && tst)
+    {
+      long current = pq.TipNRemove();
+      tst = (current <= previous);
+      previous = current;
+      drained++;
+    }
+    tst = tst && (drained == count);
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "\"" << exc.what() << "\": " << "Error!" << std::endl;
+  }
+  testerr += (1 - (uint)tst);
+}
+
+// Comparator with a run-time direction: a stateful ordering
+struct PQDirection
+{
+  bool ascending = false;
+
+  bool operator()(const long &left, const long &right) const noexcept { return ascending ? right < left : left < right; }
+};
+
+// Min-priority queue through std::greater, checked against the max-priority
+// queue of the negated keys; then a stateful comparator and the heap sort
+template <ulong Arity>
+void PQMinOrderAgainstNegated(uint &testnum, uint &testerr, ulong operations)
+{
+  bool tst = true;
+  testnum++;
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") PQHeap<long, " << Arity << ", std::greater> against negated keys on " << operations << " random operations: ";
+    lasd::PQHeap<long, Arity, std::greater<long>> pq;
+    lasd::PQHeap<long, Arity> negated;
+    ulong seed = 11235;
+    for (ulong i = 0; i < operations && tst; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      const long key = static_cast<long>((seed >> 33) % 1000);
+      switch ((seed >> 20) % 4)
+      {
+      case 0:
+        if (!pq.Empty())
+        {
+          const ulong index = (seed >> 40) % pq.Size();
+          negated.Change(index, -key); // Both heaps hold the same shape: slot by slot negations
+          pq.Change(index, key);
+          break;
+        }
+        [[fallthrough]];
+      case 1:
+      case 2:
+        pq.Insert(key);
+        negated.Insert(-key);
+        break;
+      default:
+        if (!pq.Empty())
+        {
+          tst = (pq.TipNRemove() == -negated.TipNRemove());
+        }
+        break;
+      }
+      tst = tst && (pq.Size() == negated.Size()) && (pq.Empty() || pq.Tip() == -negated.Tip());
+    }
+
+    // Stateful comparator: the same queue type drains either way
+    lasd::PQHeap<long, Arity, PQDirection> up(PQDirection{true});
+    lasd::PQHeap<long, Arity, PQDirection> down;
+    for (long i = 0; i < 100; i++)
+    {
+      up.Insert((i * 37) % 100);
+      down.Insert((i * 37) % 100);
+    }
+    for (long i = 0; i < 100 && tst; i++)
+    {
+      tst = (up.TipNRemove() == i) && (down.TipNRemove() == 99 - i);
+    }
+    tst = tst && up.Comparator().ascending && !down.Comparator().ascending;
+
+    // Heap sort follows the comparator: std::greater sorts descending
+    lasd::Vector<long> keys(1000);
+    for (ulong i = 0; i < keys.Size(); i++)
+    {
+      keys[i] = static_cast<long>((i * 7919) % 1000);
+    }
+    lasd::HeapVec<long, Arity, std::greater<long>> heap(keys);
+    tst = tst && heap.IsHeap() && (heap[0] == 0);
+    heap.Sort();
+    for (ulong i = 0; i < heap.Size() && tst; i++)
+    {
+      tst = (heap[i] == static_cast<long>(heap.Size() - 1 - i));
+    }
+
+    // Stateless comparators take no space
+    tst = tst && (sizeof(lasd::PQHeap<long, Arity, std::greater<long>>) == sizeof(lasd::PQHeap<long, Arity>));
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "\"" << exc.what() << "\": " << "Error!" << std::endl;
+  }
+  testerr += (1 - (uint)tst);
+}
+
+// Long strings (heap-allocated payloads) through the hole-based sifts: every
+// removal must hand back an intact string, in non-increasing order
+inline void PQStringDrain(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") PQHeap<string> drain of " << count << " long random strings: ";
+    lasd::PQHeap<std::string> pq;
+    ulong seed = 1357;
+    ulong totalLength = 0;
+    for (ulong i = 0; i < count; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      std::string key = std::to_string((seed >> 33) % (count * 4)) + std::string(32, 'x'); // Past the small string buffer
+      totalLength += key.size();
+      pq.Insert(std::move(key));
+    }
+
+    std::string previous = pq.Tip();
+    ulong drainedLength = 0;
+    while (!pq.Empty() && tst)
+    {
+      std::string current = pq.TipNRemove();
+      tst = !(previous < current) && (current.size() > 32);
+      drainedLength += current.size();
+      previous = std::move(current);
+    }
+    tst = tst && (drainedLength == totalLength);
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "\"" << exc.what() << "\": " << "Error!" << std::endl;
+  }
+  testerr += (1 - (uint)tst);
+}
+
+// Addressable queue against a reference table of (handle, value, alive): random
+// Push, TipNRemove, ChangeKey (both ways), Remove and bulk Change; every tip
+// removed must be the largest live value and every live handle must still name
+// its own value
+template <ulong Arity>
+void PQIndexedAgainstReference(uint &testnum, uint &testerr, ulong operations)
+{
+  bool tst = true;
+  testnum++;
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") PQIndexed<long, " << Arity << "> against a reference table on " << operations << " random operations: ";
+    lasd::PQIndexed<long, Arity> pq;
+    lasd::Vector<ulong> handles;
+    lasd::Vector<long> values;
+    lasd::Vector<bool> alive;
+    ulong live = 0;
+
+    // Every live handle names its value, every dead one is refused, the heap holds
+    const auto check = [&]()
+    {
+      bool ok = (pq.Size() == live);
+      for (ulong i = 0; i < handles.Size() && ok; i++)
+      {
+        ok = (pq.Contains(handles[i]) == alive[i]) && (!alive[i] || pq.Value(handles[i]) == values[i]);
+      }
+      for (ulong i = 1; i < pq.Size() && ok; i++)
+      {
+        ok = !(pq[(i - 1) / Arity] < pq[i]);
+      }
+      return ok;
+    };
+
+    // Index in the table of a random live element (or handles.Size() when none)
+    ulong seed = 24680;
+    const auto anyLive = [&]()
+    {
+      if (live == 0)
+      {
+        return handles.Size();
+      }
+      ulong i = (seed >> 24) % handles.Size();
+      while (!alive[i])
+      {
+        i = (i + 1) % handles.Size();
+      }
+      return i;
+    };
+
+    for (ulong op = 0; op < operations && tst; op++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      const long key = static_cast<long>((seed >> 33) % 10000);
+      const ulong target = anyLive();
+      switch ((seed >> 16) % 8)
+      {
+      case 0:
+      case 1:
+      case 2:
+        handles.PushBack(pq.Push(key));
+        values.PushBack(key);
+        alive.PushBack(true);
+        live++;
+        break;
+      case 3:
+        if (live > 0)
+        {
+          const ulong tip = pq.TipHandle();
+          const long value = pq.TipNRemove();
+          for (ulong i = 0; i < handles.Size() && tst; i++)
+          {
+            tst = !alive[i] || values[i] <= value;
+            if (handles[i] == tip)
+            {
+              tst = tst && alive[i] && values[i] == value;
+              alive[i] = false;
+            }
+          }
+          live--;
+        }
+        break;
+      case 4:
+      case 5:
+        if (target < handles.Size())
+        {
+          pq.ChangeKey(handles[target], key);
+          values[target] = key;
+        }
+        break;
+      case 6:
+        if (target < handles.Size())
+        {
+          pq.Remove(handles[target]);
+          alive[target] = false;
+          live--;
+        }
+        break;
+      default:
+        if (live > 0)
+        {
+          const ulong index = (seed >> 40) % pq.Size();
+          const ulong handle = pq.HandleAt(index);
+          pq.Change(index, key); // By heap position: the handle follows the element
+          for (ulong i = 0; i < handles.Size(); i++)
+          {
+            if (handles[i] == handle)
+            {
+              values[i] = key;
+            }
+          }
+        }
+        break;
+      }
+      if (op % 256 == 0)
+      {
+        tst = tst && check();
+      }
+    }
+    tst = tst && check();
+
+    // Drain: non-increasing, and every handle ends stale
+    long previous = 10000;
+    while (!pq.Empty() && tst)
+    {
+      const long current = pq.TipNRemove();
+      tst = (current <= previous);
+      previous = current;
+    }
+    for (ulong i = 0; i < handles.Size() && tst; i++)
+    {
+      tst = !pq.Contains(handles[i]);
+    }
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "\"" << exc.what() << "\": " << "Error!" << std::endl;
+  }
+  testerr += (1 - (uint)tst);
+}
+
+// Handle lifetime: removed, popped and cleared elements leave stale handles
+// that are refused even once their slot is reused; copies keep the handles;
+// the bulk constructors hand out handles through HandleAt
+inline void PQIndexedHandles(uint &testnum, uint &testerr)
+{
+  bool tst = true;
+  testnum++;
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") PQIndexed handle lifetime: ";
+    lasd::PQIndexed<long> pq;
+    const ulong ten = pq.Push(10);
+    const ulong twenty = pq.Push(20);
+    const ulong five = pq.Push(5);
+    tst = (pq.Tip() == 20) && (pq.TipHandle() == twenty) && pq.Contains(ten) && (pq.Value(five) == 5);
+
+    // Removed: stale, and the slot reused by the next Push is a new handle
+    pq.Remove(ten);
+    const ulong reused = pq.Push(7);
+    tst = tst && !pq.Contains(ten) && pq.Contains(reused) && (reused != ten) && ((reused & 0xFFFFFFFFUL) == (ten & 0xFFFFFFFFUL));
+    const auto refused = [&](auto operation)
+    {
+      try
+      {
+        operation();
+      }
+      catch (std::out_of_range &)
+      {
+        return true;
+      }
+      return false;
+    };
+    tst = tst && refused([&]() { pq.Value(ten); }) && refused([&]() { pq.ChangeKey(ten, 1); }) && refused([&]() { pq.Remove(ten); });
+    tst = tst && refused([&]() { pq.Value(~0UL); }) && refused([&]() { pq.HandleAt(pq.Size()); }) && (pq.Value(reused) == 7);
+
+    // Popped: the tip handle goes stale
+    tst = tst && (pq.TipNRemove() == 20) && !pq.Contains(twenty) && (pq.TipHandle() == reused);
+
+    // ChangeKey either way moves the element, the handle follows
+    pq.ChangeKey(five, 50);
+    tst = tst && (pq.TipHandle() == five) && (pq.Tip() == 50);
+    pq.ChangeKey(five, 1);
+    tst = tst && (pq.TipHandle() == reused) && (pq.Value(five) == 1);
+
+    // Copies keep the handles; the copy and the original then evolve apart
+    lasd::PQIndexed<long> copy(pq);
+    copy.Remove(five);
+    tst = tst && pq.Contains(five) && !copy.Contains(five) && (copy.Value(reused) == 7);
+    lasd::PQIndexed<long> moved(std::move(copy));
+    tst = tst && moved.Contains(reused) && copy.Empty() && !copy.Contains(reused);
+
+    // Clear: every handle stale, the slots are reused lowest first
+    pq.Clear();
+    tst = tst && pq.Empty() && !pq.Contains(five) && !pq.Contains(reused);
+    const ulong fresh = pq.Push(3);
+    tst = tst && ((fresh & 0xFFFFFFFFUL) == 0) && (fresh != ten) && (pq.Value(fresh) == 3);
+    pq.RemoveTip();
+    try
+    {
+      pq.TipHandle();
+      tst = false;
+    }
+    catch (std::length_error &)
+    {
+    }
+
+    // Bulk load: one heapify pass, each element reachable through its handle
+    lasd::Vector<long> keys(100);
+    for (ulong i = 0; i < keys.Size(); i++)
+    {
+      keys[i] = static_cast<long>((i * 37) % 100);
+    }
+    lasd::PQIndexed<long, 3, std::greater<long>> bulk(keys);
+    tst = tst && (bulk.Size() == 100) && (bulk.Tip() == 0);
+    lasd::Vector<ulong> bulkHandles(bulk.Size());
+    for (ulong i = 0; i < bulk.Size(); i++)
+    {
+      bulkHandles[i] = bulk.HandleAt(i);
+    }
+    bulk.ChangeKey(bulk.HandleAt(bulk.Size() - 1), -1); // A leaf becomes the tip
+    tst = tst && (bulk.Tip() == -1);
+    long previous = -1;
+    ulong drained = 0;
+    while (!bulk.Empty() && tst)
+    {
+      const long current = bulk.TipNRemove();
+      tst = (previous <= current);
+      previous = current;
+      drained++;
+    }
+    tst = tst && (drained == 100);
+    for (ulong i = 0; i < bulkHandles.Size() && tst; i++)
+    {
+      tst = !bulk.Contains(bulkHandles[i]);
+    }
+
+    // Stateless comparators take no space
+    tst = tst && (sizeof(lasd::PQIndexed<long, 2, std::greater<long>>) == sizeof(lasd::PQIndexed<long>));
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "\"" << exc.what() << "\": " << "Error!" << std::endl;
+  }
+  testerr += (1 - (uint)tst);
+}
+
+// Dijkstra on a random graph: decrease-key on PQIndexed must give the same
+// distances as lazy deletion on PQHeap (stale entries skipped when popped),
+// while holding at most one entry per vertex
+inline void PQIndexedDijkstra(uint &testnum, uint &testerr, ulong vertices, ulong degree)
+{
+  bool tst = true;
+  testnum++;
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") PQIndexed Dijkstra against lazy deletion on " << vertices << " vertices: ";
+    using Item = std::pair<long, ulong>; // (distance, vertex), smallest distance first
+    lasd::Vector<ulong> targets(vertices * degree);
+    lasd::Vector<long> weights(vertices * degree);
+    ulong seed = 97531;
+    for (ulong i = 0; i < targets.Size(); i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      targets[i] = (seed >> 33) % vertices;
+      weights[i] = static_cast<long>((seed >> 13) % 100) + 1;
+    }
+    const long unreached = -1;
+
+    lasd::Vector<long> lazy(vertices);
+    lasd::PQHeap<Item, 2, std::greater<Item>> heap;
+    for (ulong v = 0; v < vertices; v++)
+    {
+      lazy[v] = unreached;
+    }
+    lazy[0] = 0;
+    heap.Insert(Item(0, 0));
+    while (!heap.Empty())
+    {
+      const Item item = heap.TipNRemove();
+      if (item.first != lazy[item.second])
+      {
+        continue; // Superseded by a shorter path
+      }
+      for (ulong e = item.second * degree; e < (item.second + 1) * degree; e++)
+      {
+        const long distance = item.first + weights[e];
+        if (lazy[targets[e]] == unreached || distance < lazy[targets[e]])
+        {
+          lazy[targets[e]] = distance;
+          heap.Insert(Item(distance, targets[e]));
+        }
+      }
+    }
+
+    lasd::Vector<long> indexed(vertices);
+    lasd::Vector<ulong> handles(vertices);
+    lasd::Vector<bool> settled(vertices);
+    lasd::PQIndexed<Item, 2, std::greater<Item>> pq;
+    for (ulong v = 0; v < vertices; v++)
+    {
+      indexed[v] = unreached;
+      settled[v] = false;
+    }
+    indexed[0] = 0;
+    handles[0] = pq.Push(Item(0, 0));
+    ulong peak = 1;
+    while (!pq.Empty() && tst)
+    {
+      const Item item = pq.TipNRemove();
+      settled[item.second] = true;
+      tst = (item.first == indexed[item.second]);
+      for (ulong e = item.second * degree; e < (item.second + 1) * degree; e++)
+      {
+        const ulong target = targets[e];
+        const long distance = item.first + weights[e];
+        if (settled[target])
+        {
+          continue;
+        }
+        if (indexed[target] == unreached)
+        {
+          handles[target] = pq.Push(Item(distance, target));
+          indexed[target] = distance;
+        }
+        else if (distance < indexed[target])
+        {
+          pq.ChangeKey(handles[target], Item(distance, target)); // Decrease-key in place
+          indexed[target] = distance;
+        }
+      }
+      peak = (pq.Size() > peak) ? pq.Size() : peak;
+    }
+
+    for (ulong v = 0; v < vertices && tst; v++)
+    {
+      tst = (indexed[v] == lazy[v]);
+    }
+    tst = tst && (peak <= vertices);
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "\"" << exc.what() << "\": " << "Error!" << std::endl;
+  }
+  testerr += (1 - (uint)tst);
+}
+
+// Long strings through ChangeKey and Remove: the moves must hand every
+// string back intact, in non-increasing order
+inline void PQIndexedStrings(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") PQIndexed<string> ChangeKey and Remove on " << count << " long strings: ";
+    lasd::PQIndexed<std::string, 4> pq;
+    lasd::Vector<ulong> handles(count);
+    ulong seed = 8642;
+    for (ulong i = 0; i < count; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      handles[i] = pq.Push(std::to_string((seed >> 33) % (count * 4)) + std::string(32, 'x'));
+    }
+    ulong kept = count;
+    for (ulong i = 0; i < count; i += 3)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      std::string key = std::to_string((seed >> 33) % (count * 4)) + std::string(32, 'y');
+      pq.ChangeKey(handles[i], std::move(key));
+      tst = tst && (pq.Value(handles[i]).back() == 'y');
+      if (i + 1 < count)
+      {
+        pq.Remove(handles[i + 1]);
+        kept--;
+      }
+    }
+
+    tst = tst && (pq.Size() == kept);
+    std::string previous = pq.Tip();
+    while (!pq.Empty() && tst)
+    {
+      std::string current = pq.TipNRemove();
+      tst = !(previous < current) && (current.size() > 32);
+      previous = std::move(current);
+      kept--;
+    }
+    tst = tst && (kept == 0);
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "\"" << exc.what() << "\": " << "Error!" << std::endl;
+  }
+  testerr += (1 - (uint)tst);
+}
+
 /* ************************************************************************** */
 
 // Complete test functions for different data types
@@ -697,6 +1289,21 @@ void mytestPQInt(uint &testnum, uint &testerr)
     // Test Insert-Remove sequence
     PQInsertRemoveSequence<int>(loctestnum, loctesterr, 30, 10, 20);
 
+    // Test wider nodes
+    PQArityAgainstBinary<4>(loctestnum, loctesterr, 100000);
+    PQArityAgainstBinary<8>(loctestnum, loctesterr, 100000);
+    PQArityAgainstBinary<5>(loctestnum, loctesterr, 1000);
+
+    // Test custom orderings
+    PQMinOrderAgainstNegated<2>(loctestnum, loctesterr, 100000);
+    PQMinOrderAgainstNegated<4>(loctestnum, loctesterr, 100000);
+
+    // Test addressable queue
+    PQIndexedAgainstReference<2>(loctestnum, loctesterr, 20000);
+    PQIndexedAgainstReference<4>(loctestnum, loctesterr, 20000);
+    PQIndexedHandles(loctestnum, loctesterr);
+    PQIndexedDijkstra(loctestnum, loctesterr, 20000, 6);
+
     // Test copy and move constructors
     PQCopyConstructor<int>(loctestnum, loctesterr, stressData);
     PQMoveConstructor<int>(loctestnum, loctesterr, stressData);
@@ -705,6 +1312,9 @@ void mytestPQInt(uint &testnum, uint &testerr)
     lasd::PQHeap<int> consistencyPQ(stressData);
     PQSizeConsistency<int>(loctestnum, loctesterr, consistencyPQ, consistencyPQ.Size());
     PQEmptyConsistency<int>(loctestnum, loctesterr, consistencyPQ, false);
+    ForEachReduceConsistency<int>(loctestnum, loctesterr, consistencyPQ);
+    IteratorTraverseConsistency<int>(loctestnum, loctesterr, consistencyPQ);
+    TraverseWhileEarlyExit<int>(loctestnum, loctesterr, consistencyPQ);
   }
   catch (...)
   {
@@ -798,6 +1408,8 @@ void mytestPQString(uint &testnum, uint &testerr)
 
     // Test Insert-Remove sequence
     PQInsertRemoveSequence<std::string>(loctestnum, loctesterr, std::string("charlie"), std::string("alpha"), std::string("bravo"));
+    PQStringDrain(loctestnum, loctesterr, 2000);
+    PQIndexedStrings(loctestnum, loctesterr, 2000);
 
     // Test copy and move constructors
     PQCopyConstructor<std::string>(loctestnum, loctesterr, strStressData);
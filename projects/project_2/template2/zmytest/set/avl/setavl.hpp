@@ -0,0 +1,72 @@
+#ifndef MYSETAVLTEST_HPP
+#define MYSETAVLTEST_HPP
+
+#include "../../../set/avl/setavl.hpp"
+#include <cmath>
+
+/* ************************************************************************** */
+
+// Extended SetAvl test functions
+
+// Ascending inserts (a plain search tree degenerates into a list) and removals
+// must keep the height within the AVL bound; the tree-shaped visits see every node
+template <template <typename> class Allocator>
+void SetAvlShape(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SetAvl height and tree visits after " << count << " ascending inserts: ";
+
+    lasd::SetAvl<long, Allocator> set;
+    for (ulong i = 0; i < count; i++)
+    {
+      set.Insert(static_cast<long>(i));
+    }
+    tst = (set.Size() == count) && (set.Height() <= 1.45 * std::log2(count + 2.0));
+
+    for (ulong i = 0; i < count; i += 2)
+    {
+      set.Remove(static_cast<long>(i));
+    }
+    tst = tst && (set.Size() == count / 2) && (set.Height() <= 1.45 * std::log2(count / 2 + 2.0));
+
+    // In-order is ascending and agrees with Traverse
+    ulong index = 0;
+    set.InOrderTraverse([&tst, &set, &index](const long &val)
+                        { tst = tst && (set[index++] == val); });
+    tst = tst && (index == set.Size());
+
+    // Pre-order starts and post-order ends at the root
+    ulong preCount = 0;
+    ulong postCount = 0;
+    long preFirst = -1;
+    long postLast = -1;
+    set.TreePreOrderTraverse([&preCount, &preFirst](const long &val)
+                             {
+                               if (preCount++ == 0)
+                               {
+                                 preFirst = val;
+                               } });
+    set.TreePostOrderTraverse([&postCount, &postLast](const long &val)
+                              {
+                                postCount++;
+                                postLast = val; });
+    tst = tst && (preCount == set.Size()) && (postCount == set.Size()) && (preFirst == postLast);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef MYSETBTREETEST_HPP
+#define MYSETBTREETEST_HPP
+
+#include "../../../set/btree/setbtree.hpp"
+
+/* ************************************************************************** */
+
+// Extended SetBTree test functions
+
+// Range walks along the leaf chain after random updates, checked against
+// positional access: bounds inside, between and outside the stored keys
+template <ulong NodeCapacity>
+void SetBTreeRange(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SetBTree<long, " << NodeCapacity << "> TraverseRange on " << count << " keys after random removals: ";
+
+    lasd::SetBTree<long, NodeCapacity> set;
+    ulong seed = 4213;
+    for (ulong i = 0; i < count; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      set.Insert(static_cast<long>((seed >> 33) % (4 * count)));
+    }
+    for (ulong i = 0; i < count / 2; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      set.Remove(static_cast<long>((seed >> 33) % (4 * count)));
+    }
+
+    for (ulong round = 0; round < 50 && tst; round++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      long low = static_cast<long>((seed >> 33) % (4 * count + 2)) - 1;
+      long high = low + static_cast<long>((seed >> 13) % (count / 4 + 1));
+
+      // Expected run: first rank not below low, then every rank up to high
+      ulong rank = 0;
+      while (rank < set.Size() && set[rank] < low)
+      {
+        rank++;
+      }
+      set.TraverseRange(low, high, [&tst, &set, &rank](const long &val)
+                        { tst = tst && (rank < set.Size()) && (set[rank++] == val); });
+      tst = tst && (rank == set.Size() || high < set[rank]);
+    }
+
+    // An empty range and a range over everything
+    ulong visited = 0;
+    set.TraverseRange(1, 0, [&visited](const long &)
+                      { visited++; });
+    tst = tst && (visited == 0);
+    set.TraverseRange(-1, static_cast<long>(4 * count), [&visited](const long &)
+                      { visited++; });
+    tst = tst && (visited == set.Size());
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+/* ************************************************************************** */
+
+#endif
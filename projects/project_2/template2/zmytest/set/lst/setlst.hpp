@@ -9,8 +9,8 @@
 // Extended SetLst test functions
 
 // Test insertion with duplicates (should reject duplicates)
-template <typename Data>
-void SetLstInsertDuplicates(uint &testnum, uint &testerr, lasd::SetLst<Data> &set, const Data &val)
+template <typename Data, template <typename> class Allocator>
+void SetLstInsertDuplicates(uint &testnum, uint &testerr, lasd::SetLst<Data, Allocator> &set, const Data &val)
 {
   bool tst = true;
   testnum++;
@@ -43,8 +43,8 @@ void SetLstInsertDuplicates(uint &testnum, uint &testerr, lasd::SetLst<Data> &se
 }
 
 // Test order maintenance through series of operations
-template <typename Data>
-void SetLstOrderMaintenance(uint &testnum, uint &testerr, lasd::SetLst<Data> &set,
+template <typename Data, template <typename> class Allocator>
+void SetLstOrderMaintenance(uint &testnum, uint &testerr, lasd::SetLst<Data, Allocator> &set,
                             const Data &val1, const Data &val2, const Data &val3)
 {
   if (!(val1 < val2 && val2 < val3))
@@ -128,8 +128,8 @@ void SetLstOrderMaintenance(uint &testnum, uint &testerr, lasd::SetLst<Data> &se
 }
 
 // Test remove operations and their effect on the set structure
-template <typename Data>
-void SetLstRemoveOperations(uint &testnum, uint &testerr, lasd::SetLst<Data> &set,
+template <typename Data, template <typename> class Allocator>
+void SetLstRemoveOperations(uint &testnum, uint &testerr, lasd::SetLst<Data, Allocator> &set,
                             const Data &val1, const Data &val2, const Data &val3)
 {
   if (!(val1 < val2 && val2 < val3))
@@ -185,8 +185,8 @@ void SetLstRemoveOperations(uint &testnum, uint &testerr, lasd::SetLst<Data> &se
 }
 
 // Test predecessor and successor removal operations
-template <typename Data>
-void SetLstPredSuccOperations(uint &testnum, uint &testerr, lasd::SetLst<Data> &set,
+template <typename Data, template <typename> class Allocator>
+void SetLstPredSuccOperations(uint &testnum, uint &testerr, lasd::SetLst<Data, Allocator> &set,
                               const Data &val1, const Data &val2, const Data &val3)
 {
   if (!(val1 < val2 && val2 < val3))
@@ -251,8 +251,8 @@ void SetLstPredSuccOperations(uint &testnum, uint &testerr, lasd::SetLst<Data> &
 }
 
 // Test Min/Max operations and their effect on the set
-template <typename Data>
-void SetLstMinMaxOperations(uint &testnum, uint &testerr, lasd::SetLst<Data> &set,
+template <typename Data, template <typename> class Allocator>
+void SetLstMinMaxOperations(uint &testnum, uint &testerr, lasd::SetLst<Data, Allocator> &set,
                             const Data &val1, const Data &val2, const Data &val3)
 {
   if (!(val1 < val2 && val2 < val3))
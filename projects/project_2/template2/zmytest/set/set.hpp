@@ -1,6 +1,11 @@
 #ifndef MYSETTEST_HPP
 #define MYSETTEST_HPP
 
+#include <bit>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
 #include "../../set/set.hpp"
 #include "../../set/lst/setlst.hpp"
 #include "../../set/vec/setvec.hpp"
@@ -327,6 +332,498 @@ void SetOrderStressTest(uint &testnum, uint &testerr, lasd::Set<Data> &set)
   testerr += (1 - (uint)tst);
 }
 
+// Random mix of every ordered operation, checked step by step against SetVec
+template <typename SetType>
+void SetAgainstSetVec(uint &testnum, uint &testerr, const std::string &name, ulong universe, ulong operations)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") " << name << " against SetVec, " << operations << " random operations on " << universe << " keys: ";
+
+    SetType set;
+    lasd::SetVec<long> vec;
+    ulong seed = 97531;
+
+    for (ulong i = 0; i < operations && tst; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      const long key = static_cast<long>((seed >> 33) % universe);
+
+      // Both must agree on the result or on throwing
+      bool setThrew = false;
+      bool vecThrew = false;
+      long setValue = 0;
+      long vecValue = 0;
+
+      switch ((seed >> 20) % 8)
+      {
+      case 0:
+      case 1:
+        tst = (set.Insert(key) == vec.Insert(key));
+        break;
+      case 2:
+        tst = (set.Remove(key) == vec.Remove(key));
+        break;
+      case 3:
+        tst = (set.Exists(key) == vec.Exists(key));
+        break;
+      case 4:
+        try
+        {
+          setValue = set.PredecessorNRemove(key);
+        }
+        catch (std::length_error &)
+        {
+          setThrew = true;
+        }
+        try
+        {
+          vecValue = vec.PredecessorNRemove(key);
+        }
+        catch (std::length_error &)
+        {
+          vecThrew = true;
+        }
+        tst = (setThrew == vecThrew) && (setValue == vecValue);
+        break;
+      case 5:
+        try
+        {
+          setValue = set.Successor(key);
+        }
+        catch (std::length_error &)
+        {
+          setThrew = true;
+        }
+        try
+        {
+          vecValue = vec.Successor(key);
+        }
+        catch (std::length_error &)
+        {
+          vecThrew = true;
+        }
+        tst = (setThrew == vecThrew) && (setValue == vecValue);
+        break;
+      case 6:
+        if (!set.Empty())
+        {
+          tst = (set.MaxNRemove() == vec.MaxNRemove());
+        }
+        break;
+      default:
+        if (!set.Empty())
+        {
+          tst = (set.Min() == vec.Min());
+          set.RemoveMin();
+          vec.RemoveMin();
+        }
+        break;
+      }
+      tst = tst && (set.Size() == vec.Size());
+    }
+
+    // Same contents, in the same order, from both ends
+    for (ulong i = 0; i < set.Size() && tst; i++)
+    {
+      tst = (set[i] == vec[i]);
+    }
+    ulong index = set.Size();
+    set.PostOrderTraverse([&tst, &vec, &index](const long &val)
+                           { tst = tst && (val == vec[--index]); });
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Set ordered by std::greater, checked step by step against an ascending
+// SetVec: its Min is the other's Max, its Predecessor the other's Successor
+template <typename SetType>
+void SetReversedAgainstSetVec(uint &testnum, uint &testerr, const std::string &name, ulong universe, ulong operations)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") " << name << " (std::greater) against SetVec, " << operations << " random operations on " << universe << " keys: ";
+
+    SetType set;
+    lasd::SetVec<long> vec;
+    ulong seed = 24601;
+
+    for (ulong i = 0; i < operations && tst; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      const long key = static_cast<long>((seed >> 33) % universe);
+
+      bool setThrew = false;
+      bool vecThrew = false;
+      long setValue = 0;
+      long vecValue = 0;
+
+      switch ((seed >> 20) % 6)
+      {
+      case 0:
+      case 1:
+        tst = (set.Insert(key) == vec.Insert(key));
+        break;
+      case 2:
+        tst = (set.Remove(key) == vec.Remove(key)) && (set.Exists(key) == vec.Exists(key));
+        break;
+      case 3:
+        try
+        {
+          setValue = set.Predecessor(key);
+        }
+        catch (std::length_error &)
+        {
+          setThrew = true;
+        }
+        try
+        {
+          vecValue = vec.Successor(key);
+        }
+        catch (std::length_error &)
+        {
+          vecThrew = true;
+        }
+        tst = (setThrew == vecThrew) && (setValue == vecValue);
+        break;
+      case 4:
+        try
+        {
+          setValue = set.SuccessorNRemove(key);
+        }
+        catch (std::length_error &)
+        {
+          setThrew = true;
+        }
+        try
+        {
+          vecValue = vec.PredecessorNRemove(key);
+        }
+        catch (std::length_error &)
+        {
+          vecThrew = true;
+        }
+        tst = (setThrew == vecThrew) && (setValue == vecValue);
+        break;
+      default:
+        if (!set.Empty())
+        {
+          tst = (set.Min() == vec.Max()) && (set.MaxNRemove() == vec.MinNRemove());
+        }
+        break;
+      }
+      tst = tst && (set.Size() == vec.Size());
+    }
+
+    // Same contents in opposite orders
+    for (ulong i = 0; i < set.Size() && tst; i++)
+    {
+      tst = (set[i] == vec[vec.Size() - 1 - i]);
+    }
+
+    // Bulk loading and batches sort by the same ordering
+    lasd::Vector<long> batch(universe);
+    for (ulong i = 0; i < universe; i++)
+    {
+      batch[i] = static_cast<long>(i % (universe / 2 + 1));
+    }
+    SetType built(batch);
+    tst = tst && (built.Size() == universe / 2 + 1) && (built.Min() == static_cast<long>(universe / 2)) && (built.Max() == 0);
+    tst = tst && !set.InsertAll(batch) && (set.Size() >= built.Size());
+
+    lasd::Vector<long> descending(3);
+    descending[0] = 9;
+    descending[1] = 4;
+    descending[2] = 4;
+    SetType sorted = SetType::FromSorted(descending);
+    tst = tst && (sorted.Size() == 2) && (sorted.Min() == 9);
+    bool thrown = false;
+    try
+    {
+      descending[2] = 10;
+      SetType::FromSorted(descending);
+    }
+    catch (std::invalid_argument &)
+    {
+      thrown = true;
+    }
+    tst = tst && thrown;
+
+    // Stateless orderings take no space
+    tst = tst && (sizeof(lasd::SetVec<long, std::greater<long>>) == sizeof(lasd::SetVec<long>));
+    tst = tst && (sizeof(lasd::SetLst<long, lasd::HeapAllocator, std::greater<long>>) == sizeof(lasd::SetLst<long>));
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Record ordered by its key only, through a projection
+struct SetRecord
+{
+  long key = 0;
+  std::string name;
+
+  bool operator==(const SetRecord &) const = default;
+};
+
+using SetRecordByKey = lasd::ProjectedOrder<long SetRecord::*>;
+
+// Records with the same key are the same element, whatever the rest holds
+template <typename SetType>
+void SetProjectedOrder(uint &testnum, uint &testerr, const std::string &name)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") " << name << " of records ordered by a projected key: ";
+
+    SetType set(SetRecordByKey{&SetRecord::key});
+    tst = set.Insert(SetRecord{3, "three"}) && set.Insert(SetRecord{1, "one"}) && set.Insert(SetRecord{2, "two"});
+    tst = tst && !set.Insert(SetRecord{3, "other three"}) && (set.Size() == 3);
+    tst = tst && set.Exists(SetRecord{2, ""}) && !set.Exists(SetRecord{4, "two"});
+    tst = tst && (set.Min().name == "one") && (set.Max().name == "three") && (set.Successor(SetRecord{1, ""}).name == "two");
+    tst = tst && set.Remove(SetRecord{3, ""}) && (set.Size() == 2) && (set.Max().name == "two");
+    tst = tst && (set.Comparator().projection == &SetRecord::key);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Test bulk construction and FromSorted against sets built by repeated Insert
+template <typename SetType>
+void SetBulkConstruction(uint &testnum, uint &testerr, const std::string &name, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") " << name << " bulk construction of " << count << " values with duplicates: ";
+
+    lasd::SortableVector<long> input(count);
+    ulong seed = 24681357;
+    for (ulong i = 0; i < count; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      input[i] = static_cast<long>((seed >> 33) % (count / 2 + 1)); // About half the values repeat
+    }
+
+    SetType inserted;
+    for (ulong i = 0; i < count; i++)
+    {
+      inserted.Insert(input[i]);
+    }
+
+    const SetType copied(input);
+    tst = (copied == inserted) && (copied.Size() == inserted.Size());
+    for (ulong i = 1; i < copied.Size() && tst; i++)
+    {
+      tst = (copied[i - 1] < copied[i]); // Strictly ascending: no duplicate survived
+    }
+
+    lasd::SortableVector<long> movable(input);
+    const SetType moved(std::move(movable));
+    tst = tst && (moved == inserted);
+
+    input.Sort();
+    const SetType fromSorted = SetType::FromSorted(input);
+    tst = tst && (fromSorted == inserted);
+
+    lasd::SortableVector<long> movableSorted(input);
+    const SetType fromSortedMoved = SetType::FromSorted(std::move(movableSorted));
+    tst = tst && (fromSortedMoved == inserted);
+
+    // Unsorted input is rejected
+    if (count > 1 && input[0] != input[count - 1])
+    {
+      std::swap(input[0], input[count - 1]);
+      bool thrown = false;
+      try
+      {
+        SetType rejected = SetType::FromSorted(input);
+      }
+      catch (std::invalid_argument &)
+      {
+        thrown = true;
+      }
+      tst = tst && thrown;
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Test the merge-based batched operations against the one-call-per-element base versions
+template <typename SetType>
+void SetBatchOperations(uint &testnum, uint &testerr, const std::string &name, ulong universe, ulong batchSize, ulong rounds)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") " << name << " batched InsertAll/RemoveAll/InsertSome/RemoveSome, " << rounds << " rounds of " << batchSize << ": ";
+
+    SetType merged;
+    SetType reference;
+    ulong seed = 13579;
+
+    for (ulong round = 0; round < rounds && tst; round++)
+    {
+      lasd::Vector<long> batch(batchSize);
+      for (ulong i = 0; i < batchSize; i++)
+      {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        batch[i] = static_cast<long>((seed >> 33) % universe); // Overlaps the set and repeats itself
+      }
+
+      bool fast = false;
+      bool slow = false;
+      switch (round % 6)
+      {
+      case 0:
+        fast = merged.InsertAll(batch);
+        slow = reference.lasd::DictionaryContainer<long>::InsertAll(batch);
+        break;
+      case 1:
+      {
+        lasd::Vector<long> moved(batch);
+        fast = merged.InsertSome(std::move(moved));
+        slow = reference.lasd::DictionaryContainer<long>::InsertSome(batch);
+        break;
+      }
+      case 2:
+        fast = merged.RemoveSome(batch);
+        slow = reference.lasd::DictionaryContainer<long>::RemoveSome(batch);
+        break;
+      case 3:
+      {
+        lasd::Vector<long> moved(batch);
+        fast = merged.InsertAll(std::move(moved));
+        slow = reference.lasd::DictionaryContainer<long>::InsertAll(batch);
+        break;
+      }
+      case 4:
+        fast = merged.RemoveAll(batch);
+        slow = reference.lasd::DictionaryContainer<long>::RemoveAll(batch);
+        break;
+      default:
+        fast = merged.InsertSome(batch);
+        slow = reference.lasd::DictionaryContainer<long>::InsertSome(batch);
+        break;
+      }
+      tst = (fast == slow) && (merged == reference) && (merged.Size() == reference.Size());
+      for (ulong i = 1; i < merged.Size() && tst; i++)
+      {
+        tst = (merged[i - 1] < merged[i]);
+      }
+    }
+
+    // The batch may be the set itself
+    SetType self(merged);
+    tst = tst && (self.InsertAll(self) == self.Empty()) && (self == merged);
+    tst = tst && self.RemoveAll(self) && self.Empty();
+
+    // An empty batch inserts everything and removes nothing
+    lasd::Vector<long> empty;
+    tst = tst && merged.InsertAll(empty) && merged.RemoveAll(empty) && !merged.InsertSome(empty) && !merged.RemoveSome(empty);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Repeated one-key batches into a SetVec: the array grows geometrically, so it
+// moves about log2(batches) times rather than once per batch
+inline void SetVecSmallBatches(uint &testnum, uint &testerr, ulong count, ulong batches)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SetVec " << batches << " one-key InsertSome batches on " << count << " keys: ";
+
+    lasd::Vector<long> keys(count);
+    for (ulong i = 0; i < count; i++)
+    {
+      keys[i] = static_cast<long>(2 * i);
+    }
+    lasd::SetVec<long> set = lasd::SetVec<long>::FromSorted(keys);
+
+    lasd::Vector<long> batch(1);
+    ulong moves = 0;
+    const long *storage = &*set.begin();
+    for (ulong b = 0; b < batches && tst; b++)
+    {
+      batch[0] = static_cast<long>(2 * (count + b)); // Ascending: each batch appends one key
+      tst = set.InsertSome(batch) && !set.InsertSome(batch);
+      if (&*set.begin() != storage)
+      {
+        moves++;
+        storage = &*set.begin();
+      }
+    }
+    tst = tst && (set.Size() == count + batches) && (moves <= 2 + std::bit_width(batches));
+    for (ulong i = 0; i < set.Size() && tst; i++)
+    {
+      tst = (set[i] == static_cast<long>(2 * i));
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
 /* ************************************************************************** */
 
 #endif
\ No newline at end of file
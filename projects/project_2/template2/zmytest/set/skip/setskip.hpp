@@ -0,0 +1,63 @@
+#ifndef MYSETSKIPTEST_HPP
+#define MYSETSKIPTEST_HPP
+
+#include "../../../set/skip/setskip.hpp"
+#include <stdexcept>
+
+/* ************************************************************************** */
+
+// Extended SetSkip test functions
+
+// Positional access through the spans after inserts and removals in random order
+inline void SetSkipRankAccess(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SetSkip operator[] on " << count << " keys after random removals: ";
+
+    lasd::SetSkip<long> skip;
+    ulong seed = 8642;
+    for (ulong i = 0; i < count; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      skip.Insert(static_cast<long>((seed >> 33) % (4 * count)));
+    }
+    for (ulong i = 0; i < count / 2; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      skip.Remove(static_cast<long>((seed >> 33) % (4 * count)));
+    }
+
+    ulong index = 0;
+    skip.Traverse([&tst, &skip, &index](const long &val)
+                  { tst = tst && (skip[index++] == val); });
+    tst = tst && (index == skip.Size());
+
+    bool thrown = false;
+    try
+    {
+      skip[skip.Size()];
+    }
+    catch (std::out_of_range &)
+    {
+      thrown = true;
+    }
+    tst = tst && thrown;
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+/* ************************************************************************** */
+
+#endif
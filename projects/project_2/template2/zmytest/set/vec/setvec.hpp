@@ -391,6 +391,116 @@ void SetVecFromTraversable(uint &testnum, uint &testerr, const lasd::Traversable
   testerr += (1 - (uint)tst);
 }
 
+// Two SetVecs under the same random updates, one searching the sorted elements
+// and one the Eytzinger shadow: every lookup must agree, including the throws,
+// and the shadow must follow updates, copies and the switch back
+template <typename Data>
+void SetVecLayoutAgreement(uint &testnum, uint &testerr, const std::string &name, ulong universe, ulong operations)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SetVec<" << name << "> Sorted and Eytzinger lookups agree, " << operations << " random operations on " << universe << " keys: ";
+
+    lasd::SetVec<Data> sorted;
+    lasd::SetVec<Data> indexed;
+    indexed.Layout(lasd::SearchLayout::Eytzinger);
+    tst = (sorted.Layout() == lasd::SearchLayout::Sorted) && (indexed.Layout() == lasd::SearchLayout::Eytzinger) && !indexed.Exists(Data(1));
+    ulong seed = 11235;
+
+    for (ulong i = 0; i < operations && tst; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      const Data key = static_cast<Data>((seed >> 33) % universe) / 2; // Halves for floating point
+
+      bool sortedThrew = false;
+      bool indexedThrew = false;
+      Data sortedValue{};
+      Data indexedValue{};
+
+      switch ((seed >> 20) % 6)
+      {
+      case 0:
+        tst = (sorted.Insert(key) == indexed.Insert(key));
+        break;
+      case 1:
+        tst = (sorted.Remove(key) == indexed.Remove(key));
+        break;
+      case 2:
+        tst = (sorted.Exists(key) == indexed.Exists(key));
+        break;
+      case 3:
+        try
+        {
+          sortedValue = sorted.Predecessor(key);
+        }
+        catch (std::length_error &)
+        {
+          sortedThrew = true;
+        }
+        try
+        {
+          indexedValue = indexed.Predecessor(key);
+        }
+        catch (std::length_error &)
+        {
+          indexedThrew = true;
+        }
+        tst = (sortedThrew == indexedThrew) && (sortedValue == indexedValue);
+        break;
+      case 4:
+        try
+        {
+          sortedValue = sorted.Successor(key);
+        }
+        catch (std::length_error &)
+        {
+          sortedThrew = true;
+        }
+        try
+        {
+          indexedValue = indexed.Successor(key);
+        }
+        catch (std::length_error &)
+        {
+          indexedThrew = true;
+        }
+        tst = (sortedThrew == indexedThrew) && (sortedValue == indexedValue);
+        break;
+      default:
+        if (!sorted.Empty() && (i % 2 == 0))
+        {
+          tst = (sorted.MinNRemove() == indexed.MinNRemove());
+        }
+        else
+        {
+          lasd::SetVec<Data> copy(indexed); // Keeps the layout, builds its own shadow
+          tst = (copy.Layout() == lasd::SearchLayout::Eytzinger) && (copy == sorted) && (copy.Exists(key) == sorted.Exists(key));
+        }
+        break;
+      }
+      tst = tst && (sorted.Size() == indexed.Size());
+    }
+
+    indexed.Layout(lasd::SearchLayout::Sorted);
+    for (ulong i = 0; i < sorted.Size() && tst; i++)
+    {
+      tst = indexed.Exists(sorted[i]);
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
 /* ************************************************************************** */
 
-#endif
\ No newline at end of file
+#endif
@@ -16,16 +16,23 @@
 
 #include "../vector/vector.hpp"
 #include "../list/list.hpp"
+#include "../list/unrolled/unrolledlist.hpp"
 
 #include "../set/set.hpp"
 #include "../set/lst/setlst.hpp"
 #include "../set/vec/setvec.hpp"
+#include "../set/skip/setskip.hpp"
+#include "../set/avl/setavl.hpp"
+#include "../set/btree/setbtree.hpp"
+
+#include "../hashset/hashset.hpp"
 
 #include "../heap/heap.hpp"
 #include "../heap/vec/heapvec.hpp"
 
 #include "../pq/pq.hpp"
 #include "../pq/heap/pqheap.hpp"
+#include "../pq/indexed/pqindexed.hpp"
 
 /* ************************************************************************** */
 
@@ -35,11 +42,18 @@
 #include "./container/linear.hpp"
 
 #include "./list/list.hpp"
+#include "./list/unrolled/unrolledlist.hpp"
 #include "./vector/vector.hpp"
 
 #include "./set/set.hpp"
 #include "./set/lst/setlst.hpp"
 #include "./set/vec/setvec.hpp"
+#include "./set/skip/setskip.hpp"
+#include "./set/avl/setavl.hpp"
+#include "./set/btree/setbtree.hpp"
+
+#include "./container/dictionary.hpp"
+#include "./hashset/hashset.hpp"
 
 #include "./heap/heap.hpp"
 #include "./pq/pq.hpp"
@@ -79,6 +93,18 @@ void testExercise1A(uint &testnum, uint &testerr)
      PreOrderFoldConsistency(testnum, testerr, intList);
      PostOrderFoldConsistency(testnum, testerr, intList);
      ListTraversalOrders(testnum, testerr, intList);
+     ForEachReduceConsistency<int>(testnum, testerr, intList);
+     lasd::List<int> mapList(intList);
+     MapInPlaceConsistency<int>(testnum, testerr, mapList, 1);
+     IteratorTraverseConsistency<int>(testnum, testerr, intList);
+     TraverseWhileEarlyExit<int>(testnum, testerr, intList);
+     IteratorMapConsistency<int>(testnum, testerr, mapList, 1);
+     ListDequeTest(testnum, testerr, 200000);
+     ListDeepPostOrderTest(testnum, testerr, 2000000);
+     ListCopySpliceTest(testnum, testerr, 1000);
+     ListCopySpliceTest(testnum, testerr, 1000000);
+     ListPoolAllocatorTest<long>(testnum, testerr, 10000, 7);
+     ListPoolAllocatorTest<string>(testnum, testerr, 2000, string("pooled"));
 
      // Test testable container operations
      ExistsEdgeCase<int>(testnum, testerr, intList, true, 0, string("Minimum value"));
@@ -128,8 +154,19 @@ void testExercise1A(uint &testnum, uint &testerr)
      VectorAccessTest(testnum, testerr, intVec, 55);
      VectorClearTest(testnum, testerr, intVec);
 
+     // Test capacity management
+     VectorCapacityTest(testnum, testerr, 7, 0, 1000);
+     VectorCapacityTest(testnum, testerr, string("payload"), string(), 100);
+     VectorNoDefaultConstructorTest(testnum, testerr, 64);
+
      // Test mappable operations
      MapEmpty(testnum, testerr, intVec);
+     ForEachReduceConsistency<int>(testnum, testerr, intVec);
+     lasd::Vector<int> mapVec(intVec);
+     MapInPlaceConsistency<int>(testnum, testerr, mapVec, 1);
+     IteratorTraverseConsistency<int>(testnum, testerr, intVec);
+     TraverseWhileEarlyExit<int>(testnum, testerr, intVec);
+     IteratorMapConsistency<int>(testnum, testerr, mapVec, 1);
 
      // Refill vector
      intVec.Resize(5);
@@ -157,6 +194,21 @@ void testExercise1A(uint &testnum, uint &testerr)
 
      SortableVectorSortTest(testnum, testerr, sortVec);
      SortAlreadySortedVectorTest(testnum, testerr, sortVec);
+     SortableVectorPatternsTest(testnum, testerr, 100000);
+     SortableVectorStableSortTest(testnum, testerr);
+     SortableVectorParallelSortTest(testnum, testerr, 100000, 4);
+     SortableVectorParallelSortTest(testnum, testerr, 1001, 3);
+     SortableVectorParallelStringTest(testnum, testerr, 20000, 8, 10);
+     SortableVectorParallelStringTest(testnum, testerr, 20000, 16, 10);
+     SortableVectorParallelThrowTest(testnum, testerr, 20000, 8);
+     SortableVectorComparatorTest(testnum, testerr, 10000);
+     VectorRangesTest(testnum, testerr, 100000);
+     VectorRangesTest(testnum, testerr, 0);
+     VectorThrowingCopyTest(testnum, testerr);
+     VectorKernelsTest<int>(testnum, testerr, string("int"));
+     VectorKernelsTest<long>(testnum, testerr, string("long"));
+     VectorKernelsTest<float>(testnum, testerr, string("float"));
+     VectorKernelsTest<double>(testnum, testerr, string("double"));
 
      // Test String List
      cout << endl
@@ -187,6 +239,32 @@ void testExercise1A(uint &testnum, uint &testerr)
      string suffix = "suffix";
      MapPreOrderEquivalence(testnum, testerr, strList, suffix);
      MapPostOrderEquivalence(testnum, testerr, strList, suffix);
+
+     // Test UnrolledList
+     cout << endl
+          << "Test UnrolledList" << endl;
+
+     lasd::UnrolledList<int> intUnrolled(intList);
+
+     FoldTraverseConsistency(testnum, testerr, intUnrolled);
+     PreOrderFoldConsistency(testnum, testerr, intUnrolled);
+     PostOrderFoldConsistency(testnum, testerr, intUnrolled);
+     AccessBoundaryElements(testnum, testerr, intUnrolled);
+     AccessOutOfRange(testnum, testerr, intUnrolled);
+     MapPreOrderEquivalence(testnum, testerr, intUnrolled, 3);
+     MapPostOrderEquivalence(testnum, testerr, intUnrolled, 3);
+     ForEachReduceConsistency<int>(testnum, testerr, intUnrolled);
+     MapInPlaceConsistency<int>(testnum, testerr, intUnrolled, 1);
+     IteratorTraverseConsistency<int>(testnum, testerr, intUnrolled);
+     TraverseWhileEarlyExit<int>(testnum, testerr, intUnrolled);
+     IteratorMapConsistency<int>(testnum, testerr, intUnrolled, 1);
+
+     UnrolledListRandomOperations<2>(testnum, testerr, 5000);
+     UnrolledListRandomOperations<5>(testnum, testerr, 20000);
+     UnrolledListRandomOperations<64>(testnum, testerr, 100000);
+     UnrolledListValueSemantics<int>(testnum, testerr, 1, 2, 1000);
+     UnrolledListValueSemantics<string>(testnum, testerr, string("first"), string("second"), 100);
+     UnrolledListSortedSet(testnum, testerr, 20000);
 }
 
 // Test functions for Exercise 1B - Sets
@@ -218,6 +296,24 @@ void testExercise1B(uint &testnum, uint &testerr)
 
      // Test min/max operations
      SetLstMinMaxOperations(testnum, testerr, intSetLst, 100, 200, 300);
+     intSetLst.Insert(7);
+     intSetLst.Insert(3);
+     ForEachReduceConsistency<int>(testnum, testerr, intSetLst);
+     IteratorTraverseConsistency<int>(testnum, testerr, intSetLst);
+     TraverseWhileEarlyExit<int>(testnum, testerr, intSetLst);
+
+     // Same operations on a SetLst whose nodes come from a pool
+     cout << endl
+          << "Test Integer SetLst with pooled nodes" << endl;
+
+     lasd::SetLst<int, lasd::PoolAllocator> poolSetLst;
+     SetLstInsertDuplicates(testnum, testerr, poolSetLst, 42);
+     SetLstOrderMaintenance(testnum, testerr, poolSetLst, 10, 20, 30);
+     SetLstRemoveOperations(testnum, testerr, poolSetLst, 15, 25, 35);
+     SetLstPredSuccOperations(testnum, testerr, poolSetLst, 5, 15, 25);
+     SetLstMinMaxOperations(testnum, testerr, poolSetLst, 100, 200, 300);
+     IteratorTraverseConsistency<int>(testnum, testerr, poolSetLst);
+     TraverseWhileEarlyExit<int>(testnum, testerr, poolSetLst);
 
      // Test Integer SetVec
      cout << endl
@@ -239,6 +335,9 @@ void testExercise1B(uint &testnum, uint &testerr)
 
      // Test removal operations
      SetVecRemoval(testnum, testerr, intSetVec, 50, 60, 70);
+     ForEachReduceConsistency<int>(testnum, testerr, intSetVec);
+     IteratorTraverseConsistency<int>(testnum, testerr, intSetVec);
+     TraverseWhileEarlyExit<int>(testnum, testerr, intSetVec);
 
      // Create a test container for SetVecFromTraversable
      lasd::List<int> testContainer;
@@ -251,6 +350,66 @@ void testExercise1B(uint &testnum, uint &testerr)
 
      SetVecFromTraversable(testnum, testerr, testContainer);
 
+     // Lookup engines
+     SetVecLayoutAgreement<int>(testnum, testerr, "int", 64, 20000);
+     SetVecLayoutAgreement<int>(testnum, testerr, "int", 5000, 100000);
+     SetVecLayoutAgreement<double>(testnum, testerr, "double", 5000, 100000);
+     SetVecLayoutAgreement<long>(testnum, testerr, "long", 1000000, 100000);
+
+     // Test Integer SetSkip
+     cout << endl
+          << "Test Integer SetSkip" << endl;
+
+     lasd::SetSkip<int> intSetSkip;
+     SetBoundaryTests(testnum, testerr, intSetSkip, 1, 1000);
+     SetOrderStressTest(testnum, testerr, intSetSkip);
+     intSetSkip.Insert(7);
+     intSetSkip.Insert(3);
+     ForEachReduceConsistency<int>(testnum, testerr, intSetSkip);
+     IteratorTraverseConsistency<int>(testnum, testerr, intSetSkip);
+     TraverseWhileEarlyExit<int>(testnum, testerr, intSetSkip);
+     SetAgainstSetVec<lasd::SetSkip<long>>(testnum, testerr, "SetSkip", 64, 20000);
+     SetAgainstSetVec<lasd::SetSkip<long>>(testnum, testerr, "SetSkip", 5000, 100000);
+     SetSkipRankAccess(testnum, testerr, 20000);
+
+     // Test Integer SetAvl
+     cout << endl
+          << "Test Integer SetAvl" << endl;
+
+     lasd::SetAvl<int> intSetAvl;
+     SetBoundaryTests(testnum, testerr, intSetAvl, 1, 1000);
+     SetOrderStressTest(testnum, testerr, intSetAvl);
+     intSetAvl.Insert(7);
+     intSetAvl.Insert(3);
+     ForEachReduceConsistency<int>(testnum, testerr, intSetAvl);
+     IteratorTraverseConsistency<int>(testnum, testerr, intSetAvl);
+     TraverseWhileEarlyExit<int>(testnum, testerr, intSetAvl);
+     SetAgainstSetVec<lasd::SetAvl<long>>(testnum, testerr, "SetAvl", 64, 20000);
+     SetAgainstSetVec<lasd::SetAvl<long>>(testnum, testerr, "SetAvl", 5000, 100000);
+     SetAgainstSetVec<lasd::SetAvl<long, lasd::PoolAllocator>>(testnum, testerr, "SetAvl (pool)", 5000, 100000);
+     SetAvlShape<lasd::HeapAllocator>(testnum, testerr, 1);
+     SetAvlShape<lasd::HeapAllocator>(testnum, testerr, 100000);
+     SetAvlShape<lasd::PoolAllocator>(testnum, testerr, 100000);
+
+     // Test Integer SetBTree
+     cout << endl
+          << "Test Integer SetBTree" << endl;
+
+     lasd::SetBTree<int> intSetBTree;
+     SetBoundaryTests(testnum, testerr, intSetBTree, 1, 1000);
+     SetOrderStressTest(testnum, testerr, intSetBTree);
+     intSetBTree.Insert(7);
+     intSetBTree.Insert(3);
+     ForEachReduceConsistency<int>(testnum, testerr, intSetBTree);
+     IteratorTraverseConsistency<int>(testnum, testerr, intSetBTree);
+     TraverseWhileEarlyExit<int>(testnum, testerr, intSetBTree);
+     SetAgainstSetVec<lasd::SetBTree<long>>(testnum, testerr, "SetBTree", 64, 20000);
+     SetAgainstSetVec<lasd::SetBTree<long>>(testnum, testerr, "SetBTree", 5000, 100000);
+     SetAgainstSetVec<lasd::SetBTree<long, 4>>(testnum, testerr, "SetBTree<long, 4>", 5000, 100000);
+     SetAgainstSetVec<lasd::SetBTree<long, 5>>(testnum, testerr, "SetBTree<long, 5>", 5000, 100000);
+     SetBTreeRange<4>(testnum, testerr, 20000);
+     SetBTreeRange<lasd::BTreeNodeCapacity<long>>(testnum, testerr, 20000);
+
      // Common Set tests
      cout << endl
           << "Common Set Tests" << endl;
@@ -266,6 +425,45 @@ void testExercise1B(uint &testnum, uint &testerr)
      SetOrderStressTest(testnum, testerr, intSetLst);
      SetOrderStressTest(testnum, testerr, intSetVec);
 
+     // Custom orderings
+     SetReversedAgainstSetVec<lasd::SetVec<long, std::greater<long>>>(testnum, testerr, "SetVec", 64, 20000);
+     SetReversedAgainstSetVec<lasd::SetVec<long, std::greater<long>>>(testnum, testerr, "SetVec", 5000, 100000);
+     SetReversedAgainstSetVec<lasd::SetLst<long, lasd::HeapAllocator, std::greater<long>>>(testnum, testerr, "SetLst", 64, 20000);
+     SetReversedAgainstSetVec<lasd::SetLst<long, lasd::PoolAllocator, std::greater<long>>>(testnum, testerr, "SetLst (pool)", 2000, 40000);
+     SetProjectedOrder<lasd::SetVec<SetRecord, SetRecordByKey>>(testnum, testerr, "SetVec");
+     SetProjectedOrder<lasd::SetLst<SetRecord, lasd::HeapAllocator, SetRecordByKey>>(testnum, testerr, "SetLst");
+
+     // Bulk construction
+     SetBulkConstruction<lasd::SetVec<long>>(testnum, testerr, "SetVec", 0);
+     SetBulkConstruction<lasd::SetVec<long>>(testnum, testerr, "SetVec", 1);
+     SetBulkConstruction<lasd::SetVec<long>>(testnum, testerr, "SetVec", 5000);
+     SetBulkConstruction<lasd::SetLst<long>>(testnum, testerr, "SetLst", 0);
+     SetBulkConstruction<lasd::SetLst<long>>(testnum, testerr, "SetLst", 1);
+     SetBulkConstruction<lasd::SetLst<long>>(testnum, testerr, "SetLst", 5000);
+     SetBulkConstruction<lasd::SetLst<long, lasd::PoolAllocator>>(testnum, testerr, "SetLst (pool)", 5000);
+     SetBulkConstruction<lasd::SetSkip<long>>(testnum, testerr, "SetSkip", 0);
+     SetBulkConstruction<lasd::SetSkip<long>>(testnum, testerr, "SetSkip", 1);
+     SetBulkConstruction<lasd::SetSkip<long>>(testnum, testerr, "SetSkip", 5000);
+     SetBulkConstruction<lasd::SetAvl<long>>(testnum, testerr, "SetAvl", 0);
+     SetBulkConstruction<lasd::SetAvl<long>>(testnum, testerr, "SetAvl", 1);
+     SetBulkConstruction<lasd::SetAvl<long>>(testnum, testerr, "SetAvl", 5000);
+     SetBulkConstruction<lasd::SetBTree<long>>(testnum, testerr, "SetBTree", 0);
+     SetBulkConstruction<lasd::SetBTree<long>>(testnum, testerr, "SetBTree", 1);
+     SetBulkConstruction<lasd::SetBTree<long>>(testnum, testerr, "SetBTree", 5000);
+
+     // Batched operations
+     SetBatchOperations<lasd::SetVec<long>>(testnum, testerr, "SetVec", 64, 16, 300);
+     SetBatchOperations<lasd::SetVec<long>>(testnum, testerr, "SetVec", 5000, 1000, 60);
+     SetVecSmallBatches(testnum, testerr, 100000, 3000);
+     SetBatchOperations<lasd::SetLst<long>>(testnum, testerr, "SetLst", 64, 16, 300);
+     SetBatchOperations<lasd::SetLst<long>>(testnum, testerr, "SetLst", 5000, 1000, 60);
+     SetBatchOperations<lasd::SetSkip<long>>(testnum, testerr, "SetSkip", 64, 16, 300);
+     SetBatchOperations<lasd::SetSkip<long>>(testnum, testerr, "SetSkip", 5000, 1000, 60);
+     SetBatchOperations<lasd::SetAvl<long>>(testnum, testerr, "SetAvl", 64, 16, 300);
+     SetBatchOperations<lasd::SetAvl<long>>(testnum, testerr, "SetAvl", 5000, 1000, 60);
+     SetBatchOperations<lasd::SetBTree<long>>(testnum, testerr, "SetBTree", 64, 16, 300);
+     SetBatchOperations<lasd::SetBTree<long>>(testnum, testerr, "SetBTree", 5000, 1000, 60);
+
      // Test String Sets
      cout << endl
           << "Test String Sets" << endl;
@@ -285,6 +483,36 @@ void testExercise1B(uint &testnum, uint &testerr)
      SetVecBinarySearch(testnum, testerr, strSetVec, alpha, beta, gamma);
 
      CompareSetImplementations(testnum, testerr, strSetLst, strSetVec);
+
+     lasd::SetSkip<string> strSetSkip;
+     SetBoundaryTests(testnum, testerr, strSetSkip, alpha, gamma);
+
+     lasd::SetAvl<string> strSetAvl;
+     SetBoundaryTests(testnum, testerr, strSetAvl, alpha, gamma);
+
+     lasd::SetBTree<string> strSetBTree;
+     SetBoundaryTests(testnum, testerr, strSetBTree, alpha, gamma);
+
+     // Test HashSet
+     cout << endl
+          << "Test HashSet" << endl;
+
+     lasd::HashSet<int> intHashSet;
+     InsertRemoveConsistency(testnum, testerr, intHashSet, 42);
+     for (int i = 0; i < 100; i++)
+     {
+          intHashSet.Insert(i * i);
+     }
+     ForEachReduceConsistency<int>(testnum, testerr, intHashSet);
+     TraverseWhileEarlyExit<int>(testnum, testerr, intHashSet);
+     HashSetAgainstSetVec<lasd::Hashable<long>>(testnum, testerr, "HashSet", 64, 20000);
+     HashSetAgainstSetVec<lasd::Hashable<long>>(testnum, testerr, "HashSet", 5000, 100000);
+     HashSetAgainstSetVec<HashSetBlockHash>(testnum, testerr, "HashSet (16 keys per hash)", 5000, 100000);
+     HashSetCapacity(testnum, testerr, 1);
+     HashSetCapacity(testnum, testerr, 50000);
+
+     lasd::HashSet<string> strHashSet;
+     InsertRemoveConsistency(testnum, testerr, strHashSet, alpha);
 }
 
 // Test functions for Exercise 2A - Heap
@@ -1,8 +1,16 @@
 #ifndef MYVECTORTEST_HPP
 #define MYVECTORTEST_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+
 #include "../../vector/vector.hpp"
 #include "../../list/list.hpp"
+#include "../../heap/vec/heapvec.hpp"
+#include "../../set/vec/setvec.hpp"
 
 /* ************************************************************************** */
 
@@ -459,6 +467,162 @@ void VectorClearTest(uint &testnum, uint &testerr, lasd::Vector<Data> &vec)
   testerr += (1 - (uint)tst);
 }
 
+// Test capacity management (PushBack, Reserve, ShrinkToFit)
+template <typename Data>
+void VectorCapacityTest(uint &testnum, uint &testerr, const Data &val, const Data &defaultVal, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") Vector capacity with " << count << " PushBack: ";
+
+    lasd::Vector<Data> vec;
+
+    // Repeated appends must keep the elements and grow the capacity geometrically
+    ulong reallocations = 0;
+    for (ulong i = 0; i < count; i++)
+    {
+      ulong oldCapacity = vec.Capacity();
+      vec.PushBack(val);
+      if (vec.Capacity() != oldCapacity)
+      {
+        reallocations++;
+      }
+      if (vec.Size() != i + 1 || vec.Capacity() < vec.Size())
+      {
+        tst = false;
+      }
+    }
+
+    ulong maxReallocations = 1;
+    for (ulong cap = 1; cap < count; cap *= 2)
+    {
+      maxReallocations++;
+    }
+    if (reallocations > maxReallocations)
+    {
+      tst = false;
+    }
+
+    // Shrinking and growing back within capacity must expose default values again
+    vec.Resize(count / 2);
+    vec.Resize(count);
+    for (ulong i = count / 2; i < count; i++)
+    {
+      if (vec[i] != defaultVal)
+      {
+        tst = false;
+        break;
+      }
+    }
+
+    // Reserve never loses elements, ShrinkToFit matches capacity to size
+    vec.Reserve(4 * count);
+    if (vec.Capacity() < 4 * count || vec.Size() != count || vec[0] != val)
+    {
+      tst = false;
+    }
+    vec.ShrinkToFit();
+    if (vec.Capacity() != vec.Size() || vec[0] != val)
+    {
+      tst = false;
+    }
+
+    // Copies only allocate what they hold
+    lasd::Vector<Data> copy(vec);
+    if (copy != vec || copy.Capacity() != copy.Size())
+    {
+      tst = false;
+    }
+
+    vec.Clear();
+    if (!vec.Empty() || vec.Capacity() != 0)
+    {
+      tst = false;
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Payload without a default constructor: storage must only construct what it holds
+struct NoDefaultPayload
+{
+  int value;
+
+  explicit NoDefaultPayload(int val) : value(val) {}
+
+  bool operator==(const NoDefaultPayload &other) const noexcept { return value == other.value; }
+  bool operator!=(const NoDefaultPayload &other) const noexcept { return value != other.value; }
+};
+
+// Test a vector of elements that cannot be default constructed
+inline void VectorNoDefaultConstructorTest(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") Vector of non default constructible elements: ";
+
+    lasd::Vector<NoDefaultPayload> vec;
+    for (ulong i = 0; i < count; i++)
+    {
+      vec.PushBack(NoDefaultPayload(static_cast<int>(i)));
+    }
+
+    // Self-referencing append while the storage is being relocated
+    vec.ShrinkToFit();
+    vec.PushBack(vec[0]);
+
+    lasd::Vector<NoDefaultPayload> copy(vec);
+    if (copy != vec || copy.Size() != count + 1 || copy.Back().value != 0)
+    {
+      tst = false;
+    }
+
+    // Shrinking only destroys, growing has nothing to build the new slots from
+    vec.Resize(count / 2);
+    if (vec.Size() != count / 2 || vec.Back().value != static_cast<int>(count / 2) - 1)
+    {
+      tst = false;
+    }
+
+    bool correctException = false;
+    try
+    {
+      vec.Resize(count);
+    }
+    catch (std::logic_error &)
+    {
+      correctException = true;
+    }
+    if (!correctException || vec.Size() != count / 2)
+    {
+      tst = false;
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
 /* ************************************************************************** */
 
 // Extended SortableVector test functions
@@ -607,4 +771,612 @@ void SortAlreadySortedVectorTest(uint &testnum, uint &testerr, lasd::SortableVec
 
 /* ************************************************************************** */
 
-#endif
\ No newline at end of file
+// Test Sort on large inputs with the shapes quicksort variants struggle with
+inline void SortableVectorPatternsTest(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SortableVector Sort on " << count << " random/sorted/reversed/duplicate elements: ";
+
+    for (int pattern = 0; pattern < 5 && tst; pattern++)
+    {
+      lasd::SortableVector<long> vec(count);
+      ulong seed = 12345;
+      for (ulong i = 0; i < count; i++)
+      {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL; // Deterministic pseudo-random sequence
+        switch (pattern)
+        {
+        case 0:
+          vec[i] = static_cast<long>(seed >> 33);
+          break;
+        case 1:
+          vec[i] = static_cast<long>(i);
+          break;
+        case 2:
+          vec[i] = static_cast<long>(count - i);
+          break;
+        case 3:
+          vec[i] = static_cast<long>((seed >> 33) % 4);
+          break;
+        default:
+          vec[i] = static_cast<long>(i % 2 == 0 ? i : count - i); // Organ pipe
+          break;
+        }
+      }
+
+      long checksum = vec.Fold<long>([](const long &val, const long &acc)
+                                     { return acc + val; }, 0);
+      vec.Sort();
+
+      for (ulong i = 1; i < count; i++)
+      {
+        if (vec[i] < vec[i - 1])
+        {
+          tst = false;
+          break;
+        }
+      }
+
+      if (checksum != vec.Fold<long>([](const long &val, const long &acc)
+                                     { return acc + val; }, 0))
+      {
+        tst = false; // Elements were lost or duplicated
+      }
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Test StableSort and comparator overloads (order by the first character only)
+inline void SortableVectorStableSortTest(uint &testnum, uint &testerr)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SortableVector StableSort and comparator Sort: ";
+
+    const ulong count = 200;
+    lasd::SortableVector<std::string> vec(count);
+    for (ulong i = 0; i < count; i++)
+    {
+      vec[i] = std::to_string(i); // Increasing suffixes...
+      vec[i].insert(vec[i].begin(), static_cast<char>('a' + (i * 7) % 5)); // ...behind one of five keys
+    }
+
+    auto byFirstChar = [](const std::string &left, const std::string &right)
+    { return left[0] < right[0]; };
+
+    vec.StableSort(byFirstChar);
+    for (ulong i = 1; i < count; i++)
+    {
+      if (vec[i][0] < vec[i - 1][0] ||
+          (vec[i][0] == vec[i - 1][0] && std::stoul(vec[i].substr(1)) < std::stoul(vec[i - 1].substr(1))))
+      {
+        tst = false; // Out of order, or equal keys lost their original order
+        break;
+      }
+    }
+
+    vec.Sort([](const std::string &left, const std::string &right)
+             { return left > right; });
+    for (ulong i = 1; i < count; i++)
+    {
+      if (vec[i - 1] < vec[i])
+      {
+        tst = false;
+        break;
+      }
+    }
+
+    vec.StableSort();
+    for (ulong i = 1; i < count; i++)
+    {
+      if (vec[i] < vec[i - 1])
+      {
+        tst = false;
+        break;
+      }
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Test ParallelSort against the sequential Sort
+inline void SortableVectorParallelSortTest(uint &testnum, uint &testerr, ulong count, ulong threads)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SortableVector ParallelSort of " << count << " elements on " << threads << " threads: ";
+
+    lasd::SortableVector<long> parallel(count);
+    ulong seed = 987654321;
+    for (ulong i = 0; i < count; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      parallel[i] = static_cast<long>((seed >> 33) % (count / 2 + 1)); // Random values with duplicates
+    }
+
+    lasd::SortableVector<long> sequential(parallel);
+    sequential.Sort();
+
+    parallel.ParallelSort(threads, 0); // Threshold 0: always take the parallel path
+    if (parallel != sequential)
+    {
+      tst = false;
+    }
+
+    // Descending order through a comparator
+    parallel.ParallelSort(threads, [](const long &left, const long &right)
+                          { return left > right; }, 0);
+    for (ulong i = 0; i < count; i++)
+    {
+      if (parallel[i] != sequential[count - 1 - i])
+      {
+        tst = false;
+        break;
+      }
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// ParallelSort of heap-allocated strings in descending order, repeated: a merge
+// piece comparing against elements another piece has already moved out (left
+// empty, hence last under std::greater) mis-sorts or corrupts the vector
+inline void SortableVectorParallelStringTest(uint &testnum, uint &testerr, ulong count, ulong threads, ulong repeats)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SortableVector<string> ParallelSort with std::greater of " << count << " elements on " << threads << " threads, " << repeats << " runs: ";
+
+    lasd::SortableVector<std::string> input(count);
+    ulong seed = 24681357;
+    for (ulong i = 0; i < count; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      input[i] = std::to_string((seed >> 33) % (count / 2 + 1)) + std::string(32, '.'); // Past the small string buffer
+    }
+
+    lasd::SortableVector<std::string> sequential(input);
+    sequential.Sort(std::greater<std::string>());
+
+    for (ulong run = 0; run < repeats && tst; run++)
+    {
+      lasd::SortableVector<std::string> parallel(input);
+      parallel.ParallelSort(threads, std::greater<std::string>(), 0);
+      tst = (parallel == sequential);
+
+      // The same through the ordering the vector is built with
+      lasd::SortableVector<std::string, std::greater<std::string>> ordered(input);
+      ordered.ParallelSort(threads, 0);
+      for (ulong i = 0; i < count && tst; i++)
+      {
+        tst = (ordered[i] == sequential[i]);
+      }
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// ParallelSort with a comparison that throws after a budget: once while the runs
+// are sorted, once during the last merge round. The exception must reach the
+// caller with every element alive and the merge buffer released (checked by the
+// leak sanitizer at exit); the vector then sorts normally
+inline void SortableVectorParallelThrowTest(uint &testnum, uint &testerr, ulong count, ulong threads)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SortableVector<string> ParallelSort with a throwing comparison on " << threads << " threads: ";
+
+    lasd::SortableVector<std::string> input(count);
+    ulong seed = 11223344;
+    for (ulong i = 0; i < count; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      input[i] = std::to_string((seed >> 33) % count) + std::string(32, '.'); // Past the small string buffer
+    }
+
+    std::atomic<ulong> comparisons = 0;
+    ulong budget = ~0UL;
+    const auto order = [&comparisons, &budget](const std::string &left, const std::string &right)
+    {
+      if (comparisons.fetch_add(1, std::memory_order_relaxed) >= budget)
+      {
+        throw std::runtime_error("comparison budget exhausted");
+      }
+      return left < right;
+    };
+
+    lasd::SortableVector<std::string> sorted(input);
+    sorted.ParallelSort(threads, order, 0);
+    const ulong total = comparisons;
+
+    const ulong budgets[] = {count / 4, total - count / 8}; // Inside a run sort, inside the last merge round
+    for (ulong limit : budgets)
+    {
+      lasd::SortableVector<std::string> vec(input);
+      comparisons = 0;
+      budget = limit;
+      bool thrown = false;
+      try
+      {
+        vec.ParallelSort(threads, order, 0);
+      }
+      catch (std::runtime_error &)
+      {
+        thrown = true;
+      }
+      budget = ~0UL;
+      tst = tst && thrown && (vec.Size() == count);
+
+      vec = input; // Every slot is still a live string: assignable and destructible
+      vec.ParallelSort(threads, order, 0);
+      tst = tst && (vec == sorted);
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Comparator with a run-time direction: a stateful ordering
+struct SortDirection
+{
+  bool descending = false;
+
+  bool operator()(const long &left, const long &right) const noexcept { return descending ? right < left : left < right; }
+};
+
+// Sort, StableSort and ParallelSort without arguments follow the comparator the vector was built with
+inline void SortableVectorComparatorTest(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SortableVector ordered by a stateful comparator, " << count << " elements: ";
+
+    lasd::SortableVector<long, SortDirection> vec(count, SortDirection{true});
+    auto fill = [&vec, count]()
+    {
+      ulong seed = 13579;
+      for (ulong i = 0; i < count; i++)
+      {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        vec[i] = static_cast<long>((seed >> 33) % (count / 4 + 1));
+      }
+    };
+    auto descending = [&vec, count]()
+    {
+      for (ulong i = 1; i < count; i++)
+      {
+        if (vec[i - 1] < vec[i])
+        {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    fill();
+    vec.Sort();
+    tst = descending();
+    fill();
+    vec.StableSort();
+    tst = tst && descending();
+    fill();
+    vec.ParallelSort(2, 0);
+    tst = tst && descending();
+
+    // The comparator travels with copies and assignments
+    lasd::SortableVector<long, SortDirection> copy(vec);
+    lasd::SortableVector<long, SortDirection> ascending(SortDirection{false});
+    tst = tst && copy.Comparator().descending && !ascending.Comparator().descending;
+    ascending = copy;
+    tst = tst && ascending.Comparator().descending;
+
+    // Stateless comparators take no space
+    tst = tst && (sizeof(lasd::SortableVector<long, std::greater<long>>) == sizeof(lasd::SortableVector<long>));
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Element whose copies throw once a shared budget runs out; its move may throw
+// too, so Vector relocates it by copying. live counts the existing instances
+struct VectorThrowingCopy
+{
+  std::string payload = std::string(32, '.'); // Heap-allocated: a leaked element shows up as a leak
+  static inline long live = 0;
+  static inline long budget = -1; // Copies left before one throws (negative: never)
+
+  VectorThrowingCopy() { live++; }
+  VectorThrowingCopy(const VectorThrowingCopy &other) : payload(other.payload)
+  {
+    if (budget == 0)
+    {
+      throw std::runtime_error("copy budget exhausted");
+    }
+    budget--;
+    live++;
+  }
+  VectorThrowingCopy(VectorThrowingCopy &&other) noexcept(false) : VectorThrowingCopy(other) {}
+  ~VectorThrowingCopy() { live--; }
+
+  VectorThrowingCopy &operator=(const VectorThrowingCopy &) = default;
+  bool operator==(const VectorThrowingCopy &) const = default;
+  bool operator<(const VectorThrowingCopy &other) const { return payload < other.payload; } // For HeapVec and SetVec
+};
+
+// A copy or move that throws halfway through building or growing a vector must
+// destroy what it built and free its storage (checked by the instance count, and
+// by the leak sanitizer at exit), leaving a growing vector as it was; the
+// vector-based containers moved from a MappableContainer pass the exception on
+inline void VectorThrowingCopyTest(uint &testnum, uint &testerr)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") Vector, HeapVec and SetVec clean up after a throwing copy: ";
+
+    const auto throws = [](auto operation)
+    {
+      try
+      {
+        operation();
+      }
+      catch (std::runtime_error &)
+      {
+        return true;
+      }
+      return false;
+    };
+
+    {
+      lasd::List<VectorThrowingCopy> source;
+      for (ulong i = 0; i < 8; i++)
+      {
+        source.InsertAtBack(VectorThrowingCopy());
+      }
+      const long before = VectorThrowingCopy::live;
+
+      // From a TraversableContainer: the fourth copy throws
+      VectorThrowingCopy::budget = 3;
+      tst = throws([&source]()
+                   { lasd::Vector<VectorThrowingCopy> copy(source); }) &&
+            (VectorThrowingCopy::live == before);
+
+      // Growing: the relocation copies, and its fifth copy throws
+      VectorThrowingCopy::budget = -1;
+      lasd::Vector<VectorThrowingCopy> vec(source);
+      const ulong capacity = vec.Capacity();
+      VectorThrowingCopy::budget = 4;
+      tst = tst && throws([&vec, capacity]()
+                          { vec.Reserve(capacity + 1); });
+      tst = tst && (vec.Size() == 8) && (vec.Capacity() == capacity) && (VectorThrowingCopy::live == before + 8);
+
+      // From a MappableContainer: the fourth move throws, and reaches the caller
+      VectorThrowingCopy::budget = 3;
+      tst = tst && throws([&source]()
+                          { lasd::Vector<VectorThrowingCopy> moved(std::move(source)); });
+      VectorThrowingCopy::budget = 3;
+      tst = tst && throws([&source]()
+                          { lasd::SortableVector<VectorThrowingCopy> moved(std::move(source)); });
+      VectorThrowingCopy::budget = 3;
+      tst = tst && throws([&source]()
+                          { lasd::HeapVec<VectorThrowingCopy> moved(std::move(source)); });
+      VectorThrowingCopy::budget = 3;
+      tst = tst && throws([&source]()
+                          { lasd::SetVec<VectorThrowingCopy> moved(std::move(source)); });
+      tst = tst && (VectorThrowingCopy::live == before + 8);
+      VectorThrowingCopy::budget = -1;
+    }
+    tst = tst && (VectorThrowingCopy::live == 0);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+  VectorThrowingCopy::budget = -1;
+
+  testerr += (1 - (uint)tst);
+}
+
+// Test std::ranges algorithms on the contiguous vector iterators
+inline void VectorRangesTest(uint &testnum, uint &testerr, ulong count)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") SortableVector with std::ranges on " << count << " elements: ";
+
+    lasd::SortableVector<long> ranged(count);
+    ulong seed = 123456789;
+    for (ulong i = 0; i < count; i++)
+    {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      ranged[i] = static_cast<long>((seed >> 33) % (count + 1));
+    }
+
+    // Iterators are the element addresses
+    for (ulong i = 0; i < count; i++)
+    {
+      if (&*(ranged.begin() + i) != &ranged[i])
+      {
+        tst = false;
+        break;
+      }
+    }
+    tst = tst && (ranged.end() - ranged.begin() == static_cast<std::ptrdiff_t>(count));
+
+    lasd::SortableVector<long> sorted(ranged);
+    sorted.Sort();
+
+    std::ranges::sort(ranged);
+    tst = tst && (ranged == sorted) && std::ranges::is_sorted(ranged);
+
+    if (count > 0)
+    {
+      const lasd::SortableVector<long> &constant = ranged;
+      tst = tst && (*std::ranges::max_element(constant) == sorted.Back());
+      tst = tst && (std::ranges::lower_bound(constant, sorted[count / 2]) - constant.begin() <= static_cast<std::ptrdiff_t>(count / 2));
+    }
+
+    lasd::Vector<long> empty;
+    tst = tst && (empty.begin() == empty.end()) && std::ranges::empty(empty);
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+// Vectorized kernels against the scalar Reduce/MapInPlace on every instruction
+// set the CPU runs, on lengths around the register and block boundaries
+template <typename Data>
+void VectorKernelsTest(uint &testnum, uint &testerr, const std::string &name)
+{
+  bool tst = true;
+  testnum++;
+
+  try
+  {
+    std::cout << " " << testnum << " (" << testerr << ") Vector<" << name << "> Sum/Minimum/Maximum/Count/Exists/Scale/Add/Clamp on every SIMD level: ";
+
+    const ulong lengths[] = {1, 3, 15, 16, 17, 63, 64, 65, 1000, 4099};
+    for (int level = 0; level <= static_cast<int>(lasd::SimdSupported()); level++)
+    {
+      lasd::SimdLimit(static_cast<lasd::SimdLevel>(level));
+      tst = tst && (lasd::SimdActive() == static_cast<lasd::SimdLevel>(level));
+
+      for (ulong count : lengths)
+      {
+        lasd::Vector<Data> vec(count);
+        for (ulong i = 0; i < count; i++)
+        {
+          vec[i] = static_cast<Data>((i * 37) % 101) - static_cast<Data>(50); // Small integers: float sums stay exact
+        }
+
+        tst = tst && (vec.Sum() == vec.template Reduce<Data>([](const Data &val, const Data &acc)
+                                                             { return acc + val; }, 0));
+        tst = tst && (vec.Minimum() == *std::ranges::min_element(vec)) && (vec.Maximum() == *std::ranges::max_element(vec));
+        tst = tst && (vec.Count(7) == static_cast<ulong>(std::ranges::count(vec, static_cast<Data>(7))));
+        tst = tst && (vec.Exists(7) == (vec.Count(7) > 0)) && vec.Exists(vec.Back()) && !vec.Exists(1000);
+
+        lasd::Vector<Data> expected(vec);
+        expected.MapInPlace([](Data &val)
+                            { val = std::clamp(static_cast<Data>(val * 3 + 2), static_cast<Data>(-10), static_cast<Data>(20)); });
+        vec.Scale(3);
+        vec.Add(2);
+        vec.Clamp(-10, 20);
+        tst = tst && (vec == expected);
+      }
+    }
+    lasd::SimdLimit(lasd::SimdLevel::Avx512);
+
+    lasd::Vector<Data> empty;
+    tst = tst && (empty.Sum() == 0) && (empty.Count(0) == 0) && !empty.Exists(0);
+    try
+    {
+      empty.Minimum();
+      tst = false;
+    }
+    catch (std::length_error &)
+    {
+    }
+    try
+    {
+      empty.Clamp(1, 0);
+      tst = false;
+    }
+    catch (std::invalid_argument &)
+    {
+    }
+
+    std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+  catch (std::exception &exc)
+  {
+    tst = false;
+    std::cout << "Exception thrown: " << exc.what() << ": Error!" << std::endl;
+  }
+
+  testerr += (1 - (uint)tst);
+}
+
+/* ************************************************************************** */
+
+#endif